@@ -1,18 +1,44 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
-#include <Source/HingeJointComponent.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <rclcpp/publisher.hpp>
 #include <sensor_msgs/msg/joint_state.hpp>
 
+namespace PhysX
+{
+    class JointRequests;
+} // namespace PhysX
+
 namespace ROS2
 {
+    //! Flat table of joint states, one entry per joint, stored as parallel arrays.
+    //! Joint handles, names and joint interfaces are resolved once; positions and velocities are refreshed with Read.
+    //! PhysX joints do not report the applied effort, so the table has no efforts.
+    struct JointStateTable
+    {
+        AZStd::vector<AZ::EntityComponentIdPair> m_jointHandles; //!< Handles to address PhysX::JointRequestBus.
+        AZStd::vector<AZ::Name> m_jointNames;
+        AZStd::vector<PhysX::JointRequests*> m_joints; //!< Interfaces of the joints, null while a joint is not connected.
+        AZStd::vector<float> m_positions;
+        AZStd::vector<float> m_velocities;
+        AZStd::unordered_map<AZ::Name, size_t> m_jointIndices; //!< Index of a joint in the arrays above by its name.
+
+        //! Reads positions and velocities of all joints in one pass over the joint interfaces, without bus dispatches.
+        //! Interfaces of joints which are not connected are looked up again.
+        void Read();
+    };
+
     //! A component responsible for publishing the joint positions on ROS2 /joint_states topic.
     //!< @see <a href="https://docs.ros2.org/latest/api/sensor_msgs/msg/JointState.html">jointState message</a>.
     class JointPublisherComponent
         : public AZ::Component
         , public AZ::TickBus::Handler
+        , public AZ::EntityBus::MultiHandler
     {
     public:
         AZ_COMPONENT(JointPublisherComponent, "{a679c2e4-a602-46de-8db4-4b33d83317f4}", AZ::Component);
@@ -23,25 +49,34 @@ namespace ROS2
         void Activate() override;
         void Deactivate() override;
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
         //////////////////////////////////////////////////////////////////////////
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
         static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
         static void Reflect(AZ::ReflectContext* context);
 
-        AZStd::unordered_map<AZ::Name, PhysX::HingeJointComponent> &GetHierarchyMap();
+        //! Get the state of all hinge joints in the tree. The JointControlSystem reads the table once per physics substep,
+        //! without the system it is read once per tick.
+        //! This is the single source of joint state for other components of the robot.
+        //! @note The table is empty until the component ticks for the first time.
+        const JointStateTable& GetJointStates() const;
 
     private:
+        //////////////////////////////////////////////////////////////////////////
+        // AZ::EntityBus::MultiHandler overrides
+        void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+        //////////////////////////////////////////////////////////////////////////
+
         void PublishMessage();
         void UpdateMessage();
         void Initialize();
         AZStd::string GetFrameID() const;
 
-        float GetJointPosition(const AZ::Component& hingeComponent) const;
-
-        AZStd::unordered_map<AZ::Name, PhysX::HingeJointComponent> m_hierarchyMap;
+        JointStateTable m_jointStates;
         std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::JointState>> m_jointstatePublisher;
         sensor_msgs::msg::JointState m_jointstateMsg;
         bool m_initialized{false};
+        bool m_jointStatesRegistered = false; //!< Whether the JointControlSystem reads the table.
         float m_timeElapsedSinceLastTick = 0.0f;
 
         //! Frequency in Hz (1/s).
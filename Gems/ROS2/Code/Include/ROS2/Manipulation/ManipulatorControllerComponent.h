@@ -3,6 +3,8 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
 #include <ROS2/Utilities/Controllers/PidConfiguration.h>
 #include <control_msgs/action/follow_joint_trajectory.hpp>
 
@@ -11,8 +13,12 @@ namespace ROS2
 {
     // forward declaration
     class FollowJointTrajectoryActionServer;
+    class CompiledJointTrajectory;
+    class JointPublisherComponent;
 
     //! Component responsible for controlling a robotic arm made up of hinge joints.
+    //! Joints are registered with the JointControlSystem, which runs the controllers of all arms in a single pass.
+    //! The component samples the trajectory of the current goal and forwards it as setpoints.
     class ManipulatorControllerComponent
         : public AZ::Component
         , public AZ::TickBus::Handler
@@ -39,24 +45,24 @@ namespace ROS2
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
     private:
-        void InitializePid();
-        void InitializeCurrentPosition();
-        void KeepStillPosition(const uint64_t deltaTimeNs);
-        void ExecuteTrajectory(const uint64_t deltaTimeNs);
-        float GetJointPosition(const AZ::Component& hingeComponent);
-        float ComputeFFJointVelocity(const float currentPosition, const float desiredPosition, const rclcpp::Duration & duration) const;
-        float ComputePIDJointVelocity(const float currentPosition, const float desiredPosition, const uint64_t & deltaTimeNs, int & jointIndex);
-        void SetJointVelocity(AZ::Component& hingeComponent, const float desiredVelocity);
+        void RegisterJoints();
+        void UnregisterJoints();
+        bool CompileTrajectory();
+        void ExecuteTrajectory();
 
         AZStd::unique_ptr<FollowJointTrajectoryActionServer> m_actionServerClass;
         AZStd::string m_ROS2ControllerName;
         bool m_initialized{false};
         bool m_initializedTrajectory{false};
         Controller m_controllerType = Controller::FeedForward;
-        bool m_keepStillPositionInitialize{false};
-        AZStd::vector<Controllers::PidConfiguration> m_pidConfigurationVector;
-        AZStd::unordered_map<AZ::Name, float> m_jointKeepStillPosition;
-        trajectory_msgs::msg::JointTrajectory m_trajectory;
+        AZStd::unordered_map<AZStd::string, Controllers::PidConfiguration> m_pidConfigurations; //!< PID configurations by joint name.
+        AZStd::vector<AZ::EntityComponentIdPair> m_registeredJoints; //!< Joints registered with the JointControlSystem.
+        AZStd::vector<AZ::EntityComponentIdPair> m_trajectoryJointHandles; //!< Joints of the current goal, in trajectory order.
+        JointPublisherComponent* m_jointPublisherComponent = nullptr; //!< Source of joint state, resolved on activation.
+        AZStd::unique_ptr<CompiledJointTrajectory> m_compiledTrajectory; //!< Trajectory of the current goal, compiled on acceptance.
+        AZStd::vector<float> m_desiredPositions; //!< Trajectory sample of the current tick.
+        AZStd::vector<float> m_desiredVelocities; //!< Trajectory sample of the current tick.
+        std::shared_ptr<control_msgs::action::FollowJointTrajectory::Feedback> m_feedback;
         rclcpp::Time m_timeStartingExecutionTraj;
     };
 } // namespace ROS2
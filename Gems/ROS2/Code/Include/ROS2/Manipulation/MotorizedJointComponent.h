@@ -20,6 +20,8 @@ namespace ROS2
     //! It works with either TransformBus or RigidBodyBus.
     //! TransformBus mode, called `AnimationMode` changes local transform. In this mode, you cannot have a rigid body
     //! controller enabled. With RigidBodyBus it applies forces and torque according to PID control.
+    //! Measurement and control run in the JointControlSystem together with all other controlled joints,
+    //! the component registers the joint and forwards setpoints. It ticks only for the test signal and debugging.
     //! @note This class is already used through ROS2FrameComponent.
     class MotorizedJointComponent
         : public AZ::Component
@@ -54,11 +56,8 @@ namespace ROS2
         };
 
     private:
-        float ComputeMeasurement(AZ::ScriptTimePoint time);
-        void SetVelocity(float velocity /* m/s */, float deltaTime /* seconds */);
-        void ApplyLinVelAnimation(float velocity /* m/s */, float deltaTime /* seconds */);
-        void ApplyLinVelRigidBodyImpulse(float velocity /* m/s */, float deltaTime /* seconds */);
-        void ApplyLinVelRigidBody(float velocity /* m/s */, float deltaTime /* seconds */);
+        //! Handle of this joint in the JointControlSystem.
+        AZ::EntityComponentIdPair GetJointHandle() const;
         //////////////////////////////////////////////////////////////////////////
         // AZ::TickBus::Handler overrides
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
@@ -79,10 +78,7 @@ namespace ROS2
 
         float m_zeroOffset{ 0.f }; //!< offset added to setpoint.
         float m_setpoint{ 0 }; //!< Desired local position.
-        float m_error{ 0 }; //!< Current error (difference between control value and measurement).
-        float m_currentPosition{ 0 }; //!< Last measured position.
-        float m_currentVelocity{ 0 }; //!< Last measured velocity.
-        double m_lastMeasurementTime{ 0 }; //!< Last measurement time in seconds.
+        bool m_registered{ false }; //!< Joint is registered with the JointControlSystem.
 
         AZ::EntityId m_debugDrawEntity; //!< Optional Entity that allows to visualize desired setpoint value.
         AZ::Transform m_debugDrawEntityInitialTransform; //!< Initial transform of m_debugDrawEntity.
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <AzCore/std/parallel/atomic.h>
 #include <ROS2/Communication/TopicConfiguration.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
 #include <ROS2/ROS2Bus.h>
@@ -26,6 +27,9 @@ namespace ROS2
         virtual void Activate(const AZ::Entity* entity, const TopicConfiguration& subscriberConfiguration) = 0;
         //! Interface handling component deactivation
         virtual void Deactivate() = 0;
+        //! Notifies control buses of commands received since the last call.
+        //! Subscription callbacks only store received commands, buses are notified by this call on the main thread.
+        virtual void NotifyReceivedCommands() = 0;
         virtual ~IControlSubscriptionHandler() = default;
     };
 
@@ -37,8 +41,9 @@ namespace ROS2
     public:
         void Activate(const AZ::Entity* entity, const TopicConfiguration& subscriberConfiguration) override final
         {
-            m_active = true;
             m_entityId = entity->GetId();
+            OnActivate(entity);
+            m_active = true;
             if (!m_controlSubscription)
             {
                 auto ros2Frame = entity->FindComponent<ROS2FrameComponent>();
@@ -59,6 +64,7 @@ namespace ROS2
         {
             m_active = false;
             m_controlSubscription.reset(); // Note: topic and qos can change, need to re-subscribe
+            OnDeactivate();
         };
 
         virtual ~ControlSubscriptionHandler() = default;
@@ -69,6 +75,16 @@ namespace ROS2
             return m_entityId;
         }
 
+        //! Called on activation, before control messages are processed.
+        virtual void OnActivate([[maybe_unused]] const AZ::Entity* entity)
+        {
+        }
+
+        //! Called on deactivation, after the subscription is released.
+        virtual void OnDeactivate()
+        {
+        }
+
     private:
         void OnControlMessage(const T& message)
         {
@@ -77,13 +93,14 @@ namespace ROS2
                 return;
             }
 
-            SendToBus(message);
+            StoreCommand(message);
         };
 
-        virtual void SendToBus(const T& message) = 0;
+        //! Stores a received command until the next notification. Called on the thread of the subscription callback.
+        virtual void StoreCommand(const T& message) = 0;
 
         AZ::EntityId m_entityId;
-        bool m_active = false;
+        AZStd::atomic_bool m_active{ false }; //!< Messages can be received on an executor thread.
         typename rclcpp::Subscription<T>::SharedPtr m_controlSubscription;
     };
 } // namespace ROS2
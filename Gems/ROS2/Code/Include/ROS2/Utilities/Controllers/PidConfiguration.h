@@ -20,6 +20,14 @@ namespace ROS2::Controllers
         AZ_TYPE_INFO(PidConfiguration, "{814E0D1E-2C33-44A5-868E-C914640E2F7E}");
         static void Reflect(AZ::ReflectContext* context);
 
+        PidConfiguration() = default;
+
+        //! Create a configuration with given gains.
+        //! @param p proportional gain.
+        //! @param i integral gain.
+        //! @param d derivative gain.
+        PidConfiguration(double p, double i, double d);
+
         //! Initialize PID using member fields as set by the user.
         void InitializePid();
 
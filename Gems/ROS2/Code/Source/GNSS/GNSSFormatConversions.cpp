@@ -8,100 +8,178 @@
 
 #include "GNSSFormatConversions.h"
 
-constexpr double earthSemimajorAxis = 6378137.0f;
-constexpr double reciprocalFlattening = 1 / 298.257223563f;
-constexpr double earthSemiminorAxis = earthSemimajorAxis * (1.0f - reciprocalFlattening);
-constexpr double firstEccentricitySquared = 2 * reciprocalFlattening - reciprocalFlattening * reciprocalFlattening;
+constexpr double earthSemimajorAxis = 6378137.0;
+constexpr double reciprocalFlattening = 1.0 / 298.257223563;
+constexpr double earthSemiminorAxis = earthSemimajorAxis * (1.0 - reciprocalFlattening);
+constexpr double firstEccentricitySquared = 2.0 * reciprocalFlattening - reciprocalFlattening * reciprocalFlattening;
 constexpr double secondEccentrictySquared =
-    reciprocalFlattening * (2.0f - reciprocalFlattening) / ((1.0f - reciprocalFlattening) * (1.0f - reciprocalFlattening));
+    reciprocalFlattening * (2.0 - reciprocalFlattening) / ((1.0 - reciprocalFlattening) * (1.0 - reciprocalFlattening));
+// AZ::Constants::Pi and AZ::DegToRad are single precision.
+constexpr double pi = 3.14159265358979323846;
+constexpr double degToRad = pi / 180.0;
+constexpr double radToDeg = 180.0 / pi;
 
 // Based on http://wiki.gis.com/wiki/index.php/Geodetic_system
 namespace ROS2::GNSS
 {
-
-    AZ::Vector3 WGS84ToECEF(const AZ::Vector3& latitudeLongitudeAltitude)
+    namespace
+    {
+        Vector3d ToVector3d(const AZ::Vector3& v)
+        {
+            return { v.GetX(), v.GetY(), v.GetZ() };
+        }
+
+        AZ::Vector3 ToVector3(const Vector3d& v)
+        {
+            return { static_cast<float>(v.m_x), static_cast<float>(v.m_y), static_cast<float>(v.m_z) };
+        }
+    } // namespace
+
+    Vector3d WGS84ToECEF(const Vector3d& latitudeLongitudeAltitude)
     {
-        const double latitudeRad = AZ::DegToRad(latitudeLongitudeAltitude.GetX());
-        const double longitudeRad = AZ::DegToRad(latitudeLongitudeAltitude.GetY());
-        const double altitude = latitudeLongitudeAltitude.GetZ();
+        const double latitudeRad = latitudeLongitudeAltitude.m_x * degToRad;
+        const double longitudeRad = latitudeLongitudeAltitude.m_y * degToRad;
+        const double altitude = latitudeLongitudeAltitude.m_z;
 
-        const double helper = AZStd::sqrt(1.0f - firstEccentricitySquared * AZStd::sin(latitudeRad) * AZStd::sin(latitudeRad));
+        const double sinLatitude = AZStd::sin(latitudeRad);
+        const double cosLatitude = AZStd::cos(latitudeRad);
+        const double helper = AZStd::sqrt(1.0 - firstEccentricitySquared * sinLatitude * sinLatitude);
 
-        const double X = (earthSemimajorAxis / helper + altitude) * AZStd::cos(latitudeRad) * AZStd::cos(longitudeRad);
-        const double Y = (earthSemimajorAxis / helper + altitude) * AZStd::cos(latitudeRad) * AZStd::sin(longitudeRad);
-        const double Z = (earthSemimajorAxis * (1.0f - firstEccentricitySquared) / helper + altitude) * AZStd::sin(latitudeRad);
+        const double X = (earthSemimajorAxis / helper + altitude) * cosLatitude * AZStd::cos(longitudeRad);
+        const double Y = (earthSemimajorAxis / helper + altitude) * cosLatitude * AZStd::sin(longitudeRad);
+        const double Z = (earthSemimajorAxis * (1.0 - firstEccentricitySquared) / helper + altitude) * sinLatitude;
 
-        return { static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z) };
+        return { X, Y, Z };
+    }
+
+    AZ::Vector3 WGS84ToECEF(const AZ::Vector3& latitudeLongitudeAltitude)
+    {
+        return ToVector3(WGS84ToECEF(ToVector3d(latitudeLongitudeAltitude)));
     }
 
     AZ::Vector3 ECEFToENU(const AZ::Vector3& referenceLatitudeLongitudeAltitude, const AZ::Vector3& ECEFPoint)
     {
-        const AZ::Vector3 referencePointInECEF = WGS84ToECEF(referenceLatitudeLongitudeAltitude);
-        const AZ::Vector3 pointToReferencePointECEF = ECEFPoint - referencePointInECEF;
-
-        const float referenceLatitudeRad = AZ::DegToRad(referenceLatitudeLongitudeAltitude.GetX());
-        const float referenceLongitudeRad = AZ::DegToRad(referenceLatitudeLongitudeAltitude.GetY());
-
-        return {
-            -AZStd::sin(referenceLongitudeRad) * pointToReferencePointECEF.GetX() +
-                AZStd::cos(referenceLongitudeRad) * pointToReferencePointECEF.GetY(),
-            -AZStd::sin(referenceLatitudeRad) * AZStd::cos(referenceLongitudeRad) * pointToReferencePointECEF.GetX() -
-                AZStd::sin(referenceLatitudeRad) * AZStd::sin(referenceLongitudeRad) * pointToReferencePointECEF.GetY() +
-                AZStd::cos(referenceLatitudeRad) * pointToReferencePointECEF.GetZ(),
-            AZStd::cos(referenceLatitudeRad) * AZStd::cos(referenceLongitudeRad) * pointToReferencePointECEF.GetX() +
-                AZStd::cos(referenceLatitudeRad) * AZStd::sin(referenceLongitudeRad) * pointToReferencePointECEF.GetY() +
-                AZStd::sin(referenceLatitudeRad) * pointToReferencePointECEF.GetZ(),
-        };
+        const GeodeticReference reference(ToVector3d(referenceLatitudeLongitudeAltitude));
+        return ToVector3(reference.ECEFToENU(ToVector3d(ECEFPoint)));
     }
 
     AZ::Vector3 ENUToECEF(const AZ::Vector3& referenceLatitudeLongitudeAltitude, const AZ::Vector3& ENUPoint)
     {
-        AZ::Vector3 referenceECEF = WGS84ToECEF(referenceLatitudeLongitudeAltitude);
-
-        const float referenceLatitudeRad = AZ::DegToRad(referenceLatitudeLongitudeAltitude.GetX());
-        const float referenceLongitudeRad = AZ::DegToRad(referenceLatitudeLongitudeAltitude.GetY());
-        const float e = ENUPoint.GetX();
-        const float n = ENUPoint.GetY();
-        const float u = ENUPoint.GetZ();
-
-        return { -AZStd::sin(referenceLongitudeRad) * e - AZStd::cos(referenceLongitudeRad) * AZStd::sin(referenceLatitudeRad) * n +
-                     AZStd::cos(referenceLongitudeRad) * AZStd::cos(referenceLatitudeRad) * u + referenceECEF.GetX(),
-                 AZStd::cos(referenceLongitudeRad) * e - AZStd::sin(referenceLongitudeRad) * AZStd::sin(referenceLatitudeRad) * n +
-                     AZStd::cos(referenceLatitudeRad) * AZStd::sin(referenceLongitudeRad) * u + referenceECEF.GetY(),
-                 AZStd::cos(referenceLatitudeRad) * n + AZStd::sin(referenceLatitudeRad) * u + referenceECEF.GetZ() };
+        const GeodeticReference reference(ToVector3d(referenceLatitudeLongitudeAltitude));
+        return ToVector3(reference.ENUToECEF(ToVector3d(ENUPoint)));
     }
 
-    AZ::Vector3 ECEFToWGS84(const AZ::Vector3& ECFEPoint)
+    Vector3d ECEFToWGS84(const Vector3d& ECEFPoint)
     {
-        const double x = ECFEPoint.GetX();
-        const double y = ECFEPoint.GetY();
-        const double z = ECFEPoint.GetZ();
+        const double x = ECEFPoint.m_x;
+        const double y = ECEFPoint.m_y;
+        const double z = ECEFPoint.m_z;
 
         const double radiusSquared = x * x + y * y;
         const double radius = AZStd::sqrt(radiusSquared);
 
         const double E2 = earthSemimajorAxis * earthSemimajorAxis - earthSemiminorAxis * earthSemiminorAxis;
-        const double F = 54.0f * earthSemiminorAxis * earthSemiminorAxis * z * z;
-        const double G = radiusSquared + (1.0f - firstEccentricitySquared) * z * z - firstEccentricitySquared * E2;
+        const double F = 54.0 * earthSemiminorAxis * earthSemiminorAxis * z * z;
+        const double G = radiusSquared + (1.0 - firstEccentricitySquared) * z * z - firstEccentricitySquared * E2;
         const double c = (firstEccentricitySquared * firstEccentricitySquared * F * radiusSquared) / (G * G * G);
-        const double s = AZStd::pow(1. + c + AZStd::sqrt(c * c + 2. * c), 1. / 3);
-        const double P = F / (3.0f * (s + 1.0f / s + 1.0f) * (s + 1.0f / s + 1.0f) * G * G);
-        const double Q = AZStd::sqrt(1.0f + 2.0f * firstEccentricitySquared * firstEccentricitySquared * P);
+        const double s = AZStd::pow(1.0 + c + AZStd::sqrt(c * c + 2.0 * c), 1.0 / 3.0);
+        const double P = F / (3.0 * (s + 1.0 / s + 1.0) * (s + 1.0 / s + 1.0) * G * G);
+        const double Q = AZStd::sqrt(1.0 + 2.0 * firstEccentricitySquared * firstEccentricitySquared * P);
 
-        const double ro = -(firstEccentricitySquared * P * radius) / (1.0f + Q) +
+        const double ro = -(firstEccentricitySquared * P * radius) / (1.0 + Q) +
             AZStd::sqrt(
-                (earthSemimajorAxis * earthSemimajorAxis / 2.0f) * (1.0f + 1.0f / Q) -
-                ((1.0f - firstEccentricitySquared) * P * z * z) / (Q * (1.0f + Q)) - P * radiusSquared / 2.0f);
+                (earthSemimajorAxis * earthSemimajorAxis / 2.0) * (1.0 + 1.0 / Q) -
+                ((1.0 - firstEccentricitySquared) * P * z * z) / (Q * (1.0 + Q)) - P * radiusSquared / 2.0);
         const double tmp = (radius - firstEccentricitySquared * ro) * (radius - firstEccentricitySquared * ro);
         const double U = AZStd::sqrt(tmp + z * z);
-        const double V = AZStd::sqrt(tmp + (1.0f - firstEccentricitySquared) * z * z);
+        const double V = AZStd::sqrt(tmp + (1.0 - firstEccentricitySquared) * z * z);
         const double zo = (earthSemiminorAxis * earthSemiminorAxis * z) / (earthSemimajorAxis * V);
 
         const double latitude = AZStd::atan((z + secondEccentrictySquared * zo) / radius);
         const double longitude = AZStd::atan2(y, x);
-        const double altitude = U * (1.0f - earthSemiminorAxis * earthSemiminorAxis / (earthSemimajorAxis * V));
+        const double altitude = U * (1.0 - earthSemiminorAxis * earthSemiminorAxis / (earthSemimajorAxis * V));
+
+        return { latitude * radToDeg, longitude * radToDeg, altitude };
+    }
+
+    AZ::Vector3 ECEFToWGS84(const AZ::Vector3& ECFEPoint)
+    {
+        return ToVector3(ECEFToWGS84(ToVector3d(ECFEPoint)));
+    }
 
-        return { AZ::RadToDeg(static_cast<float>(latitude)), AZ::RadToDeg(static_cast<float>(longitude)), static_cast<float>(altitude) };
+    GeodeticReference::GeodeticReference()
+        : GeodeticReference(Vector3d{})
+    {
+    }
+
+    GeodeticReference::GeodeticReference(const Vector3d& originLatitudeLongitudeAltitude)
+        : m_originWGS84(originLatitudeLongitudeAltitude)
+        , m_originECEF(WGS84ToECEF(originLatitudeLongitudeAltitude))
+    {
+        const double latitudeRad = originLatitudeLongitudeAltitude.m_x * degToRad;
+        const double longitudeRad = originLatitudeLongitudeAltitude.m_y * degToRad;
+        const double sinLatitude = AZStd::sin(latitudeRad);
+        const double cosLatitude = AZStd::cos(latitudeRad);
+        const double sinLongitude = AZStd::sin(longitudeRad);
+        const double cosLongitude = AZStd::cos(longitudeRad);
+
+        // Columns are the east, north and up unit vectors expressed in ECEF.
+        m_enuToEcef[0][0] = -sinLongitude;
+        m_enuToEcef[0][1] = -sinLatitude * cosLongitude;
+        m_enuToEcef[0][2] = cosLatitude * cosLongitude;
+        m_enuToEcef[1][0] = cosLongitude;
+        m_enuToEcef[1][1] = -sinLatitude * sinLongitude;
+        m_enuToEcef[1][2] = cosLatitude * sinLongitude;
+        m_enuToEcef[2][0] = 0.0;
+        m_enuToEcef[2][1] = cosLatitude;
+        m_enuToEcef[2][2] = sinLatitude;
     }
 
+    const Vector3d& GeodeticReference::GetOriginWGS84() const
+    {
+        return m_originWGS84;
+    }
+
+    const Vector3d& GeodeticReference::GetOriginECEF() const
+    {
+        return m_originECEF;
+    }
+
+    Vector3d GeodeticReference::ENUToECEF(const Vector3d& ENUPoint) const
+    {
+        const auto& r = m_enuToEcef;
+        return { r[0][0] * ENUPoint.m_x + r[0][1] * ENUPoint.m_y + r[0][2] * ENUPoint.m_z + m_originECEF.m_x,
+                 r[1][0] * ENUPoint.m_x + r[1][1] * ENUPoint.m_y + r[1][2] * ENUPoint.m_z + m_originECEF.m_y,
+                 r[2][0] * ENUPoint.m_x + r[2][1] * ENUPoint.m_y + r[2][2] * ENUPoint.m_z + m_originECEF.m_z };
+    }
+
+    Vector3d GeodeticReference::ECEFToENU(const Vector3d& ECEFPoint) const
+    {
+        const auto& r = m_enuToEcef;
+        const double dx = ECEFPoint.m_x - m_originECEF.m_x;
+        const double dy = ECEFPoint.m_y - m_originECEF.m_y;
+        const double dz = ECEFPoint.m_z - m_originECEF.m_z;
+        return { r[0][0] * dx + r[1][0] * dy + r[2][0] * dz,
+                 r[0][1] * dx + r[1][1] * dy + r[2][1] * dz,
+                 r[0][2] * dx + r[1][2] * dy + r[2][2] * dz };
+    }
+
+    Vector3d GeodeticReference::ENUToWGS84(const Vector3d& ENUPoint) const
+    {
+        return ECEFToWGS84(ENUToECEF(ENUPoint));
+    }
+
+    void GeodeticReference::ENUToWGS84(AZStd::span<const AZ::Vector3> ENUPoints, AZStd::span<Vector3d> WGS84Points) const
+    {
+        AZ_Assert(WGS84Points.size() >= ENUPoints.size(), "Output span is smaller than the input span");
+        const size_t count = ENUPoints.size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            WGS84Points[i] = ENUToECEF(ToVector3d(ENUPoints[i]));
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            WGS84Points[i] = ECEFToWGS84(WGS84Points[i]);
+        }
+    }
 } // namespace ROS2::GNSS
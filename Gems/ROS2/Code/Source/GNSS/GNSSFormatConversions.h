@@ -9,9 +9,18 @@
 #pragma once
 
 #include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/std/containers/span.h>
 
 namespace ROS2::GNSS
 {
+    //! Double precision 3d vector used by geodetic conversions.
+    //! Single precision (AZ::Vector3) is not sufficient for ECEF coordinates, which are in the order of 1e6 meters.
+    struct Vector3d
+    {
+        double m_x = 0.0;
+        double m_y = 0.0;
+        double m_z = 0.0;
+    };
 
     //! Converts point in 1984 World Geodetic System (GS84) to Earth Centred Earth Fixed (ECEF)
     //! @param latitudeLongitudeAltitude - point's latitude, longitude and altitude as 3d vector.
@@ -20,6 +29,9 @@ namespace ROS2::GNSS
     //! @return 3d vector of ECEF coordinates.
     AZ::Vector3 WGS84ToECEF(const AZ::Vector3& latitudeLongitudeAltitude);
 
+    //! Double precision variant of WGS84ToECEF.
+    Vector3d WGS84ToECEF(const Vector3d& latitudeLongitudeAltitude);
+
     //! Converts Earth Centred Earth Fixed (ECEF) coordinates to local east, north, up (ENU)
     //! @param referenceLatitudeLongitudeAltitude - reference point's latitude, longitude and altitude as 3d vector.
     //!     latitude and longitude are in decimal degrees
@@ -42,4 +54,39 @@ namespace ROS2::GNSS
     //!     latitude and longitude are in decimal degrees
     //!     altitude is in meters
     AZ::Vector3 ECEFToWGS84(const AZ::Vector3& ECFEPoint);
+
+    //! Double precision variant of ECEFToWGS84.
+    Vector3d ECEFToWGS84(const Vector3d& ECEFPoint);
+
+    //! Local east, north, up (ENU) frame anchored at a fixed WGS84 origin.
+    //! The origin's ECEF position and the ENU to ECEF rotation are computed once on construction,
+    //! so converting a point costs a single matrix multiplication followed by ECEFToWGS84.
+    class GeodeticReference
+    {
+    public:
+        GeodeticReference();
+
+        //! @param originLatitudeLongitudeAltitude - origin's latitude and longitude in decimal degrees, altitude in meters.
+        explicit GeodeticReference(const Vector3d& originLatitudeLongitudeAltitude);
+
+        const Vector3d& GetOriginWGS84() const;
+        const Vector3d& GetOriginECEF() const;
+
+        Vector3d ENUToECEF(const Vector3d& ENUPoint) const;
+        Vector3d ECEFToENU(const Vector3d& ECEFPoint) const;
+        Vector3d ENUToWGS84(const Vector3d& ENUPoint) const;
+
+        //! Converts a batch of ENU points to WGS84 in a single pass.
+        //! The rotation to ECEF is applied to the whole batch first as a plain loop over contiguous data,
+        //! then the geodetic solution runs per point.
+        //! @param ENUPoints - points in the local ENU frame.
+        //! @param WGS84Points - output, must be at least as large as ENUPoints.
+        void ENUToWGS84(AZStd::span<const AZ::Vector3> ENUPoints, AZStd::span<Vector3d> WGS84Points) const;
+
+    private:
+        Vector3d m_originWGS84;
+        Vector3d m_originECEF;
+        //! Row-major rotation from ENU to ECEF. Its transpose rotates ECEF to ENU.
+        double m_enuToEcef[3][3];
+    };
 } // namespace ROS2::GNSS
@@ -81,6 +81,8 @@ namespace ROS2
         m_gnssPublisher = ros2Node->create_publisher<sensor_msgs::msg::NavSatFix>(fullTopic.data(), publisherConfig.GetQoS());
 
         m_gnssMsg.header.frame_id = "gnss_frame_id";
+
+        m_geodeticReference = GNSS::GeodeticReference({ m_gnssOriginLatitudeDeg, m_gnssOriginLongitudeDeg, m_gnssOriginAltitude });
     }
 
     void ROS2GNSSSensorComponent::Deactivate()
@@ -92,13 +94,12 @@ namespace ROS2
     void ROS2GNSSSensorComponent::FrequencyTick()
     {
         const AZ::Vector3 currentPosition = GetCurrentPose().GetTranslation();
-        const AZ::Vector3 currentPositionECEF =
-            GNSS::ENUToECEF({ m_gnssOriginLatitudeDeg, m_gnssOriginLongitudeDeg, m_gnssOriginAltitude }, currentPosition);
-        const AZ::Vector3 currentPositionWGS84 = GNSS::ECEFToWGS84(currentPositionECEF);
+        const GNSS::Vector3d currentPositionWGS84 =
+            m_geodeticReference.ENUToWGS84({ currentPosition.GetX(), currentPosition.GetY(), currentPosition.GetZ() });
 
-        m_gnssMsg.latitude = currentPositionWGS84.GetX();
-        m_gnssMsg.longitude = currentPositionWGS84.GetY();
-        m_gnssMsg.altitude = currentPositionWGS84.GetZ();
+        m_gnssMsg.latitude = currentPositionWGS84.m_x;
+        m_gnssMsg.longitude = currentPositionWGS84.m_y;
+        m_gnssMsg.altitude = currentPositionWGS84.m_z;
 
         m_gnssMsg.status.status = sensor_msgs::msg::NavSatStatus::STATUS_SBAS_FIX;
         m_gnssMsg.status.service = sensor_msgs::msg::NavSatStatus::SERVICE_GALILEO;
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include "GNSSFormatConversions.h"
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <ROS2/Sensor/ROS2SensorComponent.h>
@@ -44,6 +45,9 @@ namespace ROS2
 
         AZ::Transform GetCurrentPose() const;
 
+        //! ENU frame of the simulation, computed once on activation from the origin offset.
+        GNSS::GeodeticReference m_geodeticReference;
+
         std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::NavSatFix>> m_gnssPublisher;
         sensor_msgs::msg::NavSatFix m_gnssMsg;
     };
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CompiledJointTrajectory.h"
+#include <rclcpp/duration.hpp>
+
+namespace ROS2
+{
+    namespace Internal
+    {
+        //! State of a single joint at a trajectory knot.
+        struct KnotState
+        {
+            double m_position = 0.0;
+            double m_velocity = 0.0;
+            double m_acceleration = 0.0;
+        };
+
+        CompiledJointTrajectory::SegmentCoefficients ComputeSegment(
+            const KnotState& start, const KnotState& end, double duration, bool useVelocities, bool useAccelerations)
+        {
+            CompiledJointTrajectory::SegmentCoefficients c{};
+            const double h = end.m_position - start.m_position;
+            const double T = duration;
+            c[0] = start.m_position;
+            if (!useVelocities)
+            {
+                c[1] = h / T;
+                return c;
+            }
+
+            const double v0 = start.m_velocity;
+            const double v1 = end.m_velocity;
+            if (!useAccelerations)
+            {
+                c[1] = v0;
+                c[2] = (3.0 * h - (2.0 * v0 + v1) * T) / (T * T);
+                c[3] = (-2.0 * h + (v0 + v1) * T) / (T * T * T);
+                return c;
+            }
+
+            const double a0 = start.m_acceleration;
+            const double a1 = end.m_acceleration;
+            const double T2 = T * T;
+            c[1] = v0;
+            c[2] = a0 / 2.0;
+            c[3] = (20.0 * h - (8.0 * v1 + 12.0 * v0) * T - (3.0 * a0 - a1) * T2) / (2.0 * T2 * T);
+            c[4] = (-30.0 * h + (14.0 * v1 + 16.0 * v0) * T + (3.0 * a0 - 2.0 * a1) * T2) / (2.0 * T2 * T2);
+            c[5] = (12.0 * h - 6.0 * (v1 + v0) * T + (a1 - a0) * T2) / (2.0 * T2 * T2 * T);
+            return c;
+        }
+    } // namespace Internal
+
+    AZ::Outcome<void, AZStd::string> CompiledJointTrajectory::Compile(
+        const trajectory_msgs::msg::JointTrajectory& trajectory, const JointStateTable& jointStates)
+    {
+        m_jointStateIndices.clear();
+        m_knotTimes.clear();
+        m_coefficients.clear();
+        m_currentSegment = 0;
+
+        const size_t jointCount = trajectory.joint_names.size();
+        for (const auto& jointName : trajectory.joint_names)
+        {
+            auto jointIt = jointStates.m_jointIndices.find(AZ::Name(jointName.c_str()));
+            if (jointIt == jointStates.m_jointIndices.end())
+            {
+                return AZ::Failure(AZStd::string::format("Unknown joint %s", jointName.c_str()));
+            }
+            m_jointStateIndices.push_back(jointIt->second);
+        }
+
+        if (trajectory.points.empty())
+        {
+            return AZ::Failure(AZStd::string("Trajectory has no points"));
+        }
+
+        double previousTime = 0.0;
+        for (const auto& point : trajectory.points)
+        {
+            if (point.positions.size() != jointCount || (!point.velocities.empty() && point.velocities.size() != jointCount) ||
+                (!point.accelerations.empty() && point.accelerations.size() != jointCount))
+            {
+                return AZ::Failure(AZStd::string("Trajectory point size does not match the number of joints"));
+            }
+            const double time = rclcpp::Duration(point.time_from_start).seconds();
+            if (time < previousTime || (time == previousTime && &point != &trajectory.points.front()))
+            {
+                return AZ::Failure(AZStd::string("Trajectory points are not strictly increasing in time"));
+            }
+            previousTime = time;
+        }
+
+        // Knot states are built per joint; the current state of the joint is the first knot
+        AZStd::vector<Internal::KnotState> startStates(jointCount);
+        AZStd::vector<Internal::KnotState> endStates(jointCount);
+        for (size_t joint = 0; joint < jointCount; ++joint)
+        {
+            const size_t stateIndex = m_jointStateIndices[joint];
+            startStates[joint].m_position = jointStates.m_positions[stateIndex];
+            startStates[joint].m_velocity = jointStates.m_velocities[stateIndex];
+        }
+        bool startHasVelocities = true;
+        bool startHasAccelerations = true;
+        double startTime = 0.0;
+        m_knotTimes.push_back(startTime);
+
+        for (const auto& point : trajectory.points)
+        {
+            const double time = rclcpp::Duration(point.time_from_start).seconds();
+            const bool hasVelocities = !point.velocities.empty();
+            const bool hasAccelerations = !point.accelerations.empty();
+            for (size_t joint = 0; joint < jointCount; ++joint)
+            {
+                endStates[joint].m_position = point.positions[joint];
+                endStates[joint].m_velocity = hasVelocities ? point.velocities[joint] : 0.0;
+                endStates[joint].m_acceleration = hasAccelerations ? point.accelerations[joint] : 0.0;
+            }
+
+            // A point at time zero replaces the current joint state as the first knot
+            if (time > startTime)
+            {
+                const bool useVelocities = startHasVelocities && hasVelocities;
+                const bool useAccelerations = useVelocities && startHasAccelerations && hasAccelerations;
+                for (size_t joint = 0; joint < jointCount; ++joint)
+                {
+                    m_coefficients.push_back(
+                        Internal::ComputeSegment(startStates[joint], endStates[joint], time - startTime, useVelocities, useAccelerations));
+                }
+                m_knotTimes.push_back(time);
+            }
+
+            AZStd::swap(startStates, endStates);
+            startHasVelocities = hasVelocities;
+            startHasAccelerations = hasAccelerations;
+            startTime = time;
+        }
+
+        if (m_coefficients.empty())
+        {
+            // Single point at time zero, hold it
+            for (size_t joint = 0; joint < jointCount; ++joint)
+            {
+                SegmentCoefficients hold{};
+                hold[0] = startStates[joint].m_position;
+                m_coefficients.push_back(hold);
+            }
+            m_knotTimes.push_back(0.0);
+        }
+
+        return AZ::Success();
+    }
+
+    size_t CompiledJointTrajectory::GetJointCount() const
+    {
+        return m_jointStateIndices.size();
+    }
+
+    const AZStd::vector<size_t>& CompiledJointTrajectory::GetJointStateIndices() const
+    {
+        return m_jointStateIndices;
+    }
+
+    double CompiledJointTrajectory::GetDuration() const
+    {
+        return m_knotTimes.empty() ? 0.0 : m_knotTimes.back();
+    }
+
+    void CompiledJointTrajectory::Sample(double time, AZStd::vector<float>& positions, AZStd::vector<float>& velocities)
+    {
+        const size_t jointCount = GetJointCount();
+        positions.resize(jointCount);
+        velocities.resize(jointCount);
+        if (m_knotTimes.size() < 2)
+        {
+            return;
+        }
+
+        const size_t segmentCount = m_knotTimes.size() - 1;
+        while (m_currentSegment + 1 < segmentCount && time >= m_knotTimes[m_currentSegment + 1])
+        {
+            ++m_currentSegment;
+        }
+
+        const double segmentStart = m_knotTimes[m_currentSegment];
+        const double segmentEnd = m_knotTimes[m_currentSegment + 1];
+        const double t = AZStd::clamp(time, segmentStart, segmentEnd) - segmentStart;
+        // Past the end of the trajectory the last position is held
+        const bool finished = time >= segmentEnd && m_currentSegment + 1 == segmentCount;
+        const SegmentCoefficients* coefficients = &m_coefficients[m_currentSegment * jointCount];
+        for (size_t joint = 0; joint < jointCount; ++joint)
+        {
+            const SegmentCoefficients& c = coefficients[joint];
+            positions[joint] = aznumeric_cast<float>(c[0] + t * (c[1] + t * (c[2] + t * (c[3] + t * (c[4] + t * c[5])))));
+            velocities[joint] = finished
+                ? 0.0f
+                : aznumeric_cast<float>(c[1] + t * (2.0 * c[2] + t * (3.0 * c[3] + t * (4.0 * c[4] + t * 5.0 * c[5]))));
+        }
+    }
+} // namespace ROS2
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <ROS2/Manipulation/JointPublisherComponent.h>
+#include <trajectory_msgs/msg/joint_trajectory.hpp>
+
+namespace ROS2
+{
+    //! A joint trajectory prepared for execution.
+    //! The trajectory is compiled once, when a goal is accepted, into a time-indexed array of polynomial segments per joint.
+    //! Joints are resolved to the JointStateTable up front, so sampling does not do any lookups.
+    //! Segment order follows the data in the trajectory points: linear for positions only, cubic when velocities are given
+    //! and quintic when accelerations are given as well.
+    class CompiledJointTrajectory
+    {
+    public:
+        static constexpr size_t MaxCoefficients = 6;
+        using SegmentCoefficients = AZStd::array<double, MaxCoefficients>;
+
+        //! Compile a trajectory.
+        //! If the first point is not at time zero, a segment from the current joint state to the first point is prepended.
+        //! @param trajectory trajectory as received in the FollowJointTrajectory goal.
+        //! @param jointStates table of joints of the manipulator, used to resolve joints and read their current state.
+        //! @returns success or the reason why the trajectory cannot be executed.
+        AZ::Outcome<void, AZStd::string> Compile(
+            const trajectory_msgs::msg::JointTrajectory& trajectory, const JointStateTable& jointStates);
+
+        //! Number of joints in the trajectory.
+        size_t GetJointCount() const;
+
+        //! For each trajectory joint, its index in the JointStateTable.
+        const AZStd::vector<size_t>& GetJointStateIndices() const;
+
+        //! Duration of the whole trajectory in seconds.
+        double GetDuration() const;
+
+        //! Sample desired positions and velocities of all joints.
+        //! Lookup of the segment is O(1) as long as time does not decrease between calls.
+        //! @param time time since the trajectory start in seconds. Clamped to the trajectory duration.
+        //! @param positions output, resized to the joint count.
+        //! @param velocities output, resized to the joint count.
+        void Sample(double time, AZStd::vector<float>& positions, AZStd::vector<float>& velocities);
+
+    private:
+        AZStd::vector<size_t> m_jointStateIndices;
+        AZStd::vector<double> m_knotTimes; //!< Segment boundaries, one more than the number of segments.
+        AZStd::vector<SegmentCoefficients> m_coefficients; //!< Indexed by segment * joint count + joint.
+        size_t m_currentSegment = 0;
+    };
+} // namespace ROS2
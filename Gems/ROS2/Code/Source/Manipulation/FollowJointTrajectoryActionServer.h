@@ -26,6 +26,14 @@ namespace ROS2
         ~FollowJointTrajectoryActionServer() = default;
         void CreateServer(AZStd::string ROS2ControllerName);
 
+        //! Publish execution feedback of the active goal.
+        void PublishFeedback(const std::shared_ptr<FollowJointTrajectory::Feedback>& feedback);
+
+        //! Abort the active goal and return to the pending state.
+        //! @param errorCode one of FollowJointTrajectory::Result error codes.
+        //! @param errorMessage human readable reason.
+        void AbortGoal(int32_t errorCode, const AZStd::string& errorMessage);
+
         rclcpp_action::Server<FollowJointTrajectory>::SharedPtr m_actionServer;
         std::shared_ptr<GoalHandleFollowJointTrajectory> m_goalHandle;
 
@@ -54,6 +62,26 @@ namespace ROS2
             AZStd::bind(&FollowJointTrajectoryActionServer::goal_accepted_callback, this, AZStd::placeholders::_1));
     }
 
+    void FollowJointTrajectoryActionServer::PublishFeedback(const std::shared_ptr<FollowJointTrajectory::Feedback>& feedback)
+    {
+        if (m_goalHandle && m_goalHandle->is_executing())
+        {
+            m_goalHandle->publish_feedback(feedback);
+        }
+    }
+
+    void FollowJointTrajectoryActionServer::AbortGoal(int32_t errorCode, const AZStd::string& errorMessage)
+    {
+        if (m_goalHandle && m_goalHandle->is_executing())
+        {
+            auto result = std::make_shared<FollowJointTrajectory::Result>();
+            result->error_code = errorCode;
+            result->error_string = errorMessage.c_str();
+            m_goalHandle->abort(result);
+        }
+        m_goalStatus = GoalStatus::Pending;
+    }
+
     rclcpp_action::GoalResponse FollowJointTrajectoryActionServer::goal_received_callback(
             [[maybe_unused]] const rclcpp_action::GoalUUID & uuid,
             [[maybe_unused]] std::shared_ptr<const FollowJointTrajectory::Goal> goal)
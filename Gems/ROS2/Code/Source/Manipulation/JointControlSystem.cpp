@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "JointControlSystem.h"
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Physics/RigidBodyBus.h>
+#include <PhysX/Joint/PhysXJointRequestsBus.h>
+
+namespace ROS2
+{
+    namespace Internal
+    {
+        constexpr size_t InvalidJointIndex = AZStd::numeric_limits<size_t>::max();
+        //! Upper bound of the delta used for impulses, prevents too large forces on long substeps.
+        constexpr float MaxImpulseDeltaTime = 0.1f;
+    } // namespace Internal
+
+    JointPositionController::JointPositionController(
+        JointController type, const Controllers::PidConfiguration& pid, float feedForwardTimeReference)
+        : m_type(type)
+        , m_pid(pid)
+        , m_feedForwardTimeReference(feedForwardTimeReference)
+    {
+        AZ_Assert(type != JointController::FeedForward || feedForwardTimeReference > 0.0f, "Invalid feed forward time reference");
+        m_pid.InitializePid();
+    }
+
+    void JointPositionController::SetSetpoint(float position, float velocity)
+    {
+        m_setpoint = position;
+        m_velocity = velocity;
+        m_hasSetpoint = true;
+    }
+
+    void JointPositionController::HoldPosition()
+    {
+        m_velocity = 0.0f;
+        m_hasSetpoint = false;
+    }
+
+    float JointPositionController::ComputeCommand(float position, AZ::u64 deltaTimeNs)
+    {
+        if (!m_hasSetpoint)
+        {
+            m_setpoint = position;
+            m_hasSetpoint = true;
+        }
+
+        m_error = m_setpoint - position;
+        if (m_type == JointController::FeedForward)
+        {
+            return m_velocity + m_error / m_feedForwardTimeReference;
+        }
+        return aznumeric_cast<float>(m_pid.ComputeCommand(m_error, deltaTimeNs));
+    }
+
+    float JointPositionController::GetSetpoint() const
+    {
+        return m_setpoint;
+    }
+
+    float JointPositionController::GetError() const
+    {
+        return m_error;
+    }
+
+    AZStd::vector<ControlledJointDescription> DescribeControlledJoints(
+        const JointStateTable& jointStates,
+        JointController controller,
+        float feedForwardTimeReference,
+        const AZStd::unordered_map<AZStd::string, Controllers::PidConfiguration>& pidConfigurations)
+    {
+        AZStd::vector<ControlledJointDescription> descriptions(jointStates.m_jointHandles.size());
+        size_t configuredCount = 0;
+        for (size_t jointIndex = 0; jointIndex < descriptions.size(); ++jointIndex)
+        {
+            ControlledJointDescription& description = descriptions[jointIndex];
+            description.m_actuation = JointActuation::PhysXJointVelocity;
+            description.m_jointHandle = jointStates.m_jointHandles[jointIndex];
+            description.m_jointStates = &jointStates;
+            description.m_jointStateIndex = jointIndex;
+            description.m_controller = controller;
+            description.m_feedForwardTimeReference = feedForwardTimeReference;
+            if (controller != JointController::Pid)
+            {
+                continue;
+            }
+
+            const AZStd::string jointName(jointStates.m_jointNames[jointIndex].GetStringView());
+            if (auto pid = pidConfigurations.find(jointName); pid != pidConfigurations.end())
+            {
+                description.m_pid = pid->second;
+                ++configuredCount;
+            }
+            else
+            {
+                AZ_Warning("JointControlSystem", false, "No PID configuration for joint %s, using the default one", jointName.c_str());
+            }
+        }
+        AZ_Warning(
+            "JointControlSystem",
+            controller != JointController::Pid || configuredCount == pidConfigurations.size(),
+            "%zu PID configurations do not match any joint",
+            pidConfigurations.size() - configuredCount);
+        return descriptions;
+    }
+
+    JointControlSystem::JointControlSystem()
+        : PhysicsSubstepSystem(PhysicsSubstepEvent::SimulationFinish)
+    {
+    }
+
+    void JointControlSystem::RegisterJoint(const ControlledJointDescription& description)
+    {
+        if (m_indices.contains(description.m_jointHandle))
+        {
+            AZ_Error(
+                "JointControlSystem",
+                false,
+                "Joint %s is already registered",
+                description.m_jointHandle.GetEntityId().ToString().c_str());
+            return;
+        }
+        if (description.m_actuation == JointActuation::PhysXJointVelocity &&
+            (!description.m_jointStates ||
+             AZStd::find(m_jointStateTables.begin(), m_jointStateTables.end(), description.m_jointStates) == m_jointStateTables.end() ||
+             description.m_jointStateIndex >= description.m_jointStates->m_jointHandles.size()))
+        {
+            AZ_Error(
+                "JointControlSystem",
+                false,
+                "Joint %s is not in a registered joint state table",
+                description.m_jointHandle.GetEntityId().ToString().c_str());
+            return;
+        }
+
+        m_indices[description.m_jointHandle] = m_jointHandles.size();
+        m_jointHandles.push_back(description.m_jointHandle);
+        m_actuations.push_back(description.m_actuation);
+        m_linearGeometry.push_back({ description.m_jointAxis, description.m_effortAxis, description.m_measurementReferenceEntity });
+        m_jointStateEntries.push_back({ description.m_jointStates, description.m_jointStateIndex });
+        m_controllers.emplace_back(description.m_controller, description.m_pid, description.m_feedForwardTimeReference);
+        m_lowerLimits.push_back(description.m_lowerLimit);
+        m_upperLimits.push_back(description.m_upperLimit);
+        m_positions.push_back(0.0f);
+        m_commands.push_back(0.0f);
+
+        ConnectToPhysicsScene();
+    }
+
+    void JointControlSystem::UnregisterJoint(const AZ::EntityComponentIdPair& jointHandle)
+    {
+        auto it = m_indices.find(jointHandle);
+        if (it == m_indices.end())
+        {
+            return;
+        }
+
+        // Swap with the last joint to keep the storage contiguous
+        const size_t index = it->second;
+        m_indices.erase(it);
+        SwapRemove(m_jointHandles, index);
+        SwapRemove(m_actuations, index);
+        SwapRemove(m_linearGeometry, index);
+        SwapRemove(m_jointStateEntries, index);
+        SwapRemove(m_controllers, index);
+        SwapRemove(m_lowerLimits, index);
+        SwapRemove(m_upperLimits, index);
+        SwapRemove(m_positions, index);
+        SwapRemove(m_commands, index);
+        if (index < m_jointHandles.size())
+        {
+            m_indices[m_jointHandles[index]] = index;
+        }
+    }
+
+    void JointControlSystem::RegisterJointStates(JointStateTable* jointStates)
+    {
+        AZ_Assert(jointStates, "Invalid joint state table");
+        if (AZStd::find(m_jointStateTables.begin(), m_jointStateTables.end(), jointStates) == m_jointStateTables.end())
+        {
+            m_jointStateTables.push_back(jointStates);
+        }
+        ConnectToPhysicsScene();
+    }
+
+    void JointControlSystem::UnregisterJointStates(JointStateTable* jointStates)
+    {
+        for (size_t i = m_jointHandles.size(); i > 0; --i)
+        {
+            if (m_jointStateEntries[i - 1].m_table == jointStates)
+            {
+                UnregisterJoint(m_jointHandles[i - 1]);
+            }
+        }
+        m_jointStateTables.erase(
+            AZStd::remove(m_jointStateTables.begin(), m_jointStateTables.end(), jointStates), m_jointStateTables.end());
+    }
+
+    size_t JointControlSystem::GetIndex(const AZ::EntityComponentIdPair& jointHandle) const
+    {
+        auto it = m_indices.find(jointHandle);
+        return it != m_indices.end() ? it->second : Internal::InvalidJointIndex;
+    }
+
+    void JointControlSystem::SetSetpoint(const AZ::EntityComponentIdPair& jointHandle, float position, float velocity)
+    {
+        const size_t index = GetIndex(jointHandle);
+        if (index == Internal::InvalidJointIndex)
+        {
+            AZ_Warning("JointControlSystem", false, "Setpoint for unregistered joint %s", jointHandle.GetEntityId().ToString().c_str());
+            return;
+        }
+        m_controllers[index].SetSetpoint(position, velocity);
+    }
+
+    void JointControlSystem::SetSetpoints(
+        AZStd::span<const AZ::EntityComponentIdPair> jointHandles, AZStd::span<const float> positions, AZStd::span<const float> velocities)
+    {
+        AZ_Assert(
+            positions.size() == jointHandles.size() && velocities.size() == jointHandles.size(),
+            "Setpoints do not match the number of joints");
+        for (size_t i = 0; i < jointHandles.size(); ++i)
+        {
+            SetSetpoint(jointHandles[i], positions[i], velocities[i]);
+        }
+    }
+
+    void JointControlSystem::HoldPositions(AZStd::span<const AZ::EntityComponentIdPair> jointHandles)
+    {
+        for (const auto& jointHandle : jointHandles)
+        {
+            if (const size_t index = GetIndex(jointHandle); index != Internal::InvalidJointIndex)
+            {
+                m_controllers[index].HoldPosition();
+            }
+        }
+    }
+
+    float JointControlSystem::GetSetpoint(const AZ::EntityComponentIdPair& jointHandle) const
+    {
+        const size_t index = GetIndex(jointHandle);
+        return index != Internal::InvalidJointIndex ? m_controllers[index].GetSetpoint() : 0.0f;
+    }
+
+    float JointControlSystem::GetPosition(const AZ::EntityComponentIdPair& jointHandle) const
+    {
+        const size_t index = GetIndex(jointHandle);
+        return index != Internal::InvalidJointIndex ? m_positions[index] : 0.0f;
+    }
+
+    float JointControlSystem::GetError(const AZ::EntityComponentIdPair& jointHandle) const
+    {
+        const size_t index = GetIndex(jointHandle);
+        return index != Internal::InvalidJointIndex ? m_controllers[index].GetError() : 0.0f;
+    }
+
+    float JointControlSystem::GetCommand(const AZ::EntityComponentIdPair& jointHandle) const
+    {
+        const size_t index = GetIndex(jointHandle);
+        return index != Internal::InvalidJointIndex ? m_commands[index] : 0.0f;
+    }
+
+    void JointControlSystem::OnPhysicsSubstep(float fixedDeltaTime)
+    {
+        for (JointStateTable* jointStates : m_jointStateTables)
+        {
+            jointStates->Read();
+        }
+        if (m_jointHandles.empty())
+        {
+            return;
+        }
+
+        MeasurePositions();
+        ComputeCommands(fixedDeltaTime);
+        ApplyCommands(fixedDeltaTime);
+    }
+
+    void JointControlSystem::MeasurePositions()
+    {
+        const size_t jointCount = m_jointHandles.size();
+        for (size_t i = 0; i < jointCount; ++i)
+        {
+            if (m_actuations[i] == JointActuation::PhysXJointVelocity)
+            {
+                const JointStateEntry& entry = m_jointStateEntries[i];
+                m_positions[i] = entry.m_table->m_positions[entry.m_index];
+                continue;
+            }
+
+            const AZ::EntityId entityId = m_jointHandles[i].GetEntityId();
+            const LinearJointGeometry& geometry = m_linearGeometry[i];
+            AZ::Transform transform = AZ::Transform::CreateIdentity();
+            if (!geometry.m_measurementReferenceEntity.IsValid())
+            {
+                AZ::TransformBus::EventResult(transform, entityId, &AZ::TransformBus::Events::GetLocalTM);
+            }
+            else
+            {
+                AZ::Transform referenceTransform = AZ::Transform::CreateIdentity();
+                AZ::TransformBus::EventResult(
+                    referenceTransform, geometry.m_measurementReferenceEntity, &AZ::TransformBus::Events::GetWorldTM);
+                AZ::TransformBus::EventResult(transform, entityId, &AZ::TransformBus::Events::GetWorldTM);
+                transform = referenceTransform.GetInverse() * transform;
+            }
+            m_positions[i] = transform.GetTranslation().Dot(geometry.m_jointAxis);
+        }
+    }
+
+    void JointControlSystem::ComputeCommands(float fixedDeltaTime)
+    {
+        const uint64_t deltaTimeNs = aznumeric_cast<uint64_t>(fixedDeltaTime * 1'000'000'000);
+        const size_t jointCount = m_jointHandles.size();
+        for (size_t i = 0; i < jointCount; ++i)
+        {
+            const float position = m_positions[i];
+            float command = m_controllers[i].ComputeCommand(position, deltaTimeNs);
+            if (position <= m_lowerLimits[i])
+            {
+                command = AZStd::max(0.0f, command);
+            }
+            else if (position >= m_upperLimits[i])
+            {
+                command = AZStd::min(0.0f, command);
+            }
+            m_commands[i] = command;
+        }
+    }
+
+    void JointControlSystem::ApplyCommands(float fixedDeltaTime)
+    {
+        const size_t jointCount = m_jointHandles.size();
+        for (size_t i = 0; i < jointCount; ++i)
+        {
+            const float command = m_commands[i];
+            switch (m_actuations[i])
+            {
+            case JointActuation::PhysXJointVelocity:
+                {
+                    const JointStateEntry& entry = m_jointStateEntries[i];
+                    if (PhysX::JointRequests* joint = entry.m_table->m_joints[entry.m_index])
+                    {
+                        joint->SetVelocity(command);
+                    }
+                }
+                break;
+            case JointActuation::LinearAnimation:
+                {
+                    const AZ::EntityId entityId = m_jointHandles[i].GetEntityId();
+                    AZ::TransformBus::Event(
+                        entityId,
+                        [&](AZ::TransformInterface* transformInterface)
+                        {
+                            AZ::Transform transform = transformInterface->GetLocalTM();
+                            transform.SetTranslation(transform.GetTranslation() + command * m_linearGeometry[i].m_jointAxis * fixedDeltaTime);
+                            transformInterface->SetLocalTM(transform);
+                        });
+                }
+                break;
+            case JointActuation::LinearRigidBodyImpulse:
+                {
+                    const AZ::EntityId entityId = m_jointHandles[i].GetEntityId();
+                    AZ::Quaternion rotation = AZ::Quaternion::CreateIdentity();
+                    AZ::TransformBus::EventResult(rotation, entityId, &AZ::TransformBus::Events::GetWorldRotationQuaternion);
+                    const AZ::Vector3 impulse = rotation.TransformVector(m_linearGeometry[i].m_effortAxis * command) *
+                        AZStd::min(fixedDeltaTime, Internal::MaxImpulseDeltaTime);
+                    Physics::RigidBodyRequestBus::Event(entityId, &Physics::RigidBodyRequests::ApplyLinearImpulse, impulse);
+                }
+                break;
+            }
+        }
+    }
+} // namespace ROS2
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/string.h>
+#include <ROS2/Manipulation/JointPublisherComponent.h>
+#include <ROS2/Utilities/Controllers/PidConfiguration.h>
+#include <Utilities/PhysicsSubstepSystem.h>
+
+namespace ROS2
+{
+    //! How the command computed for a joint is applied and how the joint is measured.
+    enum class JointActuation
+    {
+        PhysXJointVelocity, //!< Velocity of a PhysX joint, measured from a joint state table.
+        LinearAnimation, //!< Local transform of the entity is moved along the joint axis.
+        LinearRigidBodyImpulse //!< Linear impulse applied to the rigid body of the entity along the effort axis.
+    };
+
+    //! Control law of a joint, its output is a velocity.
+    enum class JointController
+    {
+        FeedForward, //!< Desired velocity, with the position error corrected within a time reference.
+        Pid //!< PID controller of the position error.
+    };
+
+    //! Position controller of a single joint together with its setpoint.
+    class JointPositionController
+    {
+    public:
+        JointPositionController() = default;
+
+        //! @param pid configuration of the PID controller, used by JointController::Pid only.
+        //! @param feedForwardTimeReference time in which the feed forward controller corrects the position error, in seconds.
+        JointPositionController(JointController type, const Controllers::PidConfiguration& pid, float feedForwardTimeReference);
+
+        //! Sets the desired position, which holds until it is changed.
+        //! @param velocity desired velocity, used by the feed forward controller.
+        void SetSetpoint(float position, float velocity);
+
+        //! Holds the position measured on the next command computation.
+        void HoldPosition();
+
+        //! Computes the velocity command from a measured position.
+        float ComputeCommand(float position, AZ::u64 deltaTimeNs);
+
+        //! Desired position, or the held position.
+        float GetSetpoint() const;
+        //! Difference between the setpoint and the position given to the last command computation.
+        float GetError() const;
+
+    private:
+        JointController m_type = JointController::Pid;
+        Controllers::PidConfiguration m_pid;
+        float m_feedForwardTimeReference = 0.5f;
+        float m_setpoint = 0.0f;
+        float m_velocity = 0.0f;
+        float m_error = 0.0f;
+        bool m_hasSetpoint = false;
+    };
+
+    //! Parameters of a single joint registered with the JointControlSystem.
+    struct ControlledJointDescription
+    {
+        JointActuation m_actuation = JointActuation::PhysXJointVelocity;
+        //! PhysX joint for PhysXJointVelocity, entity of the moving body for the linear actuations.
+        AZ::EntityComponentIdPair m_jointHandle;
+        const JointStateTable* m_jointStates = nullptr; //!< PhysXJointVelocity only, registered table which has the joint.
+        size_t m_jointStateIndex = 0; //!< PhysXJointVelocity only, index of the joint in m_jointStates.
+        AZ::Vector3 m_jointAxis = AZ::Vector3::CreateAxisZ(); //!< Linear actuations only, direction of movement in parent frame.
+        AZ::Vector3 m_effortAxis = AZ::Vector3::CreateAxisZ(); //!< Linear actuations only, direction of impulse in entity frame.
+        AZ::EntityId m_measurementReferenceEntity; //!< Linear actuations only, overrides the parent used for measurement.
+        JointController m_controller = JointController::Pid;
+        Controllers::PidConfiguration m_pid; //!< Position controller of JointController::Pid, its output is a velocity.
+        float m_feedForwardTimeReference = 0.5f; //!< Error correction time of JointController::FeedForward, in seconds.
+        float m_lowerLimit = AZStd::numeric_limits<float>::lowest(); //!< Below the limit only positive commands are applied.
+        float m_upperLimit = AZStd::numeric_limits<float>::max(); //!< Above the limit only negative commands are applied.
+    };
+
+    //! Describes the PhysX joints of a joint state table for registration, all with the same type of controller.
+    //! PID configurations are matched with joints by joint name, joints without a configuration get the default one.
+    //! @param jointStates registered joint state table, descriptions refer to its joints.
+    //! @param feedForwardTimeReference used by JointController::FeedForward only, @see ControlledJointDescription.
+    //! @param pidConfigurations used by JointController::Pid only, PID configurations by joint name.
+    //! @returns descriptions in the order of the table.
+    AZStd::vector<ControlledJointDescription> DescribeControlledJoints(
+        const JointStateTable& jointStates,
+        JointController controller,
+        float feedForwardTimeReference,
+        const AZStd::unordered_map<AZStd::string, Controllers::PidConfiguration>& pidConfigurations);
+
+    //! Position control of all motorized and manipulator joints in the simulation.
+    //! Joints are stored in contiguous arrays and updated on every physics substep in three passes:
+    //! all joints are measured, then all position controllers run, then all commands are applied.
+    //! PhysX joints are measured from joint state tables, which the system reads once per substep before measuring.
+    //! Owners only register their joints and update setpoints; a setpoint holds until it is changed.
+    //! A joint without a setpoint holds the position measured on the first substep after registration or after HoldPositions.
+    class JointControlSystem : public PhysicsSubstepSystem<JointControlSystem>
+    {
+    public:
+        AZ_RTTI(JointControlSystem, "{6E1F7A56-5D0C-4E8B-9C39-1B7C3D2E4A80}");
+
+        JointControlSystem();
+        ~JointControlSystem() override = default;
+
+        //! Registers a joint. There can be only one registration per joint handle.
+        //! A PhysX joint needs its joint state table to be registered first.
+        void RegisterJoint(const ControlledJointDescription& description);
+        void UnregisterJoint(const AZ::EntityComponentIdPair& jointHandle);
+
+        //! Registers a joint state table, which is read on every physics substep, whether or not its joints are controlled.
+        void RegisterJointStates(JointStateTable* jointStates);
+        //! Unregisters a joint state table, together with all joints measured from it.
+        void UnregisterJointStates(JointStateTable* jointStates);
+
+        //! Sets the desired position of a joint.
+        //! @param position desired position in meters or radians.
+        //! @param velocity desired velocity, used by the feed forward controller.
+        void SetSetpoint(const AZ::EntityComponentIdPair& jointHandle, float position, float velocity = 0.0f);
+
+        //! Sets desired positions and velocities of many joints, e.g. a whole manipulator.
+        void SetSetpoints(
+            AZStd::span<const AZ::EntityComponentIdPair> jointHandles, AZStd::span<const float> positions, AZStd::span<const float> velocities);
+
+        //! Keeps joints still at positions measured on the next physics substep.
+        void HoldPositions(AZStd::span<const AZ::EntityComponentIdPair> jointHandles);
+
+        //! Desired position of a joint, or the held position if no setpoint was set.
+        float GetSetpoint(const AZ::EntityComponentIdPair& jointHandle) const;
+        //! Position measured on the last physics substep.
+        float GetPosition(const AZ::EntityComponentIdPair& jointHandle) const;
+        //! Difference between the setpoint and the measured position on the last physics substep.
+        float GetError(const AZ::EntityComponentIdPair& jointHandle) const;
+        //! Velocity command applied on the last physics substep.
+        float GetCommand(const AZ::EntityComponentIdPair& jointHandle) const;
+
+    private:
+        //! Geometry of linear actuations, unused for PhysX joints.
+        struct LinearJointGeometry
+        {
+            AZ::Vector3 m_jointAxis = AZ::Vector3::CreateAxisZ();
+            AZ::Vector3 m_effortAxis = AZ::Vector3::CreateAxisZ();
+            AZ::EntityId m_measurementReferenceEntity;
+        };
+
+        //! Position of a PhysX joint in a joint state table.
+        struct JointStateEntry
+        {
+            const JointStateTable* m_table = nullptr;
+            size_t m_index = 0;
+        };
+
+        void OnPhysicsSubstep(float fixedDeltaTime) override;
+        void MeasurePositions();
+        void ComputeCommands(float fixedDeltaTime);
+        void ApplyCommands(float fixedDeltaTime);
+        size_t GetIndex(const AZ::EntityComponentIdPair& jointHandle) const;
+
+        AZStd::vector<AZ::EntityComponentIdPair> m_jointHandles;
+        AZStd::vector<JointActuation> m_actuations;
+        AZStd::vector<LinearJointGeometry> m_linearGeometry;
+        AZStd::vector<JointStateEntry> m_jointStateEntries;
+        AZStd::vector<JointPositionController> m_controllers;
+        AZStd::vector<float> m_lowerLimits;
+        AZStd::vector<float> m_upperLimits;
+        AZStd::vector<float> m_positions;
+        AZStd::vector<float> m_commands;
+        AZStd::unordered_map<AZ::EntityComponentIdPair, size_t> m_indices;
+        AZStd::vector<JointStateTable*> m_jointStateTables;
+    };
+
+    using JointControlSystemInterface = AZ::Interface<JointControlSystem>;
+} // namespace ROS2
@@ -1,15 +1,35 @@
+#include "JointControlSystem.h"
 #include <ROS2/Manipulation/JointPublisherComponent.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <rclcpp/qos.hpp>
 #include <PhysX/Joint/PhysXJointRequestsBus.h>
+#include <Source/HingeJointComponent.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
 #include <ROS2/ROS2Bus.h>
 #include <ROS2/Utilities/ROS2Names.h>
 
 namespace ROS2
 {
+    void JointStateTable::Read()
+    {
+        const size_t jointCount = m_jointHandles.size();
+        for (size_t i = 0; i < jointCount; ++i)
+        {
+            if (!m_joints[i])
+            {
+                m_joints[i] = PhysX::JointRequestBus::FindFirstHandler(m_jointHandles[i]);
+                if (!m_joints[i])
+                {
+                    continue;
+                }
+            }
+            m_positions[i] = m_joints[i]->GetPosition();
+            m_velocities[i] = m_joints[i]->GetVelocity();
+        }
+    }
+
     void JointPublisherComponent::Activate()
     {
         AZ::TickBus::Handler::BusConnect();
@@ -22,9 +42,30 @@ namespace ROS2
     void JointPublisherComponent::Deactivate()
     {
         AZ::TickBus::Handler::BusDisconnect();
+        AZ::EntityBus::MultiHandler::BusDisconnect();
+        if (auto* jointControlSystem = JointControlSystemInterface::Get(); jointControlSystem && m_jointStatesRegistered)
+        {
+            jointControlSystem->UnregisterJointStates(&m_jointStates);
+        }
+        m_jointStatesRegistered = false;
+        m_jointStates = {};
+        m_jointstateMsg = sensor_msgs::msg::JointState();
+        m_initialized = false;
         m_jointstatePublisher.reset();
     }
 
+    void JointPublisherComponent::OnEntityDeactivated(const AZ::EntityId& entityId)
+    {
+        // Interfaces of the joints of a deactivated entity are looked up again once it is active
+        for (size_t i = 0; i < m_jointStates.m_jointHandles.size(); ++i)
+        {
+            if (m_jointStates.m_jointHandles[i].GetEntityId() == entityId)
+            {
+                m_jointStates.m_joints[i] = nullptr;
+            }
+        }
+    }
+
     void JointPublisherComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
     {
         provided.push_back(AZ_CRC_CE("JointPublisherService"));
@@ -71,44 +112,49 @@ namespace ROS2
             auto* hingeComponent = entity->FindComponent<PhysX::HingeJointComponent>();
             if (frameComponent && hingeComponent)
             {
-                AZ::Name jointName = frameComponent->GetJointName();
-                m_hierarchyMap[jointName] = *hingeComponent;
+                const AZ::Name jointName = frameComponent->GetJointName();
+                m_jointStates.m_jointIndices[jointName] = m_jointStates.m_jointHandles.size();
+                const AZ::EntityComponentIdPair jointHandle(descendantID, hingeComponent->GetId());
+                m_jointStates.m_jointHandles.push_back(jointHandle);
+                m_jointStates.m_jointNames.push_back(jointName);
+                m_jointStates.m_joints.push_back(PhysX::JointRequestBus::FindFirstHandler(jointHandle));
                 m_jointstateMsg.name.push_back(jointName.GetCStr());
-                m_jointstateMsg.position.push_back(0.0f);
+                AZ::EntityBus::MultiHandler::BusConnect(descendantID);
             }
         }
+
+        const size_t jointCount = m_jointStates.m_jointHandles.size();
+        m_jointStates.m_positions.resize(jointCount, 0.0f);
+        m_jointStates.m_velocities.resize(jointCount, 0.0f);
+        m_jointstateMsg.position.resize(jointCount, 0.0);
+        m_jointstateMsg.velocity.resize(jointCount, 0.0);
+        // PhysX joints do not report the applied effort, the effort array is left empty as the message allows.
+        m_jointstateMsg.header.frame_id = GetFrameID().data();
+
+        if (auto* jointControlSystem = JointControlSystemInterface::Get())
+        {
+            jointControlSystem->RegisterJointStates(&m_jointStates);
+            m_jointStatesRegistered = true;
+        }
+        m_jointStates.Read();
     }
 
-    AZStd::unordered_map<AZ::Name, PhysX::HingeJointComponent>  &JointPublisherComponent::GetHierarchyMap()
+    const JointStateTable& JointPublisherComponent::GetJointStates() const
     {
-        return m_hierarchyMap;
+        return m_jointStates;
     }
 
     void JointPublisherComponent::UpdateMessage()
     {
-        int i = 0;
-        std_msgs::msg::Header ros_header;
-        ros_header.frame_id = GetFrameID().data();
-        ros_header.stamp = ROS2::ROS2Interface::Get()->GetROSTimestamp();
-        m_jointstateMsg.header = ros_header;
-        for ([[maybe_unused]] auto& [name, hingeComponent] : m_hierarchyMap)
+        m_jointstateMsg.header.stamp = ROS2::ROS2Interface::Get()->GetROSTimestamp();
+        const size_t jointCount = m_jointStates.m_jointHandles.size();
+        for (size_t i = 0; i < jointCount; ++i)
         {
-            m_jointstateMsg.position[i] = GetJointPosition(hingeComponent);
-            m_jointstateMsg.name[i] = name.GetCStr();
-            i++;
+            m_jointstateMsg.position[i] = m_jointStates.m_positions[i];
+            m_jointstateMsg.velocity[i] = m_jointStates.m_velocities[i];
         }
     }
 
-    float JointPublisherComponent::GetJointPosition(const AZ::Component& hingeComponent) const
-    {
-        float position{0};
-        auto componentId = hingeComponent.GetId();
-        auto entityId = hingeComponent.GetEntityId();
-        const AZ::EntityComponentIdPair id(entityId,componentId);
-        PhysX::JointRequestBus::EventResult(position, id, &PhysX::JointRequests::GetPosition);
-        return position;
-    }
-
     void JointPublisherComponent::PublishMessage()
     {
         UpdateMessage();
@@ -128,6 +174,10 @@ namespace ROS2
             Initialize();
             m_initialized = true;
         }
+        else if (!m_jointStatesRegistered)
+        {
+            m_jointStates.Read();
+        }
 
         AZ_Assert(m_frequency > 0, "JointPublisher frequency must be greater than zero");
         auto frameTime = 1 / m_frequency;
@@ -145,4 +195,10 @@ namespace ROS2
         // Note that the publisher frequency can be limited by simulation tick rate (if higher frequency is desired).
         PublishMessage();
     }
+
+    int JointPublisherComponent::GetTickOrder()
+    {
+        // Read joint states right after physics, before components which consume them
+        return AZ::ComponentTickBus::TICK_PHYSICS + 1;
+    }
 } // namespace ROS2
@@ -1,11 +1,12 @@
+#include "CompiledJointTrajectory.h"
 #include "FollowJointTrajectoryActionServer.h"
+#include "JointControlSystem.h"
 #include <ROS2/Manipulation/ManipulatorControllerComponent.h>
 #include <ROS2/Manipulation/JointPublisherComponent.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/std/functional.h>
-#include <PhysX/Joint/PhysXJointRequestsBus.h>
 #include <Source/HingeJointComponent.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
 
@@ -13,6 +14,31 @@ namespace ROS2
 {
     // ManipulatorControllerComponent class
     using FollowJointTrajectory = control_msgs::action::FollowJointTrajectory;
+
+    namespace Internal
+    {
+        //! Time horizon in which the feed forward controller corrects the position error.
+        const rclcpp::Duration FeedForwardTimeReference = rclcpp::Duration::from_nanoseconds(5e8);
+
+        //! Version 0 stored PID configurations in a vector, which was matched with joints by position in a joint list.
+        //! The order of that list is not known, so the configurations cannot be assigned to joints and are dropped.
+        bool ConvertManipulatorControllerVersion(
+            [[maybe_unused]] AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
+        {
+            if (classElement.GetVersion() < 1)
+            {
+                const AZ::Crc32 pidVectorName = AZ_CRC_CE("PID Configuration Vector");
+                const int pidVectorIndex = classElement.FindElement(pidVectorName);
+                AZ_Warning(
+                    "ManipulatorControllerComponent",
+                    pidVectorIndex < 0 || classElement.GetSubElement(pidVectorIndex).GetNumSubElements() == 0,
+                    "PID configurations without joint names are dropped, configure them again for each joint");
+                classElement.RemoveElementByName(pidVectorName);
+            }
+            return true;
+        }
+    } // namespace Internal
+
     ManipulatorControllerComponent::ManipulatorControllerComponent() = default;
     ManipulatorControllerComponent::~ManipulatorControllerComponent() = default;
 
@@ -20,17 +46,18 @@ namespace ROS2
     {
         AZ::TickBus::Handler::BusConnect();
         m_actionServerClass = AZStd::make_unique<FollowJointTrajectoryActionServer>();
+        m_compiledTrajectory = AZStd::make_unique<CompiledJointTrajectory>();
         m_actionServerClass->CreateServer(m_ROS2ControllerName);
-        InitializePid();        
+        m_jointPublisherComponent = GetEntity()->FindComponent<JointPublisherComponent>();
     }
 
     void ManipulatorControllerComponent::Deactivate()
     {
         AZ::TickBus::Handler::BusDisconnect();
+        UnregisterJoints();
         m_actionServerClass->m_actionServer.reset();
     }
 
-
     void ManipulatorControllerComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
     {
         required.push_back(AZ_CRC_CE("JointPublisherService"));
@@ -42,10 +69,10 @@ namespace ROS2
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serialize->Class<ManipulatorControllerComponent, AZ::Component>()
-                ->Version(0)
+                ->Version(1, &Internal::ConvertManipulatorControllerVersion)
                 ->Field("ROS2 Controller name", &ManipulatorControllerComponent::m_ROS2ControllerName)
                 ->Field("Controller type", &ManipulatorControllerComponent::m_controllerType)
-                ->Field("PID Configuration Vector", &ManipulatorControllerComponent::m_pidConfigurationVector);
+                ->Field("PID Configurations", &ManipulatorControllerComponent::m_pidConfigurations);
 
             if (AZ::EditContext* ec = serialize->GetEditContext())
             {
@@ -67,201 +94,155 @@ namespace ROS2
                     ->EnumAttribute(ManipulatorControllerComponent::Controller::PID, "PID")
                     ->DataElement(
                         AZ::Edit::UIHandlers::Default, 
-                        &ManipulatorControllerComponent::m_pidConfigurationVector,
+                        &ManipulatorControllerComponent::m_pidConfigurations,
                         "PIDs Configuration", 
-                        "PID controllers configuration (for all the joints)");
+                        "PID controllers configuration, by joint name");
             }
         }
     }
 
-    void ManipulatorControllerComponent::InitializePid()
+    void ManipulatorControllerComponent::RegisterJoints()
     {
-        for (auto& pid : m_pidConfigurationVector)
+        auto* jointControlSystem = JointControlSystemInterface::Get();
+        AZ_Assert(jointControlSystem, "No joint control system");
+        const auto descriptions = DescribeControlledJoints(
+            m_jointPublisherComponent->GetJointStates(),
+            m_controllerType == Controller::FeedForward ? JointController::FeedForward : JointController::Pid,
+            aznumeric_cast<float>(Internal::FeedForwardTimeReference.seconds()),
+            m_pidConfigurations);
+        for (const ControlledJointDescription& description : descriptions)
         {
-            pid.InitializePid();
+            jointControlSystem->RegisterJoint(description);
+            m_registeredJoints.push_back(description.m_jointHandle);
         }
     }
 
-    void ManipulatorControllerComponent::InitializeCurrentPosition()
+    void ManipulatorControllerComponent::UnregisterJoints()
     {
-        auto* jointPublisherComponent = GetEntity()->FindComponent<JointPublisherComponent>();
-        if (jointPublisherComponent)
+        if (auto* jointControlSystem = JointControlSystemInterface::Get())
         {
-            for (auto & [jointName , hingeComponent] : jointPublisherComponent->GetHierarchyMap())
+            for (const auto& jointHandle : m_registeredJoints)
             {
-                m_jointKeepStillPosition[jointName] = GetJointPosition(hingeComponent);
+                jointControlSystem->UnregisterJoint(jointHandle);
             }
         }
+        m_registeredJoints.clear();
     }
 
-    float ManipulatorControllerComponent::GetJointPosition(const AZ::Component& hingeComponent)
+    bool ManipulatorControllerComponent::CompileTrajectory()
     {
-        float position{0};
-        auto componentId = hingeComponent.GetId();
-        auto entityId = hingeComponent.GetEntityId();
-        const AZ::EntityComponentIdPair id(entityId,componentId);
-        PhysX::JointRequestBus::EventResult(position, id, &PhysX::JointRequests::GetPosition);
-        return position;
-    }
+        const auto goal = m_actionServerClass->m_goalHandle->get_goal();
+        if (!m_jointPublisherComponent)
+        {
+            m_actionServerClass->AbortGoal(FollowJointTrajectory::Result::INVALID_JOINTS, "No joint publisher on the manipulator");
+            return false;
+        }
 
-    float ManipulatorControllerComponent::ComputeFFJointVelocity(const float currentPosition, const float desiredPosition, const rclcpp::Duration & duration) const
-    {
-        // FeedForward (dummy) method
-        float desiredVelocity = (desiredPosition - currentPosition) / duration.seconds();
-        return desiredVelocity;
-    }
+        const auto outcome = m_compiledTrajectory->Compile(goal->trajectory, m_jointPublisherComponent->GetJointStates());
+        if (!outcome.IsSuccess())
+        {
+            AZ_Warning("ManipulatorControllerComponent", false, "Rejecting trajectory: %s", outcome.GetError().c_str());
+            m_actionServerClass->AbortGoal(FollowJointTrajectory::Result::INVALID_GOAL, outcome.GetError());
+            return false;
+        }
 
-    float ManipulatorControllerComponent::ComputePIDJointVelocity(const float currentPosition, const float desiredPosition, const uint64_t & deltaTimeNs, int & jointIndex)
-    {
-        // PID method
-        float error = desiredPosition - currentPosition;
-        float command = m_pidConfigurationVector.at(jointIndex).ComputeCommand(error, deltaTimeNs);
-        return command;
-    }
+        const size_t jointCount = m_compiledTrajectory->GetJointCount();
+        const JointStateTable& jointStates = m_jointPublisherComponent->GetJointStates();
+        m_trajectoryJointHandles.clear();
+        for (const size_t stateIndex : m_compiledTrajectory->GetJointStateIndices())
+        {
+            m_trajectoryJointHandles.push_back(jointStates.m_jointHandles[stateIndex]);
+        }
 
-    void ManipulatorControllerComponent::SetJointVelocity(AZ::Component& hingeComponent, const float desiredVelocity)
-    {
-        auto componentId = hingeComponent.GetId();
-        auto entityId = hingeComponent.GetEntityId();
-        const AZ::EntityComponentIdPair id(entityId,componentId);
-        PhysX::JointRequestBus::Event(id, &PhysX::JointRequests::SetVelocity, desiredVelocity);
+        m_feedback = std::make_shared<FollowJointTrajectory::Feedback>();
+        m_feedback->joint_names = goal->trajectory.joint_names;
+        for (auto* point : { &m_feedback->desired, &m_feedback->actual, &m_feedback->error })
+        {
+            point->positions.resize(jointCount, 0.0);
+            point->velocities.resize(jointCount, 0.0);
+        }
+        return true;
     }
 
-    void ManipulatorControllerComponent::KeepStillPosition([[maybe_unused]] const uint64_t deltaTimeNs)
+    void ManipulatorControllerComponent::ExecuteTrajectory()
     {
-        if (!m_keepStillPositionInitialize)
+        const rclcpp::Time timeNow = rclcpp::Time(ROS2::ROS2Interface::Get()->GetROSTimestamp()); // current simulation time
+        const rclcpp::Duration timeFromStart = timeNow - m_timeStartingExecutionTraj;
+        const double time = timeFromStart.seconds();
+        m_compiledTrajectory->Sample(time, m_desiredPositions, m_desiredVelocities);
+        JointControlSystemInterface::Get()->SetSetpoints(m_trajectoryJointHandles, m_desiredPositions, m_desiredVelocities);
+
+        const JointStateTable& jointStates = m_jointPublisherComponent->GetJointStates();
+        const auto& jointStateIndices = m_compiledTrajectory->GetJointStateIndices();
+        const int jointCount = aznumeric_cast<int>(jointStateIndices.size());
+        for (int jointIndex = 0; jointIndex < jointCount; jointIndex++)
         {
-            InitializeCurrentPosition();
-            m_keepStillPositionInitialize = true;
+            const size_t stateIndex = jointStateIndices[jointIndex];
+            const float currentPosition = jointStates.m_positions[stateIndex];
+            const float desiredPosition = m_desiredPositions[jointIndex];
+            m_feedback->desired.positions[jointIndex] = desiredPosition;
+            m_feedback->desired.velocities[jointIndex] = m_desiredVelocities[jointIndex];
+            m_feedback->actual.positions[jointIndex] = currentPosition;
+            m_feedback->actual.velocities[jointIndex] = jointStates.m_velocities[stateIndex];
+            m_feedback->error.positions[jointIndex] = desiredPosition - currentPosition;
+            m_feedback->error.velocities[jointIndex] = m_desiredVelocities[jointIndex] - jointStates.m_velocities[stateIndex];
         }
-        
-        int jointIndex = 0;
-        for (auto & [jointName , desiredPosition] : m_jointKeepStillPosition)
-        {
-            float currentPosition;
-
-            auto* jointPublisherComponent = GetEntity()->FindComponent<JointPublisherComponent>();
-            if (jointPublisherComponent)
-            {
-                currentPosition = GetJointPosition(jointPublisherComponent->GetHierarchyMap()[jointName]);
-                float desiredVelocity;
-                if (m_controllerType == Controller::FeedForward)
-                {
-                    desiredVelocity = ComputeFFJointVelocity(
-                            currentPosition, 
-                            desiredPosition, 
-                            rclcpp::Duration::from_nanoseconds(5e8)); // Dummy forward time reference 
-                }
-                else if(m_controllerType == Controller::PID)
-                {
-                    desiredVelocity = ComputePIDJointVelocity(
-                            currentPosition, 
-                            desiredPosition, 
-                            deltaTimeNs,
-                            jointIndex);
-                }
-                else
-                {
-                    desiredVelocity = 0.0f;
-                }
-                                
-                SetJointVelocity(jointPublisherComponent->GetHierarchyMap()[jointName], desiredVelocity);
 
-                jointIndex++;
-            }
-        }
-    }
+        m_feedback->header.stamp = timeNow;
+        m_feedback->desired.time_from_start = timeFromStart;
+        m_feedback->actual.time_from_start = timeFromStart;
+        m_feedback->error.time_from_start = timeFromStart;
+        m_actionServerClass->PublishFeedback(m_feedback);
 
-    void ManipulatorControllerComponent::ExecuteTrajectory([[maybe_unused]] const uint64_t deltaTimeNs)
-    {
         // If the trajectory is thoroughly executed set the status to Concluded
-        if (m_trajectory.points.size() == 0)
+        if (time >= m_compiledTrajectory->GetDuration())
         {
             m_initializedTrajectory = false;
             m_actionServerClass->m_goalStatus = GoalStatus::Concluded;
             AZ_TracePrintf("ManipulatorControllerComponent", "Goal Concluded: all points reached");
-            return;
         }
+    }
 
-        auto desiredGoal = m_trajectory.points.front();
-
-        rclcpp::Duration timeFromStart = rclcpp::Duration(desiredGoal.time_from_start); // arrival time of the current desired trajectory point
-        rclcpp::Duration threshold = rclcpp::Duration::from_nanoseconds(1e7);
-        rclcpp::Time timeNow = rclcpp::Time(ROS2::ROS2Interface::Get()->GetROSTimestamp()); // current simulation time
-
-        // Jump to the next point if current simulation time is ahead of timeFromStart
-        if(m_timeStartingExecutionTraj + timeFromStart  <= timeNow + threshold)
+    void ManipulatorControllerComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (!m_jointPublisherComponent)
         {
-            m_trajectory.points.erase(m_trajectory.points.begin());
-            ExecuteTrajectory(deltaTimeNs);
             return;
         }
 
-        int jointIndex = 0;
-        for (auto & jointName : m_trajectory.joint_names)
+        if (m_registeredJoints.empty())
         {
-            auto* jointPublisherComponent = GetEntity()->FindComponent<JointPublisherComponent>();
-            if (jointPublisherComponent)
+            // The joint state table is filled by the joint publisher on its first tick
+            if (m_jointPublisherComponent->GetJointStates().m_jointHandles.empty())
             {
-                float currentPosition = GetJointPosition(jointPublisherComponent->GetHierarchyMap()[AZ::Name(jointName.c_str())]);
-                float desiredPosition = desiredGoal.positions[jointIndex];
-                float desiredVelocity;
-                if (m_controllerType == Controller::FeedForward)
-                {
-                    desiredVelocity = ComputeFFJointVelocity(
-                            currentPosition, 
-                            desiredPosition, 
-                            m_timeStartingExecutionTraj + timeFromStart - timeNow);
-                }
-                else if (m_controllerType == Controller::PID)
-                {
-                    desiredVelocity = ComputePIDJointVelocity(
-                            currentPosition, 
-                            desiredPosition, 
-                            deltaTimeNs,
-                            jointIndex);
-                }
-                else
-                {
-                    desiredVelocity = 0.0f;
-                }
-                
-                SetJointVelocity(jointPublisherComponent->GetHierarchyMap()[AZ::Name(jointName.c_str())], desiredVelocity);
-
-                jointIndex++;
+                return;
             }
+            RegisterJoints();
         }
 
-        
-    }
-
-    void ManipulatorControllerComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
-    {
-        const uint64_t deltaTimeNs = deltaTime * 1'000'000'000;
-
         if (m_actionServerClass->m_goalStatus == GoalStatus::Active)
         {
             if (!m_initializedTrajectory)
             {
-                m_trajectory = m_actionServerClass->m_goalHandle->get_goal()->trajectory;
+                if (!CompileTrajectory())
+                {
+                    return;
+                }
                 m_timeStartingExecutionTraj = rclcpp::Time(ROS2::ROS2Interface::Get()->GetROSTimestamp());
                 m_initializedTrajectory = true;
             }
 
-            ExecuteTrajectory(deltaTimeNs);
+            ExecuteTrajectory();
 
             if (m_actionServerClass->m_goalStatus == GoalStatus::Concluded)
             {
                 m_actionServerClass->m_goalStatus = GoalStatus::Pending;
                 auto result = std::make_shared<FollowJointTrajectory::Result>();
                 m_actionServerClass->m_goalHandle->succeed(result);
-                m_keepStillPositionInitialize = false;
+                // Between goals the arm is kept still where it stopped
+                JointControlSystemInterface::Get()->HoldPositions(m_registeredJoints);
             }
         }
-        else
-        {
-            KeepStillPosition(deltaTimeNs);
-        }
     }
 
 } // namespace ROS2
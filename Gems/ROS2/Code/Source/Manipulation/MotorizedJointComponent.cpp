@@ -6,23 +6,47 @@
  *
  */
 
+#include "JointControlSystem.h"
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Serialization/EditContext.h>
-#include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
-#include <AzFramework/Physics/RigidBodyBus.h>
 #include <ROS2/Manipulation/MotorizedJointComponent.h>
 
 namespace ROS2
 {
     void MotorizedJointComponent::Activate()
     {
-        AZ::TickBus::Handler::BusConnect();
-        m_pidPos.InitializePid();
         if (m_debugDrawEntity.IsValid())
         {
             AZ::TransformBus::EventResult(m_debugDrawEntityInitialTransform, this->GetEntityId(), &AZ::TransformBus::Events::GetLocalTM);
         }
+
+        auto* jointControlSystem = JointControlSystemInterface::Get();
+        AZ_Assert(jointControlSystem, "No joint control system");
+        if (!m_linear)
+        {
+            AZ_Error("MotorizedJointComponent", false, "Rotational motorized joints are not implemented");
+        }
+        else if (jointControlSystem)
+        {
+            ControlledJointDescription description;
+            description.m_actuation = m_animationMode ? JointActuation::LinearAnimation : JointActuation::LinearRigidBodyImpulse;
+            description.m_jointHandle = GetJointHandle();
+            description.m_jointAxis = m_jointDir;
+            description.m_effortAxis = m_effortAxis;
+            description.m_measurementReferenceEntity = m_measurementReferenceEntity;
+            description.m_pid = m_pidPos;
+            description.m_lowerLimit = m_limits.first;
+            description.m_upperLimit = m_limits.second;
+            jointControlSystem->RegisterJoint(description);
+            jointControlSystem->SetSetpoint(GetJointHandle(), m_setpoint + m_zeroOffset);
+            m_registered = true;
+        }
+
+        if (m_testSinusoidal || m_debugDrawEntity.IsValid() || m_debugPrint)
+        {
+            AZ::TickBus::Handler::BusConnect();
+        }
         MotorizedJointRequestBus::Handler::BusConnect(m_entity->GetId());
     }
 
@@ -30,6 +54,16 @@ namespace ROS2
     {
         AZ::TickBus::Handler::BusDisconnect();
         MotorizedJointRequestBus::Handler::BusDisconnect();
+        if (auto* jointControlSystem = JointControlSystemInterface::Get(); m_registered && jointControlSystem)
+        {
+            jointControlSystem->UnregisterJoint(GetJointHandle());
+        }
+        m_registered = false;
+    }
+
+    AZ::EntityComponentIdPair MotorizedJointComponent::GetJointHandle() const
+    {
+        return AZ::EntityComponentIdPair(GetEntityId(), GetId());
     }
 
     void MotorizedJointComponent::Reflect(AZ::ReflectContext* context)
@@ -124,13 +158,10 @@ namespace ROS2
     }
     void MotorizedJointComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        const float measurement = ComputeMeasurement(time);
         if (m_testSinusoidal)
         {
-            m_setpoint = m_sinDC + m_sinAmplitude * AZ::Sin(m_sinFreq * time.GetSeconds());
+            SetSetpoint(m_sinDC + m_sinAmplitude * AZ::Sin(m_sinFreq * time.GetSeconds()));
         }
-        const float control_position_error = (m_setpoint + m_zeroOffset) - measurement;
-        m_error = control_position_error;
 
         if (m_debugDrawEntity.IsValid())
         {
@@ -147,112 +178,27 @@ namespace ROS2
             }
         }
 
-        const uint64_t deltaTimeNs = deltaTime * 1'000'000'000;
-        float speed_control = m_pidPos.ComputeCommand(control_position_error, deltaTimeNs);
-
-        if (measurement <= m_limits.first)
-        {
-            // allow only positive control
-            speed_control = AZStd::max(0.f, speed_control);
-        }
-        else if (measurement >= m_limits.second)
-        {
-            // allow only negative control
-            speed_control = AZStd::min(0.f, speed_control);
-        }
-
-        if (m_debugPrint)
+        if (m_debugPrint && m_registered)
         {
+            const auto* jointControlSystem = JointControlSystemInterface::Get();
             AZ_Printf(
                 "MotorizedJointComponent",
                 " %s | pos: %f | err: %f | cntrl : %f | set : %f |\n",
                 GetEntity()->GetName().c_str(),
-                measurement,
-                control_position_error,
-                speed_control,
+                jointControlSystem->GetPosition(GetJointHandle()),
+                jointControlSystem->GetError(GetJointHandle()),
+                jointControlSystem->GetCommand(GetJointHandle()),
                 m_setpoint);
         }
-        SetVelocity(speed_control, deltaTime);
-    }
-
-    float MotorizedJointComponent::ComputeMeasurement(AZ::ScriptTimePoint time)
-    {
-        AZ::Transform transform;
-        if (!m_measurementReferenceEntity.IsValid())
-        {
-            AZ::TransformBus::EventResult(transform, this->GetEntityId(), &AZ::TransformBus::Events::GetLocalTM);
-        }
-        else
-        {
-            AZ::Transform transformStepParent;
-            AZ::TransformBus::EventResult(transformStepParent, m_measurementReferenceEntity, &AZ::TransformBus::Events::GetWorldTM);
-            AZ::Transform transformStepChild;
-            AZ::TransformBus::EventResult(transformStepChild, GetEntityId(), &AZ::TransformBus::Events::GetWorldTM);
-            transform = transformStepParent.GetInverse() * transformStepChild;
-        }
-        if (m_linear)
-        {
-            const float last_position = m_currentPosition;
-            m_currentPosition = transform.GetTranslation().Dot(this->m_jointDir);
-            if (m_lastMeasurementTime > 0)
-            {
-                double delta_time = time.GetSeconds() - m_lastMeasurementTime;
-                m_currentVelocity = (m_currentPosition - last_position) / delta_time;
-            }
-            m_lastMeasurementTime = time.GetSeconds();
-            return m_currentPosition;
-        }
-        AZ_Assert(false, "Measurement computation for rotation is not implemented");
-        return 0;
-    }
-
-    void MotorizedJointComponent::SetVelocity(float velocity, float deltaTime)
-    {
-        if (m_animationMode)
-        {
-            ApplyLinVelAnimation(velocity, deltaTime);
-        }
-        else
-        {
-            deltaTime = AZStd::min(deltaTime, 0.1f); // this affects applied force. Need to prevent value that is too large.
-            if (m_linear)
-            {
-                ApplyLinVelRigidBodyImpulse(velocity, deltaTime);
-            }
-        }
-    }
-
-    void MotorizedJointComponent::ApplyLinVelAnimation(float velocity, float deltaTime)
-    {
-        AZ::Transform transform;
-        AZ::TransformBus::EventResult(transform, this->GetEntityId(), &AZ::TransformBus::Events::GetLocalTM);
-        transform.SetTranslation(transform.GetTranslation() + velocity * m_jointDir * deltaTime);
-        AZ::TransformBus::Event(this->GetEntityId(), &AZ::TransformBus::Events::SetLocalTM, transform);
-    }
-
-    void MotorizedJointComponent::ApplyLinVelRigidBodyImpulse(float velocity, float deltaTime)
-    {
-        AZ::Quaternion transform;
-        AZ::TransformBus::EventResult(transform, this->GetEntityId(), &AZ::TransformBus::Events::GetWorldRotationQuaternion);
-        auto force_impulse = transform.TransformVector(m_effortAxis * velocity);
-        Physics::RigidBodyRequestBus::Event(
-            this->GetEntityId(), &Physics::RigidBodyRequests::ApplyLinearImpulse, force_impulse * deltaTime);
-    }
-
-    void MotorizedJointComponent::ApplyLinVelRigidBody(float velocity, float deltaTime)
-    {
-        AZ::Quaternion transform;
-        AZ::TransformBus::EventResult(transform, this->GetEntityId(), &AZ::TransformBus::Events::GetWorldRotationQuaternion);
-        AZ::Vector3 currentVelocity;
-        auto transformed_velocity_increment = transform.TransformVector(m_effortAxis * velocity);
-        Physics::RigidBodyRequestBus::EventResult(currentVelocity, this->GetEntityId(), &Physics::RigidBodyRequests::GetLinearVelocity);
-        AZ::Vector3 new_velocity = currentVelocity + transformed_velocity_increment;
-        Physics::RigidBodyRequestBus::Event(this->GetEntityId(), &Physics::RigidBodyRequests::SetLinearVelocity, new_velocity);
     }
 
     void MotorizedJointComponent::SetSetpoint(float setpoint)
     {
         m_setpoint = setpoint;
+        if (m_registered)
+        {
+            JointControlSystemInterface::Get()->SetSetpoint(GetJointHandle(), m_setpoint + m_zeroOffset);
+        }
     }
 
     float MotorizedJointComponent::GetSetpoint()
@@ -262,12 +208,12 @@ namespace ROS2
 
     float MotorizedJointComponent::GetError()
     {
-        return m_error;
+        return m_registered ? JointControlSystemInterface::Get()->GetError(GetJointHandle()) : 0.0f;
     }
 
     float MotorizedJointComponent::GetCurrentMeasurement()
     {
-        return m_currentPosition - m_zeroOffset;
+        return m_registered ? JointControlSystemInterface::Get()->GetPosition(GetJointHandle()) - m_zeroOffset : 0.0f;
     }
 
 } // namespace ROS2
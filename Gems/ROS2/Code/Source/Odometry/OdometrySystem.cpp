@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "OdometrySystem.h"
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
+#include <ROS2/ROS2Bus.h>
+#include <ROS2/Utilities/ROS2Conversions.h>
+
+namespace ROS2
+{
+    namespace Internal
+    {
+        // Diagonal indices of the 6x6 row-major covariance matrices in nav_msgs::msg::Odometry
+        constexpr size_t CovarianceLinearDiagonal[] = { 0, 7, 14 };
+        constexpr size_t CovarianceAngularDiagonal[] = { 21, 28, 35 };
+    } // namespace Internal
+
+    OdometrySystem::OdometrySystem()
+        : PhysicsSubstepSystem(PhysicsSubstepEvent::SimulationFinish)
+    {
+    }
+
+    void OdometrySystem::RegisterSensor(AZ::EntityId entityId, const OdometrySensorDescription& description)
+    {
+        AZ_Assert(description.m_rigidBody, "Odometry sensor requires a rigid body");
+        if (m_indices.contains(entityId))
+        {
+            AZ_Error("OdometrySystem", false, "Entity %s already has an odometry sensor registered", entityId.ToString().c_str());
+            return;
+        }
+
+        SensorState state;
+        state.m_rigidBody = description.m_rigidBody;
+        state.m_odometry.m_position = description.m_initialPosition;
+        state.m_odometry.m_orientation = description.m_initialOrientation;
+        state.m_linearDriftNoiseStdDev = description.m_linearDriftNoiseStdDev;
+        state.m_angularDriftNoiseStdDev = description.m_angularDriftNoiseStdDev;
+        state.m_publishingPeriod = description.m_publishingFrequency > 0.0f ? 1.0f / description.m_publishingFrequency : 0.0f;
+
+        nav_msgs::msg::Odometry message;
+        message.header.frame_id = description.m_frameId.c_str();
+        message.child_frame_id = description.m_childFrameId.c_str();
+
+        m_indices[entityId] = m_states.size();
+        m_entityIds.push_back(entityId);
+        m_states.push_back(state);
+        m_publishers.push_back(description.m_publisher);
+        m_messages.push_back(AZStd::move(message));
+
+        ConnectToPhysicsScene();
+    }
+
+    void OdometrySystem::UnregisterSensor(AZ::EntityId entityId)
+    {
+        auto it = m_indices.find(entityId);
+        if (it == m_indices.end())
+        {
+            return;
+        }
+
+        // Swap with the last sensor to keep the storage contiguous
+        const size_t index = it->second;
+        m_indices.erase(it);
+        SwapRemove(m_entityIds, index);
+        SwapRemove(m_states, index);
+        SwapRemove(m_publishers, index);
+        SwapRemove(m_messages, index);
+        if (index < m_entityIds.size())
+        {
+            m_indices[m_entityIds[index]] = index;
+        }
+    }
+
+    void OdometrySystem::OnPhysicsSubstep(float fixedDeltaTime)
+    {
+        if (m_states.empty())
+        {
+            return;
+        }
+
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        bool timestampAcquired = false;
+        builtin_interfaces::msg::Time timestamp;
+
+        for (size_t i = 0; i < m_states.size(); ++i)
+        {
+            SensorState& state = m_states[i];
+
+            AZ::Vector3 linearNoise = AZ::Vector3::CreateZero();
+            AZ::Vector3 angularNoise = AZ::Vector3::CreateZero();
+            if (state.m_linearDriftNoiseStdDev > 0.0f)
+            {
+                linearNoise = state.m_linearDriftNoiseStdDev *
+                    AZ::Vector3(normal(m_randomEngine), normal(m_randomEngine), normal(m_randomEngine));
+                const float positionDrift = state.m_linearDriftNoiseStdDev * fixedDeltaTime;
+                state.m_positionVariance += positionDrift * positionDrift;
+            }
+            if (state.m_angularDriftNoiseStdDev > 0.0f)
+            {
+                angularNoise = state.m_angularDriftNoiseStdDev *
+                    AZ::Vector3(normal(m_randomEngine), normal(m_randomEngine), normal(m_randomEngine));
+                const float orientationDrift = state.m_angularDriftNoiseStdDev * fixedDeltaTime;
+                state.m_orientationVariance += orientationDrift * orientationDrift;
+            }
+
+            Integrate(
+                state.m_odometry,
+                state.m_rigidBody->GetOrientation(),
+                state.m_rigidBody->GetLinearVelocity(),
+                state.m_rigidBody->GetAngularVelocity(),
+                linearNoise,
+                angularNoise,
+                fixedDeltaTime);
+
+            state.m_timeSinceLastPublish += fixedDeltaTime;
+            if (state.m_timeSinceLastPublish < state.m_publishingPeriod)
+            {
+                continue;
+            }
+            state.m_timeSinceLastPublish = 0.0f;
+
+            if (!timestampAcquired)
+            {
+                timestamp = ROS2Interface::Get()->GetROSTimestamp();
+                timestampAcquired = true;
+            }
+            nav_msgs::msg::Odometry& message = m_messages[i];
+            message.header.stamp = timestamp;
+            FillMessage(state, message);
+            m_publishers[i]->publish(message);
+        }
+    }
+
+    void OdometrySystem::Integrate(
+        Odometry& odometry,
+        const AZ::Quaternion& bodyOrientation,
+        const AZ::Vector3& linearVelocity,
+        const AZ::Vector3& angularVelocity,
+        const AZ::Vector3& linearNoise,
+        const AZ::Vector3& angularNoise,
+        float deltaTime)
+    {
+        const AZ::Quaternion bodyOrientationInverse = bodyOrientation.GetConjugate();
+        odometry.m_linearVelocity = bodyOrientationInverse.TransformVector(linearVelocity) + linearNoise;
+        odometry.m_angularVelocity = bodyOrientationInverse.TransformVector(angularVelocity) + angularNoise;
+        odometry.m_position += odometry.m_orientation.TransformVector(odometry.m_linearVelocity * deltaTime);
+        odometry.m_orientation =
+            (odometry.m_orientation * AZ::Quaternion::CreateFromScaledAxisAngle(odometry.m_angularVelocity * deltaTime)).GetNormalized();
+    }
+
+    void OdometrySystem::FillMessage(const SensorState& state, nav_msgs::msg::Odometry& message) const
+    {
+        const Odometry& odometry = state.m_odometry;
+        message.pose.pose.position = ROS2Conversions::ToROS2Point(odometry.m_position);
+        message.pose.pose.orientation = ROS2Conversions::ToROS2Quaternion(odometry.m_orientation);
+        message.twist.twist.linear = ROS2Conversions::ToROS2Vector3(odometry.m_linearVelocity);
+        message.twist.twist.angular = ROS2Conversions::ToROS2Vector3(odometry.m_angularVelocity);
+
+        const double linearVelocityVariance = state.m_linearDriftNoiseStdDev * state.m_linearDriftNoiseStdDev;
+        const double angularVelocityVariance = state.m_angularDriftNoiseStdDev * state.m_angularDriftNoiseStdDev;
+        for (const size_t index : Internal::CovarianceLinearDiagonal)
+        {
+            message.pose.covariance[index] = state.m_positionVariance;
+            message.twist.covariance[index] = linearVelocityVariance;
+        }
+        for (const size_t index : Internal::CovarianceAngularDiagonal)
+        {
+            message.pose.covariance[index] = state.m_orientationVariance;
+            message.twist.covariance[index] = angularVelocityVariance;
+        }
+    }
+} // namespace ROS2
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <nav_msgs/msg/odometry.hpp>
+#include <Utilities/PhysicsSubstepSystem.h>
+#include <random>
+#include <rclcpp/publisher.hpp>
+
+namespace AzPhysics
+{
+    class RigidBody;
+}
+
+namespace ROS2
+{
+    //! Parameters of a single odometry sensor registered with the OdometrySystem.
+    struct OdometrySensorDescription
+    {
+        AzPhysics::RigidBody* m_rigidBody = nullptr; //!< Body which velocities are integrated.
+        AZ::Vector3 m_initialPosition = AZ::Vector3::CreateZero(); //!< Starting pose in the odometry frame.
+        AZ::Quaternion m_initialOrientation = AZ::Quaternion::CreateIdentity();
+        float m_publishingFrequency = 10.0f; //!< Publishing frequency in Hz, measured in simulation time.
+        float m_linearDriftNoiseStdDev = 0.0f; //!< Standard deviation of noise added to linear velocity [m/s].
+        float m_angularDriftNoiseStdDev = 0.0f; //!< Standard deviation of noise added to angular velocity [rad/s].
+        std::shared_ptr<rclcpp::Publisher<nav_msgs::msg::Odometry>> m_publisher;
+        AZStd::string m_frameId; //!< Odometry frame (header frame id).
+        AZStd::string m_childFrameId; //!< Frame of the robot (child frame id).
+    };
+
+    //! Integrates and publishes odometry of all registered sensors.
+    //! Integration runs on every physics substep with the fixed physics delta, so the result does not depend on frame rate.
+    //! All sensors are updated in a single pass over contiguous storage, and the ones due are published in the same pass.
+    class OdometrySystem : public PhysicsSubstepSystem<OdometrySystem>
+    {
+    public:
+        AZ_RTTI(OdometrySystem, "{0F1C8F0D-3A5B-4E8C-9E43-4A8E6C47B2D1}");
+
+        OdometrySystem();
+        ~OdometrySystem() override = default;
+
+        //! Registers an odometry sensor. There can be only one sensor per entity.
+        void RegisterSensor(AZ::EntityId entityId, const OdometrySensorDescription& description);
+        void UnregisterSensor(AZ::EntityId entityId);
+
+        //! Pose and twist of a robot, integrated from velocities of its body.
+        struct Odometry
+        {
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero(); //!< Position in the odometry frame.
+            AZ::Quaternion m_orientation = AZ::Quaternion::CreateIdentity(); //!< Orientation in the odometry frame.
+            AZ::Vector3 m_linearVelocity = AZ::Vector3::CreateZero(); //!< Last measured velocity, in the robot frame.
+            AZ::Vector3 m_angularVelocity = AZ::Vector3::CreateZero(); //!< Last measured velocity, in the robot frame.
+        };
+
+        //! Advances odometry by a single step, as done for every sensor on each physics substep.
+        //! @param bodyOrientation orientation of the body in the world frame.
+        //! @param linearVelocity linear velocity of the body in the world frame.
+        //! @param angularVelocity angular velocity of the body in the world frame.
+        //! @param linearNoise drift noise added to the linear velocity in the robot frame.
+        //! @param angularNoise drift noise added to the angular velocity in the robot frame.
+        //! @param deltaTime duration of the step in seconds.
+        static void Integrate(
+            Odometry& odometry,
+            const AZ::Quaternion& bodyOrientation,
+            const AZ::Vector3& linearVelocity,
+            const AZ::Vector3& angularVelocity,
+            const AZ::Vector3& linearNoise,
+            const AZ::Vector3& angularNoise,
+            float deltaTime);
+
+    private:
+        //! Integration state of a single sensor, stored contiguously.
+        struct SensorState
+        {
+            AzPhysics::RigidBody* m_rigidBody = nullptr;
+            Odometry m_odometry;
+            float m_positionVariance = 0.0f; //!< Accumulated drift of position.
+            float m_orientationVariance = 0.0f; //!< Accumulated drift of orientation.
+            float m_linearDriftNoiseStdDev = 0.0f;
+            float m_angularDriftNoiseStdDev = 0.0f;
+            float m_publishingPeriod = 0.1f;
+            float m_timeSinceLastPublish = 0.0f;
+        };
+
+        void OnPhysicsSubstep(float fixedDeltaTime) override;
+        void FillMessage(const SensorState& state, nav_msgs::msg::Odometry& message) const;
+
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<SensorState> m_states;
+        AZStd::vector<std::shared_ptr<rclcpp::Publisher<nav_msgs::msg::Odometry>>> m_publishers;
+        AZStd::vector<nav_msgs::msg::Odometry> m_messages;
+        AZStd::unordered_map<AZ::EntityId, size_t> m_indices;
+
+        std::mt19937 m_randomEngine;
+    };
+
+    using OdometrySystemInterface = AZ::Interface<OdometrySystem>;
+} // namespace ROS2
@@ -7,6 +7,7 @@
  */
 
 #include "ROS2OdometrySensorComponent.h"
+#include "OdometrySystem.h"
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzFramework/Physics/RigidBodyBus.h>
@@ -26,14 +27,29 @@ namespace ROS2
     {
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
         {
-            serialize->Class<ROS2OdometrySensorComponent, ROS2SensorComponent>()->Version(1);
+            serialize->Class<ROS2OdometrySensorComponent, ROS2SensorComponent>()
+                ->Version(2)
+                ->Field("LinearDriftNoiseStdDev", &ROS2OdometrySensorComponent::m_linearDriftNoiseStdDev)
+                ->Field("AngularDriftNoiseStdDev", &ROS2OdometrySensorComponent::m_angularDriftNoiseStdDev);
 
             if (AZ::EditContext* ec = serialize->GetEditContext())
             {
                 ec->Class<ROS2OdometrySensorComponent>("ROS2 Odometry Sensor", "Odometry sensor component")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                     ->Attribute(AZ::Edit::Attributes::Category, "ROS2")
-                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"));
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ROS2OdometrySensorComponent::m_linearDriftNoiseStdDev,
+                        "Linear drift noise",
+                        "Standard deviation of noise added to the integrated linear velocity [m/s]")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ROS2OdometrySensorComponent::m_angularDriftNoiseStdDev,
+                        "Angular drift noise",
+                        "Standard deviation of noise added to the integrated angular velocity [rad/s]")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f);
             }
         }
     }
@@ -48,30 +64,6 @@ namespace ROS2
         m_sensorConfiguration.m_publishersConfigurations.insert(AZStd::make_pair(type, tc));
     }
 
-    void ROS2OdometrySensorComponent::FrequencyTick()
-    {
-        auto* ros2Frame = Utils::GetGameOrEditorComponent<ROS2FrameComponent>(GetEntity());
-        AZ_Assert(ros2Frame, "ROS2Frame must be present for ROS2OdometrySensorComponent");
-        auto transform = ros2Frame->GetFrameTransform();
-
-        AZ::Vector3 linearVelocity;
-        Physics::RigidBodyRequestBus::EventResult(linearVelocity, m_entity->GetId(), &Physics::RigidBodyRequests::GetLinearVelocity);
-
-        linearVelocity = transform.GetInverse().TransformVector(linearVelocity);
-        AZ::Vector3 angularVelocity;
-        Physics::RigidBodyRequestBus::EventResult(angularVelocity, m_entity->GetId(), &Physics::RigidBodyRequests::GetAngularVelocity);
-        angularVelocity = transform.GetInverse().TransformVector(angularVelocity);
-        m_odometryMsg.twist.twist.linear = ROS2Conversions::ToROS2Vector3(linearVelocity);
-        m_odometryMsg.twist.twist.angular = ROS2Conversions::ToROS2Vector3(angularVelocity);
-
-        auto translation = transform.GetTranslation();
-        m_odometryMsg.pose.pose.position.x = translation.GetX();
-        m_odometryMsg.pose.pose.position.y = translation.GetY();
-        m_odometryMsg.pose.pose.position.z = translation.GetZ();
-
-        m_odometryPublisher->publish(m_odometryMsg);
-    }
-
     void ROS2OdometrySensorComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
     {
         required.push_back(AZ_CRC_CE("PhysicsRigidBodyService"));
@@ -80,22 +72,54 @@ namespace ROS2
 
     void ROS2OdometrySensorComponent::Activate()
     {
-        // "odom" is globally fixed frame for all robots, no matter the namespace
-        m_odometryMsg.header.frame_id = ROS2Names::GetNamespacedName(GetNamespace(), "odom").c_str();
-        m_odometryMsg.child_frame_id = GetFrameID().c_str();
+        // Integration and publishing are done for all odometry sensors at once by the OdometrySystem,
+        // so this component does not tick on its own.
+        if (!m_sensorConfiguration.m_publishingEnabled)
+        {
+            return;
+        }
 
-        ROS2SensorComponent::Activate();
         auto ros2Node = ROS2Interface::Get()->GetNode();
         AZ_Assert(m_sensorConfiguration.m_publishersConfigurations.size() == 1, "Invalid configuration of publishers for Odometry sensor");
 
         const auto publisherConfig = m_sensorConfiguration.m_publishersConfigurations[Internal::kOdometryMsgType];
         const auto fullTopic = ROS2Names::GetNamespacedName(GetNamespace(), publisherConfig.m_topic);
-        m_odometryPublisher = ros2Node->create_publisher<nav_msgs::msg::Odometry>(fullTopic.data(), publisherConfig.GetQoS());
+
+        auto* ros2Frame = Utils::GetGameOrEditorComponent<ROS2FrameComponent>(GetEntity());
+        AZ_Assert(ros2Frame, "ROS2Frame must be present for ROS2OdometrySensorComponent");
+        const AZ::Transform initialPose = ros2Frame->GetFrameTransform();
+
+        AzPhysics::RigidBody* rigidBody = nullptr;
+        Physics::RigidBodyRequestBus::EventResult(rigidBody, GetEntityId(), &Physics::RigidBodyRequests::GetRigidBody);
+        if (!rigidBody)
+        {
+            AZ_Error(
+                "ROS2OdometrySensorComponent", false, "Odometry sensor requires a rigid body on entity %s", GetEntity()->GetName().c_str());
+            return;
+        }
+
+        OdometrySensorDescription description;
+        description.m_rigidBody = rigidBody;
+        description.m_initialPosition = initialPose.GetTranslation();
+        description.m_initialOrientation = initialPose.GetRotation();
+        description.m_publishingFrequency = m_sensorConfiguration.m_frequency;
+        description.m_linearDriftNoiseStdDev = m_linearDriftNoiseStdDev;
+        description.m_angularDriftNoiseStdDev = m_angularDriftNoiseStdDev;
+        description.m_publisher = ros2Node->create_publisher<nav_msgs::msg::Odometry>(fullTopic.data(), publisherConfig.GetQoS());
+        // "odom" is globally fixed frame for all robots, no matter the namespace
+        description.m_frameId = ROS2Names::GetNamespacedName(GetNamespace(), "odom");
+        description.m_childFrameId = GetFrameID();
+
+        auto* odometrySystem = OdometrySystemInterface::Get();
+        AZ_Assert(odometrySystem, "Odometry system is not available");
+        odometrySystem->RegisterSensor(GetEntityId(), description);
     }
 
     void ROS2OdometrySensorComponent::Deactivate()
     {
-        ROS2SensorComponent::Deactivate();
-        m_odometryPublisher.reset();
+        if (auto* odometrySystem = OdometrySystemInterface::Get())
+        {
+            odometrySystem->UnregisterSensor(GetEntityId());
+        }
     }
 } // namespace ROS2
@@ -10,14 +10,14 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <ROS2/Sensor/ROS2SensorComponent.h>
-#include <nav_msgs/msg/odometry.hpp>
-#include <rclcpp/publisher.hpp>
 
 namespace ROS2
 {
     //! Odometry sensor Component.
     //! It constructs and publishes an odometry message, which contains information about vehicle velocity and position in space.
-    //! This is a ground truth "sensor", which can be helpful for development and machine learning.
+    //! Pose is integrated from the rigid body velocities on every physics substep, optionally with drift noise.
+    //! With no noise configured, this is a ground truth "sensor", which can be helpful for development and machine learning.
+    //! Sensors of all robots are integrated and published in a single pass by the OdometrySystem.
     //! @see <a href="https://index.ros.org/p/nav_msgs/"> nav_msgs package. </a>
     class ROS2OdometrySensorComponent : public ROS2SensorComponent
     {
@@ -34,12 +34,7 @@ namespace ROS2
         //////////////////////////////////////////////////////////////////////////
 
     private:
-        //////////////////////////////////////////////////////////////////////////
-        // ROS2SensorComponent overrides
-        void FrequencyTick() override;
-        //////////////////////////////////////////////////////////////////////////
-
-        std::shared_ptr<rclcpp::Publisher<nav_msgs::msg::Odometry>> m_odometryPublisher;
-        nav_msgs::msg::Odometry m_odometryMsg;
+        float m_linearDriftNoiseStdDev = 0.0f;
+        float m_angularDriftNoiseStdDev = 0.0f;
     };
 } // namespace ROS2
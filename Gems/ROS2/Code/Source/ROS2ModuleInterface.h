@@ -21,6 +21,7 @@
 #include <ROS2/Manipulation/ManipulatorControllerComponent.h>
 #include <ROS2/Manipulation/MotorizedJointComponent.h>
 #include <RobotControl/Controllers/AckermannController/AckermannControlComponent.h>
+#include <RobotControl/Controllers/MecanumController/MecanumControlComponent.h>
 #include <RobotControl/Controllers/RigidBodyController/RigidBodyTwistControlComponent.h>
 #include <RobotControl/Controllers/SkidSteeringController/SkidSteeringControlComponent.h>
 #include <RobotControl/ROS2RobotControlComponent.h>
@@ -28,6 +29,7 @@
 #include <Spawner/ROS2SpawnPointComponent.h>
 #include <Spawner/ROS2SpawnerComponent.h>
 #include <VehicleDynamics/ModelComponents/AckermannModelComponent.h>
+#include <VehicleDynamics/ModelComponents/MecanumModelComponent.h>
 #include <VehicleDynamics/ModelComponents/SkidSteeringModelComponent.h>
 #include <VehicleDynamics/VehicleModelComponent.h>
 
@@ -61,6 +63,7 @@ namespace ROS2
                   ROS2RobotControlComponent::CreateDescriptor(),
                   ROS2CameraSensorComponent::CreateDescriptor(),
                   AckermannControlComponent::CreateDescriptor(),
+                  MecanumControlComponent::CreateDescriptor(),
                   RigidBodyTwistControlComponent::CreateDescriptor(),
                   SkidSteeringControlComponent::CreateDescriptor(),
                   ROS2SpawnerComponent::CreateDescriptor(),
@@ -68,6 +71,7 @@ namespace ROS2
                   VehicleDynamics::AckermannVehicleModelComponent::CreateDescriptor(),
                   VehicleDynamics::WheelControllerComponent::CreateDescriptor(),
                   VehicleDynamics::SkidSteeringModelComponent::CreateDescriptor(),
+                  VehicleDynamics::MecanumModelComponent::CreateDescriptor(),
                   MotorizedJointComponent::CreateDescriptor(),
                   JointPublisherComponent::CreateDescriptor(),
                   ManipulatorControllerComponent::CreateDescriptor() });
@@ -106,10 +106,16 @@ namespace ROS2
 
         ROS2RequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
+        m_odometrySystem.Activate();
+        m_jointControlSystem.Activate();
+        m_vehicleDynamicsSystem.Activate();
     }
 
     void ROS2SystemComponent::Deactivate()
     {
+        m_vehicleDynamicsSystem.Deactivate();
+        m_jointControlSystem.Deactivate();
+        m_odometrySystem.Deactivate();
         AZ::TickBus::Handler::BusDisconnect();
         ROS2RequestBus::Handler::BusDisconnect();
         m_loadTemplatesHandler.Disconnect();
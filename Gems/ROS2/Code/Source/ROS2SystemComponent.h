@@ -12,8 +12,11 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <Lidar/LidarSystem.h>
+#include <Manipulation/JointControlSystem.h>
+#include <Odometry/OdometrySystem.h>
 #include <ROS2/Clock/SimulationClock.h>
 #include <ROS2/ROS2Bus.h>
+#include <VehicleDynamics/VehicleDynamicsSystem.h>
 #include <builtin_interfaces/msg/time.hpp>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
@@ -67,6 +70,9 @@ namespace ROS2
         AZStd::unique_ptr<tf2_ros::TransformBroadcaster> m_dynamicTFBroadcaster;
         AZStd::unique_ptr<tf2_ros::StaticTransformBroadcaster> m_staticTFBroadcaster;
         SimulationClock m_simulationClock;
+        OdometrySystem m_odometrySystem;
+        JointControlSystem m_jointControlSystem;
+        VehicleDynamics::VehicleDynamicsSystem m_vehicleDynamicsSystem;
         //! Load the pass templates of the ROS2 gem.
         void LoadPassTemplateMappings();
         AZ::RPI::PassSystemInterface::OnReadyLoadTemplatesEvent::Handler m_loadTemplatesHandler;
@@ -7,12 +7,36 @@
  */
 
 #include "AckermannSubscriptionHandler.h"
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <ROS2/RobotControl/Ackermann/AckermannBus.h>
 #include <ROS2/RobotControl/Ackermann/AckermannCommandStruct.h>
+#include <VehicleDynamics/VehicleDynamicsSystem.h>
 
 namespace ROS2
 {
-    void AckermannSubscriptionHandler::SendToBus(const ackermann_msgs::msg::AckermannDrive& message)
+    void AckermannSubscriptionHandler::OnActivate(const AZ::Entity* entity)
+    {
+        if (auto* vehicleDynamicsSystem = VehicleDynamics::VehicleDynamicsSystemInterface::Get())
+        {
+            m_commands = vehicleDynamicsSystem->AcquireCommandMailbox(entity);
+        }
+        if (!m_commands)
+        { // Without a vehicle, the mailbox only passes commands to the main thread
+            m_commands = AZStd::make_shared<VehicleDynamics::VehicleCommandMailbox>();
+        }
+
+        // Commands written before activation are not notified again
+        AckermannCommandStruct acs;
+        m_commands->ReadAckermann(acs, m_notifiedCommands);
+    }
+
+    void AckermannSubscriptionHandler::OnDeactivate()
+    {
+        m_commands.reset();
+        m_notifiedCommands = 0;
+    }
+
+    void AckermannSubscriptionHandler::StoreCommand(const ackermann_msgs::msg::AckermannDrive& message)
     {
         AckermannCommandStruct acs;
         acs.m_acceleration = message.acceleration;
@@ -20,6 +44,15 @@ namespace ROS2
         acs.m_speed = message.speed;
         acs.m_steeringAngle = message.steering_angle;
         acs.m_steeringAngleVelocity = message.steering_angle_velocity;
-        AckermannNotificationBus::Event(GetEntityId(), &AckermannNotifications::AckermannReceived, acs);
+        m_commands->WriteAckermann(acs);
+    }
+
+    void AckermannSubscriptionHandler::NotifyReceivedCommands()
+    {
+        AckermannCommandStruct acs;
+        if (m_commands && m_commands->ReadAckermann(acs, m_notifiedCommands))
+        {
+            AckermannNotificationBus::Event(GetEntityId(), &AckermannNotifications::AckermannReceived, acs);
+        }
     }
 } // namespace ROS2
@@ -7,14 +7,26 @@
  */
 #pragma once
 
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <ROS2/RobotControl/ControlSubscriptionHandler.h>
+#include <VehicleDynamics/VehicleCommandMailbox.h>
 #include <ackermann_msgs/msg/ackermann_drive.hpp>
 
 namespace ROS2
 {
+    //! Writes Ackermann commands to the command mailbox of the entity, read by its vehicle on the physics substep.
+    //! AckermannNotificationBus is notified of new commands on the main thread.
     class AckermannSubscriptionHandler : public ControlSubscriptionHandler<ackermann_msgs::msg::AckermannDrive>
     {
+    public:
+        void NotifyReceivedCommands() override;
+
     private:
-        void SendToBus(const ackermann_msgs::msg::AckermannDrive& message) override;
+        void OnActivate(const AZ::Entity* entity) override;
+        void OnDeactivate() override;
+        void StoreCommand(const ackermann_msgs::msg::AckermannDrive& message) override;
+
+        AZStd::shared_ptr<VehicleDynamics::VehicleCommandMailbox> m_commands;
+        AZ::u32 m_notifiedCommands = 0;
     };
 } // namespace ROS2
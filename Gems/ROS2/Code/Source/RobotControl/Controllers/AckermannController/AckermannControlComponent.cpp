@@ -10,7 +10,6 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzFramework/Physics/RigidBodyBus.h>
-#include <ROS2/VehicleDynamics/VehicleInputControlBus.h>
 
 namespace ROS2
 {
@@ -31,11 +30,10 @@ namespace ROS2
 
     void AckermannControlComponent::Activate()
     {
-        AckermannNotificationBus::Handler::BusConnect(GetEntityId());
     }
+
     void AckermannControlComponent::Deactivate()
     {
-        AckermannNotificationBus::Handler::BusDisconnect();
     }
 
     void AckermannControlComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
@@ -43,13 +41,4 @@ namespace ROS2
         required.push_back(AZ_CRC_CE("ROS2RobotControl"));
         required.push_back(AZ_CRC_CE("AckermannModelService"));
     }
-
-    void AckermannControlComponent::AckermannReceived(const AckermannCommandStruct& acs)
-    {
-        // Notify input system for vehicle dynamics. Only speed and steering is currently supported.
-        VehicleDynamics::VehicleInputControlRequestBus::Event(
-            GetEntityId(), &VehicleDynamics::VehicleInputControlRequests::SetTargetLinearSpeed, acs.m_speed);
-        VehicleDynamics::VehicleInputControlRequestBus::Event(
-            GetEntityId(), &VehicleDynamics::VehicleInputControlRequests::SetTargetSteering, acs.m_steeringAngle);
-    }
 } // namespace ROS2
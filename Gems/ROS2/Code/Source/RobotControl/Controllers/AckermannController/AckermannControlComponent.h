@@ -8,14 +8,13 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <ROS2/RobotControl/Ackermann/AckermannBus.h>
 
 namespace ROS2
 {
-    //! A simple component which translates ackermann commands to vehicle dynamics inputs
-    class AckermannControlComponent
-        : public AZ::Component
-        , private AckermannNotificationBus::Handler
+    //! A simple component which marks an Ackermann vehicle as controlled by ROS 2 Ackermann commands.
+    //! The robot control subscription writes commands to the command mailbox of the entity, which the vehicle dynamics system
+    //! delivers to the vehicle inputs on every physics substep. AckermannNotificationBus is notified on the main thread.
+    class AckermannControlComponent : public AZ::Component
     {
     public:
         AZ_COMPONENT(AckermannControlComponent, "{16EC2F18-F579-414C-8B3B-DB47078729BC}", AZ::Component);
@@ -28,11 +27,5 @@ namespace ROS2
         //////////////////////////////////////////////////////////////////////////
         static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
         static void Reflect(AZ::ReflectContext* context);
-
-    private:
-        //////////////////////////////////////////////////////////////////////////
-        // AckermannNotificationBus::Handler overrides
-        void AckermannReceived(const AckermannCommandStruct& angular) override;
-        //////////////////////////////////////////////////////////////////////////
     };
 } // namespace ROS2
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+namespace ROS2
+{
+    //! Component which marks a mecanum vehicle model as controlled by ROS 2 twist commands, including sideways speed.
+    //! The robot control subscription writes twist commands to the command mailbox of the entity, which the vehicle dynamics
+    //! system delivers to the vehicle inputs on every physics substep. TwistNotificationBus is notified on the main thread.
+    class MecanumControlComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(MecanumControlComponent, "{469597FF-EE30-475E-96B5-B9DD360355AA}", AZ::Component);
+        MecanumControlComponent() = default;
+
+        // Component overrides
+        void Activate() override;
+        void Deactivate() override;
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void Reflect(AZ::ReflectContext* context);
+    };
+} // namespace ROS2
@@ -13,7 +13,6 @@
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <PhysX/Joint/PhysXJointRequestsBus.h>
-#include <ROS2/VehicleDynamics/VehicleInputControlBus.h>
 #include <VehicleDynamics/WheelControllerComponent.h>
 
 namespace ROS2
@@ -35,12 +34,10 @@ namespace ROS2
 
     void SkidSteeringControlComponent::Activate()
     {
-        TwistNotificationBus::Handler::BusConnect(GetEntityId());
     }
 
     void SkidSteeringControlComponent::Deactivate()
     {
-        TwistNotificationBus::Handler::BusDisconnect();
     }
 
     void SkidSteeringControlComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
@@ -48,13 +45,4 @@ namespace ROS2
         required.push_back(AZ_CRC_CE("ROS2RobotControl"));
         required.push_back(AZ_CRC_CE("SkidSteeringModelService"));
     }
-
-    void SkidSteeringControlComponent::TwistReceived(const AZ::Vector3& linear, const AZ::Vector3& angular)
-    {
-        // Notify input system for vehicle dynamics. Only speed and steering is currently supported.
-        VehicleDynamics::VehicleInputControlRequestBus::Event(
-            GetEntityId(), &VehicleDynamics::VehicleInputControlRequests::SetTargetLinearSpeedV3, linear);
-        VehicleDynamics::VehicleInputControlRequestBus::Event(
-            GetEntityId(), &VehicleDynamics::VehicleInputControlRequests::SetTargetAngularSpeedV3, angular);
-    }
 } // namespace ROS2
@@ -9,7 +9,6 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <ROS2/RobotControl/Twist/TwistBus.h>
 #include <VehicleDynamics/AxleConfiguration.h>
 #include <VehicleDynamics/Utilities.h>
 
@@ -17,9 +16,9 @@ namespace ROS2
 {
 
     //! Component that contains skid steering model.
-    class SkidSteeringControlComponent
-        : public AZ::Component
-        , private TwistNotificationBus::Handler
+    //! The robot control subscription writes twist commands to the command mailbox of the entity, which the vehicle dynamics
+    //! system delivers to the vehicle inputs on every physics substep. TwistNotificationBus is notified on the main thread.
+    class SkidSteeringControlComponent : public AZ::Component
     {
     public:
         AZ_COMPONENT(SkidSteeringControlComponent, "{7FEE7851-1284-4AE5-9C2C-763916BFE641}", AZ::Component);
@@ -31,9 +30,5 @@ namespace ROS2
 
         static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
         static void Reflect(AZ::ReflectContext* context);
-
-    private:
-        // TwistNotificationBus::Handler overrides
-        void TwistReceived(const AZ::Vector3& linear, const AZ::Vector3& angular) override;
     };
 } // namespace ROS2
@@ -36,11 +36,13 @@ namespace ROS2
         if (m_subscriptionHandler)
         {
             m_subscriptionHandler->Activate(GetEntity(), m_subscriberConfiguration);
+            AZ::TickBus::Handler::BusConnect();
         }
     }
 
     void ROS2RobotControlComponent::Deactivate()
     {
+        AZ::TickBus::Handler::BusDisconnect();
         if (m_subscriptionHandler)
         {
             m_subscriptionHandler->Deactivate();
@@ -48,6 +50,11 @@ namespace ROS2
         }
     }
 
+    void ROS2RobotControlComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_subscriptionHandler->NotifyReceivedCommands();
+    }
+
     void ROS2RobotControlComponent::Reflect(AZ::ReflectContext* context)
     {
         ControlConfiguration::Reflect(context);
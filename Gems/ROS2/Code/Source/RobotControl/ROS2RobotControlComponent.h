@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <ROS2/Communication/TopicConfiguration.h>
 #include <ROS2/RobotControl/ControlConfiguration.h>
@@ -18,7 +19,10 @@ namespace ROS2
     //! A Component responsible for controlling a robot movement.
     //! Uses IRobotControl implementation depending on type of ROS2 control message.
     //! Depends on ROS2FrameComponent. Can be configured through ControlConfiguration.
-    class ROS2RobotControlComponent : public AZ::Component
+    //! Control buses are notified of received commands on tick.
+    class ROS2RobotControlComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(ROS2RobotControlComponent, "{CBFB0764-99F9-40EE-9FEE-F5F5A66E59D2}", AZ::Component);
@@ -48,6 +52,11 @@ namespace ROS2
         static void Reflect(AZ::ReflectContext* context);
 
     private:
+        //////////////////////////////////////////////////////////////////////////
+        // AZ::TickBus::Handler overrides
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        //////////////////////////////////////////////////////////////////////////
+
         AZStd::unique_ptr<IControlSubscriptionHandler> m_subscriptionHandler;
         ControlConfiguration m_controlConfiguration;
         TopicConfiguration m_subscriberConfiguration;
@@ -7,15 +7,46 @@
  */
 
 #include "TwistSubscriptionHandler.h"
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <ROS2/RobotControl/Twist/TwistBus.h>
 #include <ROS2/Utilities/ROS2Conversions.h>
+#include <VehicleDynamics/VehicleDynamicsSystem.h>
 
 namespace ROS2
 {
-    void TwistSubscriptionHandler::SendToBus(const geometry_msgs::msg::Twist& message)
+    void TwistSubscriptionHandler::OnActivate(const AZ::Entity* entity)
     {
-        const AZ::Vector3 linearVelocity = ROS2Conversions::FromROS2Vector3(message.linear);
-        const AZ::Vector3 angularVelocity = ROS2Conversions::FromROS2Vector3(message.angular);
-        TwistNotificationBus::Event(GetEntityId(), &TwistNotifications::TwistReceived, linearVelocity, angularVelocity);
+        if (auto* vehicleDynamicsSystem = VehicleDynamics::VehicleDynamicsSystemInterface::Get())
+        {
+            m_commands = vehicleDynamicsSystem->AcquireCommandMailbox(entity);
+        }
+        if (!m_commands)
+        { // Without a vehicle, the mailbox only passes commands to the main thread
+            m_commands = AZStd::make_shared<VehicleDynamics::VehicleCommandMailbox>();
+        }
+
+        // Commands written before activation are not notified again
+        AZ::Vector3 linear, angular;
+        m_commands->ReadTwist(linear, angular, m_notifiedCommands);
+    }
+
+    void TwistSubscriptionHandler::OnDeactivate()
+    {
+        m_commands.reset();
+        m_notifiedCommands = 0;
+    }
+
+    void TwistSubscriptionHandler::StoreCommand(const geometry_msgs::msg::Twist& message)
+    {
+        m_commands->WriteTwist(ROS2Conversions::FromROS2Vector3(message.linear), ROS2Conversions::FromROS2Vector3(message.angular));
+    }
+
+    void TwistSubscriptionHandler::NotifyReceivedCommands()
+    {
+        AZ::Vector3 linearVelocity, angularVelocity;
+        if (m_commands && m_commands->ReadTwist(linearVelocity, angularVelocity, m_notifiedCommands))
+        {
+            TwistNotificationBus::Event(GetEntityId(), &TwistNotifications::TwistReceived, linearVelocity, angularVelocity);
+        }
     }
 } // namespace ROS2
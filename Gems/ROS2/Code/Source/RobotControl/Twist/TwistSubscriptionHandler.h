@@ -7,14 +7,26 @@
  */
 #pragma once
 
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <ROS2/RobotControl/ControlSubscriptionHandler.h>
+#include <VehicleDynamics/VehicleCommandMailbox.h>
 #include <geometry_msgs/msg/twist.hpp>
 
 namespace ROS2
 {
+    //! Writes twist commands to the command mailbox of the entity, read by its vehicle on the physics substep.
+    //! TwistNotificationBus is notified of new commands on the main thread.
     class TwistSubscriptionHandler : public ControlSubscriptionHandler<geometry_msgs::msg::Twist>
     {
+    public:
+        void NotifyReceivedCommands() override;
+
     private:
-        void SendToBus(const geometry_msgs::msg::Twist& message) override;
+        void OnActivate(const AZ::Entity* entity) override;
+        void OnDeactivate() override;
+        void StoreCommand(const geometry_msgs::msg::Twist& message) override;
+
+        AZStd::shared_ptr<VehicleDynamics::VehicleCommandMailbox> m_commands;
+        AZ::u32 m_notifiedCommands = 0;
     };
 } // namespace ROS2
@@ -27,7 +27,7 @@ namespace ROS2
         m_table->setShowGrid(true);
         m_table->setSelectionMode(QAbstractItemView::SingleSelection);
         m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
-        m_table->setHorizontalHeaderLabels({ tr("URDF mesh path"), tr("CRC"), tr("Type"), tr("Asset source") });
+        m_table->setHorizontalHeaderLabels({ tr("URDF mesh path"), tr("Hash"), tr("Type"), tr("Asset source") });
         m_table->horizontalHeader()->setStretchLastSection(true);
         this->setLayout(layout);
     }
@@ -50,7 +50,7 @@ namespace ROS2
     };
 
     void CheckAssetPage::ReportAsset(
-        const QString& urdfPath, const QString& type, const QString& assetSourcePath, const AZ::Crc32& crc32, const QString& tooltip)
+        const QString& urdfPath, const QString& type, const QString& assetSourcePath, AZ::u64 fileHash, const QString& tooltip)
     {
         int i = m_table->rowCount();
         m_table->setRowCount(i + 1);
@@ -61,11 +61,11 @@ namespace ROS2
             m_missingCount++;
         }
         SetTitle();
-        AZStd::string crcStr = AZStd::to_string(crc32);
+        const AZStd::string hashStr = AZStd::string::format("%016llx", static_cast<unsigned long long>(fileHash));
         QTableWidgetItem* p = createCell(isOk, urdfPath);
         p->setToolTip(tr("Resolved to : ") + tooltip);
         m_table->setItem(i, 0, p);
-        m_table->setItem(i, 1, createCell(isOk, QString::fromUtf8(crcStr.data(), crcStr.size())));
+        m_table->setItem(i, 1, createCell(isOk, QString::fromUtf8(hashStr.data(), hashStr.size())));
         m_table->setItem(i, 2, createCell(isOk, type));
         m_table->setItem(i, 3, createCell(isOk, assetSourcePath));
     }
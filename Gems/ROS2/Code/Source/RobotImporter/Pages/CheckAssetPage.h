@@ -9,7 +9,7 @@
 #pragma once
 
 #if !defined(Q_MOC_RUN)
-#include <AzCore/Math/Crc.h>
+#include <AzCore/base.h>
 #include <AzCore/std/string/string.h>
 #include <QLabel>
 #include <QString>
@@ -26,7 +26,7 @@ namespace ROS2
     public:
         explicit CheckAssetPage(QWizard* parent);
         void ReportAsset(
-            const QString& urdfPath, const QString& type, const QString& assetSourcePath, const AZ::Crc32& crc32, const QString& tooltip);
+            const QString& urdfPath, const QString& type, const QString& assetSourcePath, AZ::u64 fileHash, const QString& tooltip);
         void ClearAssetsList();
 
         bool isComplete() const override;
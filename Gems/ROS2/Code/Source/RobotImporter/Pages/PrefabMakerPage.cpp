@@ -19,6 +19,20 @@ namespace ROS2
     {
         m_prefabName = new QLineEdit(this);
         m_createButton = new QPushButton(tr("Create Prefab"), this);
+        m_colliderMode = new QComboBox(this);
+        m_colliderMode->addItem(tr("Triangle mesh"), static_cast<int>(MeshColliderMode::TriangleMesh));
+        m_colliderMode->addItem(tr("Convex hull"), static_cast<int>(MeshColliderMode::ConvexHull));
+        m_colliderMode->addItem(tr("Convex decomposition"), static_cast<int>(MeshColliderMode::ConvexDecomposition));
+        m_colliderMode->setCurrentIndex(m_colliderMode->findData(static_cast<int>(ColliderMeshSettings{}.m_mode)));
+        m_colliderMode->setToolTip(tr("How mesh colliders are cooked. Convex shapes are much cheaper in simulation and in ray casts."));
+        m_maxConvexHulls = new QSpinBox(this);
+        m_maxConvexHulls->setRange(1, 256);
+        m_maxConvexHulls->setValue(ColliderMeshSettings{}.m_maxConvexHulls);
+        m_maxConvexHulls->setPrefix(tr("Max hulls: "));
+        m_maxConvexHulls->setToolTip(tr("Largest number of convex hulls of each mesh in a convex decomposition"));
+        m_mergeFixedJoints = new QCheckBox(tr("Merge links attached by fixed joints"), this);
+        m_mergeFixedJoints->setToolTip(
+            tr("Links attached by fixed joints become frames of their parent rigid body, which makes simulation of the robot faster"));
         m_log = new QTextEdit(this);
         setTitle(tr("Prefab creation"));
         QVBoxLayout* layout = new QVBoxLayout;
@@ -26,9 +40,21 @@ namespace ROS2
         layoutInner->addWidget(m_prefabName);
         layoutInner->addWidget(m_createButton);
         layout->addLayout(layoutInner);
+        QHBoxLayout* layoutColliders = new QHBoxLayout;
+        layoutColliders->addWidget(new QLabel(tr("Mesh colliders:"), this));
+        layoutColliders->addWidget(m_colliderMode);
+        layoutColliders->addWidget(m_maxConvexHulls);
+        layout->addLayout(layoutColliders);
+        layout->addWidget(m_mergeFixedJoints);
         layout->addWidget(m_log);
         setLayout(layout);
         connect(m_createButton, &QPushButton::pressed, this, &PrefabMakerPage::onCreateButtonPressed);
+        auto updateMaxConvexHulls = [this]()
+        {
+            m_maxConvexHulls->setEnabled(getColliderMeshSettings().m_mode == MeshColliderMode::ConvexDecomposition);
+        };
+        connect(m_colliderMode, QOverload<int>::of(&QComboBox::currentIndexChanged), this, updateMaxConvexHulls);
+        updateMaxConvexHulls();
     }
 
     void PrefabMakerPage::setProposedPrefabName(const AZStd::string prefabName)
@@ -41,6 +67,19 @@ namespace ROS2
         return AZStd::string(m_prefabName->text().toUtf8().constData());
     }
 
+    ColliderMeshSettings PrefabMakerPage::getColliderMeshSettings() const
+    {
+        ColliderMeshSettings settings;
+        settings.m_mode = static_cast<MeshColliderMode>(m_colliderMode->currentData().toInt());
+        settings.m_maxConvexHulls = aznumeric_cast<AZ::u32>(m_maxConvexHulls->value());
+        return settings;
+    }
+
+    bool PrefabMakerPage::getMergeFixedJoints() const
+    {
+        return m_mergeFixedJoints->isChecked();
+    }
+
     void PrefabMakerPage::reportProgress(const AZStd::string& progressForUser)
     {
         m_log->setText(QString::fromUtf8(progressForUser.data(), int(progressForUser.size())));
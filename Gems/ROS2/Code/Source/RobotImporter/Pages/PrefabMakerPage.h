@@ -11,12 +11,16 @@
 #if !defined(Q_MOC_RUN)
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/string/string.h>
+#include <QCheckBox>
+#include <QComboBox>
 #include <QLabel>
 #include <QLineEdit>
 #include <QPushButton>
+#include <QSpinBox>
 #include <QString>
 #include <QTextEdit>
 #include <QWizardPage>
+#include <RobotImporter/URDF/CollidersMaker.h>
 #endif
 
 namespace ROS2
@@ -29,6 +33,8 @@ namespace ROS2
         explicit PrefabMakerPage(RobotImporterWidget* parent);
         void setProposedPrefabName(const AZStd::string prefabName);
         AZStd::string getPrefabName() const;
+        ColliderMeshSettings getColliderMeshSettings() const;
+        bool getMergeFixedJoints() const;
         void reportProgress(const AZStd::string& progressForUser);
         void setSuccess(bool success);
         bool isComplete() const override;
@@ -39,6 +45,9 @@ namespace ROS2
         bool m_success;
         QLineEdit* m_prefabName;
         QPushButton* m_createButton;
+        QComboBox* m_colliderMode;
+        QSpinBox* m_maxConvexHulls;
+        QCheckBox* m_mergeFixedJoints;
         QTextEdit* m_log;
         RobotImporterWidget* m_parentImporterWidget;
     };
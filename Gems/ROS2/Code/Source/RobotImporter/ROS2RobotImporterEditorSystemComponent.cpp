@@ -8,6 +8,7 @@
 
 #include "ROS2RobotImporterEditorSystemComponent.h"
 #include "RobotImporterWidget.h"
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzToolsFramework/API/ViewPaneOptions.h>
 #if !defined(Q_MOC_RUN)
@@ -16,6 +17,49 @@
 
 namespace ROS2
 {
+    namespace Internal
+    {
+        //! Parses a value of the --colliders option: triangle, convex or decomposition, the latter optionally with the hull budget
+        //! as decomposition:<hulls>.
+        bool ParseColliderMeshSettings(AZStd::string_view value, ColliderMeshSettings& settings)
+        {
+            constexpr AZStd::string_view Decomposition = "decomposition";
+            if (value == "triangle")
+            {
+                settings.m_mode = MeshColliderMode::TriangleMesh;
+                return true;
+            }
+            if (value == "convex")
+            {
+                settings.m_mode = MeshColliderMode::ConvexHull;
+                return true;
+            }
+            if (!value.starts_with(Decomposition))
+            {
+                return false;
+            }
+            settings.m_mode = MeshColliderMode::ConvexDecomposition;
+            value.remove_prefix(Decomposition.size());
+            if (value.empty())
+            {
+                return true;
+            }
+            if (value.front() != ':')
+            {
+                return false;
+            }
+            const AZStd::string hulls(value.substr(1));
+            char* end = nullptr;
+            const unsigned long maxConvexHulls = strtoul(hulls.c_str(), &end, 10);
+            if (hulls.empty() || *end != '\0' || maxConvexHulls == 0)
+            {
+                return false;
+            }
+            settings.m_maxConvexHulls = aznumeric_cast<AZ::u32>(maxConvexHulls);
+            return true;
+        }
+    } // namespace Internal
+
     void ROS2RobotImporterEditorSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -39,15 +83,95 @@ namespace ROS2
     void ROS2RobotImporterEditorSystemComponent::Activate()
     {
         ROS2RobotImporterSystemComponent::Activate();
+        m_sourceAssetsIndex.Activate("@user@/ROS2/SourceAssetsIndex.txt");
+        m_colliderManifestCache.Activate("@user@/ROS2/ColliderManifests.txt");
         AzToolsFramework::EditorEvents::Bus::Handler::BusConnect();
     }
 
     void ROS2RobotImporterEditorSystemComponent::Deactivate()
     {
         AzToolsFramework::EditorEvents::Bus::Handler::BusDisconnect();
+        m_colliderManifestCache.Deactivate();
+        m_sourceAssetsIndex.Deactivate();
         ROS2RobotImporterSystemComponent::Deactivate();
     }
 
+    void ROS2RobotImporterEditorSystemComponent::ImportUrdf(const AZ::ConsoleCommandContainer& arguments)
+    {
+        constexpr AZStd::string_view PrefabOption = "--prefab=";
+        constexpr AZStd::string_view CollidersOption = "--colliders=";
+        constexpr AZStd::string_view MergeFixedJointsOption = "--merge-fixed-joints";
+        AZStd::vector<URDFImportRequest> requests;
+        for (const AZStd::string_view argument : arguments)
+        {
+            const size_t assignment = argument.find(":=");
+            const bool isXacroArgument = assignment != AZStd::string_view::npos;
+            const bool isPrefabOption = argument.starts_with(PrefabOption);
+            const bool isCollidersOption = argument.starts_with(CollidersOption);
+            const bool isMergeFixedJointsOption = argument == MergeFixedJointsOption;
+            if ((isXacroArgument || isPrefabOption || isCollidersOption || isMergeFixedJointsOption) && requests.empty())
+            {
+                AZ_Error("ImportUrdf", false, "%.*s is given before any file", AZ_STRING_ARG(argument));
+                return;
+            }
+
+            if (isPrefabOption)
+            {
+                requests.back().m_prefabPath = AZStd::string(argument.substr(PrefabOption.size()));
+            }
+            else if (isMergeFixedJointsOption)
+            {
+                requests.back().m_mergeFixedJoints = true;
+            }
+            else if (isCollidersOption)
+            {
+                if (!Internal::ParseColliderMeshSettings(argument.substr(CollidersOption.size()), requests.back().m_colliderMeshSettings))
+                {
+                    AZ_Error(
+                        "ImportUrdf", false, "%.*s is not one of triangle, convex or decomposition[:<hulls>]", AZ_STRING_ARG(argument));
+                    return;
+                }
+            }
+            else if (isXacroArgument)
+            {
+                requests.back().m_params[AZStd::string(argument.substr(0, assignment))] = AZStd::string(argument.substr(assignment + 2));
+            }
+            else
+            {
+                URDFImportRequest request;
+                request.m_filePath = AZStd::string(argument);
+                requests.push_back(AZStd::move(request));
+            }
+        }
+
+        if (requests.empty())
+        {
+            AZ_Error(
+                "ImportUrdf",
+                false,
+                "No files to import, usage: "
+                "ImportUrdf <file> [name:=value ...] [--prefab=<path>] [--colliders=<mode>] [--merge-fixed-joints] [<file> ...]");
+            return;
+        }
+
+        m_batchImporter.ImportUrdf(
+            requests,
+            [](const URDFBatchImportReport& report)
+            {
+                for (const URDFImportResult& result : report.m_results)
+                {
+                    if (result.m_success)
+                    {
+                        AZ_Printf("ImportUrdf", "Imported %s to %s\n", result.m_filePath.c_str(), result.m_prefabPath.c_str());
+                    }
+                    else
+                    {
+                        AZ_Error("ImportUrdf", false, "Failed to import %s\n%s", result.m_filePath.c_str(), result.m_status.c_str());
+                    }
+                }
+            });
+    }
+
     void ROS2RobotImporterEditorSystemComponent::NotifyRegisterViews()
     {
         AzToolsFramework::ViewPaneOptions options;
@@ -9,6 +9,10 @@
 #pragma once
 
 #include "ROS2RobotImporterSystemComponent.h"
+#include "URDFBatchImporter.h"
+#include "Utils/ColliderManifestCache.h"
+#include "Utils/SourceAssetsIndex.h"
+#include <AzCore/Console/IConsole.h>
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 
 namespace ROS2
@@ -39,5 +43,22 @@ namespace ROS2
         // AzToolsFramework::EditorEvents::Bus::Handler overrides
         void NotifyRegisterViews() override;
         //////////////////////////////////////////////////////////////////////////
+
+        //! Imports robots without the UI, see URDFBatchImporter.
+        //! Arguments are URDF or xacro files, each followed by its xacro arguments as name:=value and optionally by
+        //! --prefab=<path> to choose the prefab, e.g. `ImportUrdf robot.xacro use_lidar:=true --prefab=Assets/robot.prefab other.urdf`.
+        //! --colliders=triangle|convex|decomposition[:<hulls>] chooses how mesh colliders of the file are cooked, see ColliderMeshSettings.
+        //! --merge-fixed-joints merges links of the file attached by fixed joints into their parents, see URDFPrefabMaker.
+        void ImportUrdf(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(
+            ROS2RobotImporterEditorSystemComponent,
+            ImportUrdf,
+            AZ::ConsoleFunctorFlags::Null,
+            "Import URDF or xacro files to prefabs: "
+            "ImportUrdf <file> [name:=value ...] [--prefab=<path>] [--colliders=<mode>] [--merge-fixed-joints] [<file> ...]");
+
+        Utils::SourceAssetsIndex m_sourceAssetsIndex;
+        Utils::ColliderManifestCache m_colliderManifestCache;
+        URDFBatchImporter m_batchImporter;
     };
 } // namespace ROS2
@@ -42,6 +42,7 @@ namespace ROS2
         connect(m_prefabMakerPage, &QWizardPage::completeChanged, this, &RobotImporterWidget::OnUrdfCreated);
         connect(m_prefabMakerPage, &PrefabMakerPage::onCreateButtonPressed, this, &RobotImporterWidget::onCreateButtonPressed);
         connect(this, &RobotImporterWidget::SignalFinalizeURDFCreation, this, &RobotImporterWidget::FinalizeURDFCreation);
+        connect(this, &RobotImporterWidget::SignalReportMeshProgress, this, &RobotImporterWidget::ReportMeshProgress);
         connect(
             this,
             &QWizard::customButtonClicked,
@@ -85,7 +86,7 @@ namespace ROS2
         {
             if (IsFileXacro(m_urdfPath))
             {
-                Utils::xacro::ExecutionOutcome outcome = Utils::xacro::ParseXacro(m_urdfPath.String(), m_params);
+                Utils::xacro::ExecutionOutcome outcome = Utils::xacro::ParseXacro(m_urdfPath.String(), m_params, &m_xacroCache);
                 if (outcome)
                 {
                     m_parsedUrdf = outcome.m_urdfHandle;
@@ -187,7 +188,7 @@ namespace ROS2
                 {
                     QString type = kNotFound;
                     QString sourcePath = kNotFound;
-                    auto crc = AZ::Crc32();
+                    AZ::u64 fileHash = 0;
                     QString tooltip = kNotFound;
                     bool visual = visualNames.contains(meshPath);
                     bool collider = collidersNames.contains(meshPath);
@@ -211,14 +212,14 @@ namespace ROS2
                         const AZStd::string& resolvedPath = asset.m_resolvedUrdfPath.data();
 
                         sourcePath = QString::fromUtf8(productPath.data(), productPath.size());
-                        crc = asset.m_urdfFileCRC;
+                        fileHash = asset.m_urdfFileHash;
                         tooltip = QString::fromUtf8(resolvedPath.data(), resolvedPath.size());
                     }
-                    m_assetPage->ReportAsset(meshPathqs, type, sourcePath, crc, tooltip);
+                    m_assetPage->ReportAsset(meshPathqs, type, sourcePath, fileHash, tooltip);
                 }
                 else
                 {
-                    m_assetPage->ReportAsset(meshPathqs, kNotFound, kNotFound, AZ::Crc32(), kNotFound);
+                    m_assetPage->ReportAsset(meshPathqs, kNotFound, kNotFound, 0, kNotFound);
                 };
             }
         }
@@ -307,14 +308,36 @@ namespace ROS2
                 return;
             }
         }
-        m_prefabMaker = AZStd::make_unique<URDFPrefabMaker>(m_urdfPath.String(), m_parsedUrdf, prefabPath.String(), m_urdfAssetsMapping);
+        m_prefabMaker = AZStd::make_unique<URDFPrefabMaker>(
+            m_urdfPath.String(),
+            m_parsedUrdf,
+            prefabPath.String(),
+            m_urdfAssetsMapping,
+            m_prefabMakerPage->getColliderMeshSettings(),
+            m_prefabMakerPage->getMergeFixedJoints());
 
         auto callback = [&]()
         {
             emit SignalFinalizeURDFCreation();
         };
-        m_prefabMaker->LoadURDF(callback);
+        // Called from the thread which waits for collider meshes, the signal is delivered in the UI thread
+        auto meshProgressCallback = [&](const AZStd::string& meshPath, bool meshReady, size_t remainingCount, size_t totalCount)
+        {
+            const QString progress = tr("Building collider meshes: %1 of %2 done\n%3 %4")
+                                         .arg(totalCount - remainingCount)
+                                         .arg(totalCount)
+                                         .arg(meshReady ? tr("Built") : tr("Timed out"))
+                                         .arg(QString::fromUtf8(meshPath.c_str()));
+            emit SignalReportMeshProgress(progress);
+        };
+        m_prefabMaker->LoadURDF(callback, meshProgressCallback);
+    }
+
+    void RobotImporterWidget::ReportMeshProgress(const QString& progress)
+    {
+        m_prefabMakerPage->reportProgress(progress.toUtf8().constData());
     }
+
     void RobotImporterWidget::FinalizeURDFCreation()
     {
         auto prefabOutcome = m_prefabMaker->CreatePrefabFromURDF();
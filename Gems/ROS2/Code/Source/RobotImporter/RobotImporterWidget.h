@@ -80,6 +80,9 @@ namespace ROS2
         /// Xacro params
         Utils::xacro::Params m_params;
 
+        /// Xacro files expanded during this import session
+        Utils::xacro::ExpansionCache m_xacroCache;
+
         void onCurrentIdChanged(int id);
         void FillAssetPage();
         void FillPrefabMakerPage();
@@ -111,7 +114,9 @@ namespace ROS2
 
     signals:
         void SignalFinalizeURDFCreation();
+        void SignalReportMeshProgress(const QString& progress);
     private slots:
         void FinalizeURDFCreation();
+        void ReportMeshProgress(const QString& progress);
     };
 } // namespace ROS2
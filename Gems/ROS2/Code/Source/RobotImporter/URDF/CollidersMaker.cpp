@@ -9,8 +9,11 @@
 #include "CollidersMaker.h"
 #include "PrefabMakerUtils.h"
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
 #include <RobotImporter/Utils/RobotImporterUtils.h>
@@ -103,8 +106,26 @@ namespace ROS2
         }
     } // namespace Internal
 
-    CollidersMaker::CollidersMaker(const AZStd::shared_ptr<Utils::UrdfAssetMap>& urdfAssetsMapping)
+    AZStd::string ColliderMeshSettings::GetKey() const
+    {
+        switch (m_mode)
+        {
+        case MeshColliderMode::TriangleMesh:
+            return "triangle-mesh";
+        case MeshColliderMode::ConvexHull:
+            return "convex-hull";
+        default:
+            return AZStd::string::format("convex-decomposition-%u-%u", m_maxConvexHulls, m_maxVerticesPerHull);
+        }
+    }
+
+    CollidersMaker::CollidersMaker(
+        const AZStd::shared_ptr<Utils::UrdfAssetMap>& urdfAssetsMapping,
+        const ColliderMeshSettings& meshSettings,
+        Utils::ColliderManifestCache* manifestCache)
         : m_urdfAssetsMapping(urdfAssetsMapping)
+        , m_meshSettings(meshSettings)
+        , m_manifestCache(manifestCache)
         , m_stopBuildFlag(false)
     {
         FindWheelMaterial();
@@ -112,7 +133,12 @@ namespace ROS2
 
     CollidersMaker::~CollidersMaker()
     {
-        m_stopBuildFlag = true;
+        AzFramework::AssetCatalogEventBus::Handler::BusDisconnect();
+        {
+            AZStd::lock_guard lock{ m_buildMutex };
+            m_stopBuildFlag = true;
+        }
+        m_buildCondition.notify_all();
         if (m_buildThread.joinable())
         {
             m_buildThread.join();
@@ -168,149 +194,276 @@ namespace ROS2
 
         auto geometry = collision->geometry;
         bool isPrimitiveShape = geometry->type != urdf::Geometry::MESH;
-        if (!isPrimitiveShape)
+        if (isPrimitiveShape)
         {
-            auto meshGeometry = std::dynamic_pointer_cast<urdf::Mesh>(geometry);
-            if (!meshGeometry)
+            return;
+        }
+        auto meshGeometry = std::dynamic_pointer_cast<urdf::Mesh>(geometry);
+        if (!meshGeometry)
+        {
+            return;
+        }
+        const auto asset = PrefabMakerUtils::GetAssetFromPath(*m_urdfAssetsMapping, meshGeometry->filename);
+        if (!asset)
+        {
+            return;
+        }
+        const AZStd::string& azMeshPath = asset->m_sourceAssetGlobalPath;
+        if (!m_builtMeshes.insert(azMeshPath).second)
+        { // links often share meshes
+            return;
+        }
+
+        auto assetInfoFilePath = AZ::IO::Path{ azMeshPath };
+        assetInfoFilePath.Native() += ".assetinfo";
+        const auto urdfAsset = m_urdfAssetsMapping->find(AZStd::string(meshGeometry->filename.c_str(), meshGeometry->filename.size()));
+        const AZ::u64 meshHash = urdfAsset != m_urdfAssetsMapping->end() ? urdfAsset->second.m_urdfFileHash : 0;
+        const AZStd::string settingsKey = m_meshSettings.GetKey();
+        if (meshHash != 0 && m_manifestCache && m_manifestCache->IsUpToDate(azMeshPath, meshHash, settingsKey, assetInfoFilePath))
+        {
+            AZ_Printf(Internal::CollidersMakerLoggingTag, "Collider manifest %s is up to date\n", assetInfoFilePath.c_str());
+            ++m_cachedManifestCount;
+        }
+        else
+        {
+            if (!WriteColliderManifest(azMeshPath, assetInfoFilePath, meshGeometry->filename))
             {
                 return;
             }
-            const auto asset = PrefabMakerUtils::GetAssetFromPath(*m_urdfAssetsMapping, meshGeometry->filename);
-            if (!asset)
+            ++m_writtenManifestCount;
+            if (meshHash != 0 && m_manifestCache)
             {
-                return;
+                m_manifestCache->Store(azMeshPath, meshHash, settingsKey, Utils::GetFileHash(assetInfoFilePath.String()));
             }
-            const AZStd::string& azMeshPath = asset->m_sourceAssetGlobalPath;
+        }
+        AddPendingMesh(azMeshPath);
+    }
 
-            AZStd::shared_ptr<AZ::SceneAPI::Containers::Scene> scene;
-            AZ::SceneAPI::Events::SceneSerializationBus::BroadcastResult(
-                scene, &AZ::SceneAPI::Events::SceneSerialization::LoadScene, azMeshPath.c_str(), AZ::Uuid::CreateNull(), "");
-            if (!scene)
-            {
-                AZ_Error(
-                    Internal::CollidersMakerLoggingTag,
-                    false,
-                    "Error loading collider. Invalid scene: %s, URDF path: %s",
-                    azMeshPath.c_str(),
-                    meshGeometry->filename.c_str());
-                return;
-            }
+    bool CollidersMaker::WriteColliderManifest(
+        const AZStd::string& azMeshPath, const AZ::IO::Path& assetInfoFilePath, const std::string& urdfMeshPath)
+    {
+        AZStd::shared_ptr<AZ::SceneAPI::Containers::Scene> scene;
+        AZ::SceneAPI::Events::SceneSerializationBus::BroadcastResult(
+            scene, &AZ::SceneAPI::Events::SceneSerialization::LoadScene, azMeshPath.c_str(), AZ::Uuid::CreateNull(), "");
+        if (!scene)
+        {
+            AZ_Error(
+                Internal::CollidersMakerLoggingTag,
+                false,
+                "Error loading collider. Invalid scene: %s, URDF path: %s",
+                azMeshPath.c_str(),
+                urdfMeshPath.c_str());
+            return false;
+        }
 
-            AZ::SceneAPI::Containers::SceneManifest& manifest = scene->GetManifest();
-            auto valueStorage = manifest.GetValueStorage();
-            if (valueStorage.empty())
-            {
-                AZ_Error(
-                    Internal::CollidersMakerLoggingTag, false, "Error loading collider. Invalid value storage: %s", azMeshPath.c_str());
-                return;
-            }
+        AZ::SceneAPI::Containers::SceneManifest& manifest = scene->GetManifest();
+        auto valueStorage = manifest.GetValueStorage();
+        if (valueStorage.empty())
+        {
+            AZ_Error(
+                Internal::CollidersMakerLoggingTag, false, "Error loading collider. Invalid value storage: %s", azMeshPath.c_str());
+            return false;
+        }
+
+        auto view = AZ::SceneAPI::Containers::MakeDerivedFilterView<AZ::SceneAPI::DataTypes::ISceneNodeGroup>(valueStorage);
+        if (view.empty())
+        {
+            AZ_Error(Internal::CollidersMakerLoggingTag, false, "Error loading collider. Invalid node views: %s", azMeshPath.c_str());
+            return false;
+        }
+
+        // Select all nodes for both visual and collision nodes
+        for (AZ::SceneAPI::DataTypes::ISceneNodeGroup& mg : view)
+        {
+            AZ::SceneAPI::Utilities::SceneGraphSelector::SelectAll(scene->GetGraph(), mg.GetSceneNodeSelectionList());
+        }
+
+        // Update scene with all nodes selected
+        AZ::SceneAPI::Events::ProcessingResultCombiner result;
+        AZ::SceneAPI::Events::AssetImportRequestBus::BroadcastResult(
+            result,
+            &AZ::SceneAPI::Events::AssetImportRequest::UpdateManifest,
+            *scene,
+            AZ::SceneAPI::Events::AssetImportRequest::ManifestAction::Update,
+            AZ::SceneAPI::Events::AssetImportRequest::RequestingApplication::Editor);
+
+        if (result.GetResult() != AZ::SceneAPI::Events::ProcessingResult::Success)
+        {
+            AZ_TracePrintf(Internal::CollidersMakerLoggingTag, "Scene updated\n");
+            return false;
+        }
 
-            auto view = AZ::SceneAPI::Containers::MakeDerivedFilterView<AZ::SceneAPI::DataTypes::ISceneNodeGroup>(valueStorage);
-            if (view.empty())
+        AZ_Printf(Internal::CollidersMakerLoggingTag, "Saving collider manifest to %s\n", assetInfoFilePath.c_str());
+        scene->GetManifest().SaveToFile(assetInfoFilePath.c_str());
+
+        // Set the export method of PhysX mesh groups from the settings
+        auto readOutcome = AZ::JsonSerializationUtils::ReadJsonFile(assetInfoFilePath.c_str());
+        if (!readOutcome.IsSuccess())
+        {
+            AZ_Error(
+                Internal::CollidersMakerLoggingTag,
+                false,
+                "Could not read %s with %s",
+                assetInfoFilePath.c_str(),
+                readOutcome.GetError().c_str());
+            return false;
+        }
+        rapidjson::Document assetInfoJson = readOutcome.TakeValue();
+        auto manifestObject = assetInfoJson.GetObject();
+        auto valuesIterator = manifestObject.FindMember("values");
+        if (valuesIterator == manifestObject.MemberEnd())
+        {
+            AZ_Error(
+                Internal::CollidersMakerLoggingTag, false, "Invalid json file: %s (Missing 'values' node)", assetInfoFilePath.c_str());
+            return false;
+        }
+
+        constexpr AZStd::string_view physXMeshGroupType = "{5B03C8E6-8CEE-4DA0-A7FA-CD88689DD45B} MeshGroup";
+        auto valuesArray = valuesIterator->value.GetArray();
+        for (auto& value : valuesArray)
+        {
+            auto object = value.GetObject();
+
+            auto physXMeshGroupIterator = object.FindMember("$type");
+            if (physXMeshGroupIterator == object.MemberEnd() ||
+                !AZ::StringFunc::Equal(physXMeshGroupIterator->value.GetString(), physXMeshGroupType))
             {
-                AZ_Error(Internal::CollidersMakerLoggingTag, false, "Error loading collider. Invalid node views: %s", azMeshPath.c_str());
-                return;
+                continue;
             }
 
-            // Select all nodes for both visual and collision nodes
-            for (AZ::SceneAPI::DataTypes::ISceneNodeGroup& mg : view)
+            auto& allocator = assetInfoJson.GetAllocator();
+            const bool isTriangleMesh = m_meshSettings.m_mode == MeshColliderMode::TriangleMesh;
+            const bool isDecomposition = m_meshSettings.m_mode == MeshColliderMode::ConvexDecomposition;
+            object.RemoveMember("export method");
+            object.AddMember(rapidjson::StringRef("export method"), rapidjson::StringRef(isTriangleMesh ? "0" : "1"), allocator);
+            object.RemoveMember("DecomposeMeshes");
+            object.AddMember(rapidjson::StringRef("DecomposeMeshes"), isDecomposition, allocator);
+            object.RemoveMember("ConvexDecompositionParams");
+            if (isDecomposition)
             {
-                AZ::SceneAPI::Utilities::SceneGraphSelector::SelectAll(scene->GetGraph(), mg.GetSceneNodeSelectionList());
+                rapidjson::Value decompositionParams(rapidjson::kObjectType);
+                decompositionParams.AddMember(rapidjson::StringRef("MaxConvexHulls"), m_meshSettings.m_maxConvexHulls, allocator);
+                decompositionParams.AddMember(
+                    rapidjson::StringRef("MaxNumVerticesPerConvexHull"), m_meshSettings.m_maxVerticesPerHull, allocator);
+                object.AddMember(rapidjson::StringRef("ConvexDecompositionParams"), decompositionParams, allocator);
             }
+        }
 
-            // Update scene with all nodes selected
-            AZ::SceneAPI::Events::ProcessingResultCombiner result;
-            AZ::SceneAPI::Events::AssetImportRequestBus::BroadcastResult(
-                result,
-                &AZ::SceneAPI::Events::AssetImportRequest::UpdateManifest,
-                *scene,
-                AZ::SceneAPI::Events::AssetImportRequest::ManifestAction::Update,
-                AZ::SceneAPI::Events::AssetImportRequest::RequestingApplication::Editor);
+        auto saveOutcome = AZ::JsonSerializationUtils::WriteJsonFile(assetInfoJson, assetInfoFilePath.c_str());
+        if (!saveOutcome.IsSuccess())
+        {
+            AZ_Error(
+                Internal::CollidersMakerLoggingTag,
+                false,
+                "Could not save %s with %s",
+                assetInfoFilePath.c_str(),
+                saveOutcome.GetError().c_str());
+            return false;
+        }
+        return true;
+    }
 
-            if (result.GetResult() != AZ::SceneAPI::Events::ProcessingResult::Success)
+    void CollidersMaker::AddPendingMesh(const AZStd::string& azMeshPath)
+    {
+        bool assetFound = false;
+        AZ::Data::AssetInfo assetInfo;
+        AZStd::string watchDir;
+        AzToolsFramework::AssetSystemRequestBus::BroadcastResult(
+            assetFound,
+            &AzToolsFramework::AssetSystem::AssetSystemRequest::GetSourceInfoBySourcePath,
+            azMeshPath.c_str(),
+            assetInfo,
+            watchDir);
+
+        // Add asset to expected assets list, products of the mesh share the guid of its source
+        if (assetFound)
+        {
+            AZStd::lock_guard lock{ m_buildMutex };
+            m_meshesToBuild[assetInfo.m_assetId.m_guid] = PendingMesh{ AZ::IO::Path(assetInfo.m_relativePath), {} };
+        }
+    }
+
+    void CollidersMaker::PrepareColliders(urdf::LinkSharedPtr link)
+    {
+        auto prepareCollider = [this](const urdf::CollisionSharedPtr& collision)
+        {
+            if (!collision || !collision->geometry || collision->geometry->type != urdf::Geometry::MESH)
             {
-                AZ_TracePrintf(Internal::CollidersMakerLoggingTag, "Scene updated\n");
                 return;
             }
-
-            auto assetInfoFilePath = AZ::IO::Path{ azMeshPath };
-            assetInfoFilePath.Native() += ".assetinfo";
-            AZ_Printf(Internal::CollidersMakerLoggingTag, "Saving collider manifest to %s\n", assetInfoFilePath.c_str());
-            scene->GetManifest().SaveToFile(assetInfoFilePath.c_str());
-
-            bool assetFound = false;
-            AZ::Data::AssetInfo assetInfo;
-            AZStd::string watchDir;
-            AzToolsFramework::AssetSystemRequestBus::BroadcastResult(
-                assetFound,
-                &AzToolsFramework::AssetSystem::AssetSystemRequest::GetSourceInfoBySourcePath,
-                azMeshPath.c_str(),
-                assetInfo,
-                watchDir);
-
-            // Set export method to convex mesh
-            auto readOutcome = AZ::JsonSerializationUtils::ReadJsonFile(assetInfoFilePath.c_str());
-            if (!readOutcome.IsSuccess())
+            auto meshGeometry = std::dynamic_pointer_cast<urdf::Mesh>(collision->geometry);
+            if (!meshGeometry)
             {
-                AZ_Error(
-                    Internal::CollidersMakerLoggingTag,
-                    false,
-                    "Could not read %s with %s",
-                    assetInfoFilePath.c_str(),
-                    readOutcome.GetError().c_str());
                 return;
             }
-            rapidjson::Document assetInfoJson = readOutcome.TakeValue();
-            auto manifestObject = assetInfoJson.GetObject();
-            auto valuesIterator = manifestObject.FindMember("values");
-            if (valuesIterator == manifestObject.MemberEnd())
+            const auto asset = PrefabMakerUtils::GetAssetFromPath(*m_urdfAssetsMapping, meshGeometry->filename);
+            if (!asset)
             {
-                AZ_Error(
-                    Internal::CollidersMakerLoggingTag, false, "Invalid json file: %s (Missing 'values' node)", assetInfoFilePath.c_str());
                 return;
             }
-
-            constexpr AZStd::string_view physXMeshGroupType = "{5B03C8E6-8CEE-4DA0-A7FA-CD88689DD45B} MeshGroup";
-            auto valuesArray = valuesIterator->value.GetArray();
-            for (auto& value : valuesArray)
             {
-                auto object = value.GetObject();
-
-                auto physXMeshGroupIterator = object.FindMember("$type");
-                if (AZ::StringFunc::Equal(physXMeshGroupIterator->value.GetString(), physXMeshGroupType))
+                AZStd::lock_guard lock{ m_colliderMeshAssetsMutex };
+                if (m_colliderMeshAssets.contains(asset->m_sourceAssetGlobalPath))
                 {
-                    value.AddMember(rapidjson::StringRef("export method"), rapidjson::StringRef("1"), assetInfoJson.GetAllocator());
+                    return;
                 }
             }
+            // Links often share meshes, a mesh might be looked up by two links at the same time, with the same result
+            const AZ::Data::AssetId assetId = FindColliderMeshAsset(asset->m_sourceAssetGlobalPath);
+            AZStd::lock_guard lock{ m_colliderMeshAssetsMutex };
+            m_colliderMeshAssets.emplace(asset->m_sourceAssetGlobalPath, assetId);
+        };
 
-            auto saveOutcome = AZ::JsonSerializationUtils::WriteJsonFile(assetInfoJson, assetInfoFilePath.c_str());
-            if (!saveOutcome.IsSuccess())
-            {
-                AZ_Error(
-                    Internal::CollidersMakerLoggingTag,
-                    false,
-                    "Could not save %s with %s",
-                    assetInfoFilePath.c_str(),
-                    saveOutcome.GetError().c_str());
-                return;
-            }
+        for (const auto& collider : link->collision_array)
+        {
+            prepareCollider(collider);
+        }
+        if (link->collision_array.empty())
+        {
+            prepareCollider(link->collision);
+        }
+    }
+
+    AZ::Data::AssetId CollidersMaker::FindColliderMeshAsset(const AZStd::string& azMeshPath) const
+    {
+        AZStd::optional<AZ::IO::Path> pxmodelPath = Internal::GetMeshProductPathFromSourcePath(AZ::IO::Path(azMeshPath));
+        if (!pxmodelPath)
+        {
+            AZ_Error(Internal::CollidersMakerLoggingTag, false, "Could not find pxmodel for %s", azMeshPath.c_str());
+            return {};
+        }
+
+        // Get asset product id (pxmesh)
+        AZ::Data::AssetId assetId;
+        AZ::Data::AssetType assetType = AZ::AzTypeInfo<PhysX::Pipeline::MeshAsset>::Uuid();
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+            assetId, &AZ::Data::AssetCatalogRequests::GetAssetIdByPath, pxmodelPath->c_str(), assetType, false);
+        return assetId;
+    }
 
-            // Add asset to expected assets list
-            if (assetFound)
+    AZ::Data::AssetId CollidersMaker::GetColliderMeshAsset(const AZStd::string& azMeshPath) const
+    {
+        {
+            AZStd::lock_guard lock{ m_colliderMeshAssetsMutex };
+            if (const auto foundAsset = m_colliderMeshAssets.find(azMeshPath); foundAsset != m_colliderMeshAssets.end())
             {
-                AZStd::lock_guard lock{ m_buildMutex };
-                m_meshesToBuild.push_back(AZ::IO::Path(assetInfo.m_relativePath));
+                return foundAsset->second;
             }
         }
+        return FindColliderMeshAsset(azMeshPath);
     }
 
-    void CollidersMaker::AddColliders(urdf::LinkSharedPtr link, AZ::EntityId entityId)
+    void CollidersMaker::AddColliders(urdf::LinkSharedPtr link, AZ::EntityId entityId, const AZ::Transform& linkToEntity)
     {
         AZStd::string typeString = "collider";
         const bool isWheelEntity = Utils::IsWheelURDFHeuristics(link);
         if (isWheelEntity)
         {
-            AZ_Printf(Internal::CollidersMakerLoggingTag, "Due to its name, %s is considered a wheel entity\n", link->name.c_str());
+            AZ_Printf(
+                Internal::CollidersMakerLoggingTag,
+                "Due to its name, %s is considered a %s entity\n",
+                link->name.c_str(),
+                Utils::IsMecanumWheelURDFHeuristics(link) ? "mecanum wheel" : "wheel");
         }
         const AZ::Data::Asset<Physics::MaterialAsset> materialAsset =
             isWheelEntity ? m_wheelMaterial : AZ::Data::Asset<Physics::MaterialAsset>();
@@ -318,13 +471,18 @@ namespace ROS2
         for (auto collider : link->collision_array)
         { // Add colliders (if any) from the collision array
             AddCollider(
-                collider, entityId, PrefabMakerUtils::MakeEntityName(link->name.c_str(), typeString, nameSuffixIndex), materialAsset);
+                collider,
+                entityId,
+                PrefabMakerUtils::MakeEntityName(link->name.c_str(), typeString, nameSuffixIndex),
+                materialAsset,
+                linkToEntity);
             nameSuffixIndex++;
         }
 
         if (nameSuffixIndex == 0)
         { // If there are no colliders in the array, the element member is used instead
-            AddCollider(link->collision, entityId, PrefabMakerUtils::MakeEntityName(link->name.c_str(), typeString), materialAsset);
+            AddCollider(
+                link->collision, entityId, PrefabMakerUtils::MakeEntityName(link->name.c_str(), typeString), materialAsset, linkToEntity);
         }
     }
 
@@ -332,7 +490,8 @@ namespace ROS2
         urdf::CollisionSharedPtr collision,
         AZ::EntityId entityId,
         const AZStd::string& generatedName,
-        const AZ::Data::Asset<Physics::MaterialAsset>& materialAsset)
+        const AZ::Data::Asset<Physics::MaterialAsset>& materialAsset,
+        const AZ::Transform& linkToEntity)
     {
         if (!collision)
         { // it is ok not to have collision in a link
@@ -347,11 +506,14 @@ namespace ROS2
             return;
         }
 
-        AddColliderToEntity(collision, entityId, materialAsset);
+        AddColliderToEntity(collision, entityId, materialAsset, linkToEntity);
     }
 
     void CollidersMaker::AddColliderToEntity(
-        urdf::CollisionSharedPtr collision, AZ::EntityId entityId, const AZ::Data::Asset<Physics::MaterialAsset>& materialAsset) const
+        urdf::CollisionSharedPtr collision,
+        AZ::EntityId entityId,
+        const AZ::Data::Asset<Physics::MaterialAsset>& materialAsset,
+        const AZ::Transform& linkToEntity) const
     {
         AZ::Entity* entity = AzToolsFramework::GetEntityById(entityId);
         AZ_Assert(entity, "AddColliderToEntity called with invalid entityId");
@@ -361,8 +523,9 @@ namespace ROS2
         Physics::ColliderConfiguration colliderConfig;
 
         colliderConfig.m_materialSlots.SetMaterialAsset(0, materialAsset);
-        colliderConfig.m_position = URDF::TypeConversions::ConvertVector3(collision->origin.position);
-        colliderConfig.m_rotation = URDF::TypeConversions::ConvertQuaternion(collision->origin.rotation);
+        const AZ::Transform colliderToEntity = linkToEntity * URDF::TypeConversions::ConvertPose(collision->origin);
+        colliderConfig.m_position = colliderToEntity.GetTranslation();
+        colliderConfig.m_rotation = colliderToEntity.GetRotation();
         if (!isPrimitiveShape)
         {
             AZ_Printf(Internal::CollidersMakerLoggingTag, "Adding mesh collider to %s\n", entityId.ToString().c_str());
@@ -374,22 +537,8 @@ namespace ROS2
             {
                 return;
             }
-            // Get asset path for a given model path
-            const auto azMeshPath = AZ::IO::Path(asset->m_sourceAssetGlobalPath);
-
-            AZStd::optional<AZ::IO::Path> pxmodelPath = Internal::GetMeshProductPathFromSourcePath(azMeshPath);
-            if (!pxmodelPath)
-            {
-                AZ_Error(Internal::CollidersMakerLoggingTag, false, "Could not find pxmodel for %s", azMeshPath.c_str());
-                entity->Deactivate();
-                return;
-            }
-
-            // Get asset product id (pxmesh)
-            AZ::Data::AssetId assetId;
-            AZ::Data::AssetType assetType = AZ::AzTypeInfo<PhysX::Pipeline::MeshAsset>::Uuid();
-            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
-                assetId, &AZ::Data::AssetCatalogRequests::GetAssetIdByPath, pxmodelPath->c_str(), assetType, false);
+            // Get asset product id (pxmesh) for a given model path
+            const AZ::Data::AssetId assetId = GetColliderMeshAsset(asset->m_sourceAssetGlobalPath);
             AZ_Printf(Internal::CollidersMakerLoggingTag, "Collider %s has assetId %s\n", entityId.ToString().c_str(), assetId.ToString<AZStd::string>().c_str());
 
             Physics::PhysicsAssetShapeConfiguration shapeConfiguration;
@@ -456,32 +605,171 @@ namespace ROS2
         }
     }
 
-    void CollidersMaker::ProcessMeshes(BuildReadyCallback notifyBuildReadyCb)
+    void CollidersMaker::ProcessMeshes(BuildReadyCallback notifyBuildReadyCb, MeshProgressCallback meshProgressCb)
     {
+        if (m_manifestCache)
+        {
+            m_manifestCache->Save();
+        }
+
+        // Connect before looking for meshes built earlier, so that no mesh finished in between is missed
+        AzFramework::AssetCatalogEventBus::Handler::BusConnect();
+
+        AZStd::vector<AZ::IO::Path> meshesToCheck;
+        {
+            AZStd::lock_guard lock{ m_buildMutex };
+            const auto deadline = AZStd::chrono::steady_clock::now() + MeshBuildTimeout;
+            for (auto& [sourceGuid, pendingMesh] : m_meshesToBuild)
+            {
+                pendingMesh.m_deadline = deadline;
+                meshesToCheck.push_back(pendingMesh.m_sourcePath);
+            }
+        }
+        const size_t totalCount = meshesToCheck.size();
+
         m_buildThread = AZStd::thread(
-            [this, notifyBuildReadyCb]()
+            [this, notifyBuildReadyCb, meshProgressCb, meshesToCheck, totalCount]()
             {
-                AZ_Printf(Internal::CollidersMakerLoggingTag, "Waiting for URDF assets\n");
+                AZ_Printf(Internal::CollidersMakerLoggingTag, "Waiting for %zu URDF assets\n", totalCount);
 
-                while (!m_meshesToBuild.empty() && !m_stopBuildFlag)
+                // The asset processor does not process a mesh again if its product is up to date, no notification comes for such mesh.
+                // This is the only time the catalog is queried for products.
+                for (const auto& meshPath : meshesToCheck)
                 {
+                    if (Internal::GetMeshProductPathFromSourcePath(meshPath).has_value())
                     {
                         AZStd::lock_guard lock{ m_buildMutex };
-                        auto eraseFoundMesh = [](const AZ::IO::Path& meshPath)
+                        const auto foundMesh = AZStd::find_if(
+                            m_meshesToBuild.begin(),
+                            m_meshesToBuild.end(),
+                            [&meshPath](const auto& pendingMesh)
+                            {
+                                return pendingMesh.second.m_sourcePath == meshPath;
+                            });
+                        if (foundMesh != m_meshesToBuild.end())
                         {
-                            return Internal::GetMeshProductPathFromSourcePath(meshPath).has_value();
-                        };
-                        AZStd::erase_if(m_meshesToBuild, AZStd::move(eraseFoundMesh));
+                            m_meshesToBuild.erase(foundMesh);
+                            m_readyMeshes.push_back(meshPath);
+                        }
                     }
-                    if (!m_meshesToBuild.empty())
+                }
+
+                AZStd::unique_lock lock{ m_buildMutex };
+                while (!m_stopBuildFlag && !(m_meshesToBuild.empty() && m_readyMeshes.empty()))
+                {
+                    if (m_readyMeshes.empty())
                     {
-                        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(50));
+                        auto nextDeadline = AZStd::chrono::steady_clock::time_point::max();
+                        for (const auto& [sourceGuid, pendingMesh] : m_meshesToBuild)
+                        {
+                            nextDeadline = AZStd::min(nextDeadline, pendingMesh.m_deadline);
+                        }
+                        m_buildCondition.wait_until(
+                            lock,
+                            nextDeadline,
+                            [this]()
+                            {
+                                return m_stopBuildFlag || !m_readyMeshes.empty();
+                            });
                     }
+
+                    AZStd::vector<AZ::IO::Path> readyMeshes = AZStd::move(m_readyMeshes);
+                    m_readyMeshes.clear();
+                    AZStd::vector<AZ::IO::Path> timedOutMeshes;
+                    const auto now = AZStd::chrono::steady_clock::now();
+                    for (auto it = m_meshesToBuild.begin(); it != m_meshesToBuild.end();)
+                    {
+                        if (it->second.m_deadline <= now)
+                        {
+                            timedOutMeshes.push_back(it->second.m_sourcePath);
+                            it = m_meshesToBuild.erase(it);
+                        }
+                        else
+                        {
+                            ++it;
+                        }
+                    }
+                    size_t remainingCount = m_meshesToBuild.size();
+
+                    // Callbacks are called without the lock, so that catalog notifications are not held up
+                    lock.unlock();
+                    for (const auto& meshPath : timedOutMeshes)
+                    {
+                        AZ_Warning(
+                            Internal::CollidersMakerLoggingTag,
+                            false,
+                            "Collider mesh %s was not built within %lld seconds",
+                            meshPath.c_str(),
+                            static_cast<long long>(MeshBuildTimeout.count()));
+                    }
+                    if (meshProgressCb)
+                    {
+                        // Meshes reported in one round are counted down one by one
+                        remainingCount += readyMeshes.size() + timedOutMeshes.size();
+                        for (const auto& meshPath : readyMeshes)
+                        {
+                            meshProgressCb(meshPath.String(), true, --remainingCount, totalCount);
+                        }
+                        for (const auto& meshPath : timedOutMeshes)
+                        {
+                            meshProgressCb(meshPath.String(), false, --remainingCount, totalCount);
+                        }
+                    }
+                    lock.lock();
                 }
+                lock.unlock();
 
                 AZ_Printf(Internal::CollidersMakerLoggingTag, "All URDF assets are ready!\n");
                 // Notify the caller that we can continue with constructing the prefab.
                 notifyBuildReadyCb();
             });
     }
+
+    AZStd::string CollidersMaker::GetStatus() const
+    {
+        return AZStd::string::format(
+            "Collider meshes (%s): %zu manifests written, %zu reused from earlier imports\n",
+            m_meshSettings.GetKey().c_str(),
+            m_writtenManifestCount,
+            m_cachedManifestCount);
+    }
+
+    void CollidersMaker::OnCatalogAssetAdded(const AZ::Data::AssetId& assetId)
+    {
+        OnProductReady(assetId);
+    }
+
+    void CollidersMaker::OnCatalogAssetChanged(const AZ::Data::AssetId& assetId)
+    {
+        OnProductReady(assetId);
+    }
+
+    void CollidersMaker::OnProductReady(const AZ::Data::AssetId& assetId)
+    {
+        AZ::Data::AssetInfo assetInfo;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetInfo, &AZ::Data::AssetCatalogRequests::GetAssetInfoById, assetId);
+        if (assetInfo.m_assetType != AZ::AzTypeInfo<PhysX::Pipeline::MeshAsset>::Uuid())
+        {
+            return;
+        }
+
+        {
+            AZStd::lock_guard lock{ m_buildMutex };
+            const auto foundMesh = m_meshesToBuild.find(assetId.m_guid);
+            if (foundMesh == m_meshesToBuild.end())
+            {
+                return;
+            }
+            m_readyMeshes.push_back(foundMesh->second.m_sourcePath);
+            m_meshesToBuild.erase(foundMesh);
+
+            // The asset processor is making progress, give the remaining meshes the full time again
+            const auto deadline = AZStd::chrono::steady_clock::now() + MeshBuildTimeout;
+            for (auto& [sourceGuid, pendingMesh] : m_meshesToBuild)
+            {
+                pendingMesh.m_deadline = deadline;
+            }
+        }
+        m_buildCondition.notify_one();
+    }
 } // namespace ROS2
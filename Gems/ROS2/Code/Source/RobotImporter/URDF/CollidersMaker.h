@@ -11,61 +11,148 @@
 #include "UrdfParser.h"
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/conditional_variable.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Physics/Material/PhysicsMaterialId.h>
+#include <AzFramework/Asset/AssetCatalogBus.h>
 #include <AzFramework/Physics/Material/PhysicsMaterialManager.h>
+#include <RobotImporter/Utils/ColliderManifestCache.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
 
 namespace ROS2
 {
     using BuildReadyCallback = AZStd::function<void()>;
 
+    //! Called each time a collider mesh is built or given up on.
+    //! @param meshPath source path of the mesh, relative to its scan folder.
+    //! @param meshReady true if the mesh was built, false if it timed out.
+    //! @param remainingCount number of meshes still being built.
+    //! @param totalCount number of meshes sent to the asset processor.
+    using MeshProgressCallback =
+        AZStd::function<void(const AZStd::string& meshPath, bool meshReady, size_t remainingCount, size_t totalCount)>;
+
+    //! How the PhysX mesh builder cooks mesh colliders.
+    enum class MeshColliderMode
+    {
+        TriangleMesh, //!< The exact triangle mesh, expensive in simulation and in ray casts.
+        ConvexHull, //!< A single convex hull of the mesh.
+        ConvexDecomposition //!< Convex hulls approximating the mesh, made by V-HACD in the PhysX mesh builder.
+    };
+
+    //! Settings of collider meshes made by the importer.
+    struct ColliderMeshSettings
+    {
+        //! Short text which identifies the settings, kept with cached collider manifests.
+        AZStd::string GetKey() const;
+
+        MeshColliderMode m_mode = MeshColliderMode::ConvexHull;
+        AZ::u32 m_maxConvexHulls = 8; //!< Hull budget of a convex decomposition.
+        AZ::u32 m_maxVerticesPerHull = 64; //!< Vertex budget of each hull of a convex decomposition.
+    };
+
     //! Populates a given entity with all the contents of the <collider> tag in robot description.
-    class CollidersMaker
+    //! Readiness of collider meshes is tracked with asset catalog notifications, the catalog is not polled.
+    class CollidersMaker : private AzFramework::AssetCatalogEventBus::Handler
     {
     public:
         //! Construct the class based on URDF asset mapping.
         //! @param urdfAssetsMapping a prepared mapping of Assets used by the source URDF.
-        CollidersMaker(const AZStd::shared_ptr<Utils::UrdfAssetMap>& urdfAssetsMapping);
+        //! @param meshSettings how collider meshes are cooked.
+        //! @param manifestCache collider manifests written by earlier imports, manifests are always written if it is null.
+        CollidersMaker(
+            const AZStd::shared_ptr<Utils::UrdfAssetMap>& urdfAssetsMapping,
+            const ColliderMeshSettings& meshSettings = {},
+            Utils::ColliderManifestCache* manifestCache = nullptr);
 
         //! Prevent copying of existing CollidersMaker
         CollidersMaker(const CollidersMaker& other) = delete;
 
-        ~CollidersMaker();
+        ~CollidersMaker() override;
 
         //! Builds .pxmeshes for every collider in link collider mesh.
+        //! The manifest of a mesh is not written again if the manifest cache shows that the mesh, the settings and the manifest
+        //! have not changed since the last import, so that the Asset Processor finds the collider mesh up to date.
         //! @param link A parsed URDF tree link node which could hold information about colliders.
         void BuildColliders(urdf::LinkSharedPtr link);
+        //! Finds collider mesh products of the link, so that adding colliders does not need to query the asset system.
+        //! It is safe to call this function for different links concurrently.
+        //! @param link A parsed URDF tree link node which could hold information about colliders.
+        void PrepareColliders(urdf::LinkSharedPtr link);
         //! Add zero, one or many collider elements (depending on link content).
         //! @param link A parsed URDF tree link node which could hold information about colliders.
         //! @param entityId A non-active entity which will be affected.
-        void AddColliders(urdf::LinkSharedPtr link, AZ::EntityId entityId);
+        //! @param linkToEntity Transform from the link to the entity, when colliders of a link are added to the entity of another link.
+        void AddColliders(
+            urdf::LinkSharedPtr link, AZ::EntityId entityId, const AZ::Transform& linkToEntity = AZ::Transform::CreateIdentity());
         //! Sends meshes required for colliders to asset processor.
+        //! Both callbacks are called from a worker thread.
         //! @param buildReadyCb Function to call when the processing finishes.
-        void ProcessMeshes(BuildReadyCallback notifyBuildReadyCb);
+        //! @param meshProgressCb Function to call for each mesh which is built or timed out, may be empty.
+        void ProcessMeshes(BuildReadyCallback notifyBuildReadyCb, MeshProgressCallback meshProgressCb = {});
+
+        //! Get descriptive status of collider meshes, which can be understood by the user.
+        AZStd::string GetStatus() const;
 
     private:
+        //! A collider mesh which is waited for, keyed by the source asset guid, which its products share.
+        struct PendingMesh
+        {
+            AZ::IO::Path m_sourcePath;
+            AZStd::chrono::steady_clock::time_point m_deadline;
+        };
+
+        // AzFramework::AssetCatalogEventBus::Handler overrides
+        void OnCatalogAssetAdded(const AZ::Data::AssetId& assetId) override;
+        void OnCatalogAssetChanged(const AZ::Data::AssetId& assetId) override;
+
+        void OnProductReady(const AZ::Data::AssetId& assetId);
+
         void FindWheelMaterial();
+        bool WriteColliderManifest(const AZStd::string& azMeshPath, const AZ::IO::Path& assetInfoFilePath, const std::string& urdfMeshPath);
+        void AddPendingMesh(const AZStd::string& azMeshPath);
+        AZ::Data::AssetId FindColliderMeshAsset(const AZStd::string& azMeshPath) const;
+        AZ::Data::AssetId GetColliderMeshAsset(const AZStd::string& azMeshPath) const;
         void BuildCollider(urdf::CollisionSharedPtr collision);
         void AddCollider(
             urdf::CollisionSharedPtr collision,
             AZ::EntityId entityId,
             const AZStd::string& generatedName,
-            const AZ::Data::Asset<Physics::MaterialAsset>& materialAsset);
+            const AZ::Data::Asset<Physics::MaterialAsset>& materialAsset,
+            const AZ::Transform& linkToEntity);
         void AddColliderToEntity(
-            urdf::CollisionSharedPtr collision, AZ::EntityId entityId, const AZ::Data::Asset<Physics::MaterialAsset>& materialAsset) const;
+            urdf::CollisionSharedPtr collision,
+            AZ::EntityId entityId,
+            const AZ::Data::Asset<Physics::MaterialAsset>& materialAsset,
+            const AZ::Transform& linkToEntity) const;
+
+        //! Time the asset processor is given to build a mesh. It is renewed for all pending meshes each time one of them is built,
+        //! so that a long queue of meshes does not time out while the processor is making progress.
+        static constexpr AZStd::chrono::seconds MeshBuildTimeout{ 120 };
 
         AZStd::thread m_buildThread;
         AZStd::mutex m_buildMutex;
-        AZStd::vector<AZ::IO::Path> m_meshesToBuild;
+        AZStd::condition_variable m_buildCondition; //!< Signaled when a mesh is ready or the build is stopped.
+        AZStd::unordered_map<AZ::Uuid, PendingMesh> m_meshesToBuild;
+        AZStd::vector<AZ::IO::Path> m_readyMeshes; //!< Meshes found ready by catalog notifications, not yet reported.
         AZStd::atomic_bool m_stopBuildFlag;
+        mutable AZStd::mutex m_colliderMeshAssetsMutex;
+        //! PhysX mesh products found by PrepareColliders, by global path of the source mesh.
+        AZStd::unordered_map<AZStd::string, AZ::Data::AssetId> m_colliderMeshAssets;
         AZ::Data::Asset<Physics::MaterialAsset> m_wheelMaterial;
         AZStd::shared_ptr<Utils::UrdfAssetMap> m_urdfAssetsMapping;
+        ColliderMeshSettings m_meshSettings;
+        Utils::ColliderManifestCache* m_manifestCache = nullptr;
+        AZStd::unordered_set<AZStd::string> m_builtMeshes; //!< Global paths of meshes handled by BuildColliders.
+        size_t m_writtenManifestCount = 0;
+        size_t m_cachedManifestCount = 0;
     };
 } // namespace ROS2
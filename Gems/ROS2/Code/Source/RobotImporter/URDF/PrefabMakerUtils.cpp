@@ -50,7 +50,11 @@ namespace ROS2::PrefabMakerUtils
         AZ::Quaternion azRotation = URDF::TypeConversions::ConvertQuaternion(urdfRotation);
         AZ::Vector3 azPosition = URDF::TypeConversions::ConvertVector3(urdfPosition);
         AZ::Transform tf(azPosition, azRotation, 1.0f);
+        SetEntityTransformLocal(tf, entityId);
+    }
 
+    void SetEntityTransformLocal(const AZ::Transform& tf, AZ::EntityId entityId)
+    {
         AZ::Entity* entity = AzToolsFramework::GetEntityById(entityId);
         auto* transformInterface = entity->FindComponent<AzToolsFramework::Components::TransformComponent>();
 
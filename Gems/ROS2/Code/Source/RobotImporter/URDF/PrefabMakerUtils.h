@@ -10,6 +10,7 @@
 
 #include "UrdfParser.h"
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/Transform.h>
 #include <AzCore/std/optional.h>
 #include <AzCore/std/string/string.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
@@ -34,6 +35,11 @@ namespace ROS2::PrefabMakerUtils
     //! @param entityId entity which will be modified.
     void SetEntityTransformLocal(const urdf::Pose& origin, AZ::EntityId entityId);
 
+    //! Set the transform for an entity.
+    //! @param transform transform relative to the parent entity.
+    //! @param entityId entity which will be modified.
+    void SetEntityTransformLocal(const AZ::Transform& transform, AZ::EntityId entityId);
+
     //! Create a prefab entity in hierarchy.
     //! @param parentEntityId id of parent entity for this new entity.
     //! Passing an invalid id would get the entity in the current context (for example, an entity which is currently open in the Editor).
@@ -11,6 +11,10 @@
 #include "PrefabMakerUtils.h"
 #include <API/EditorAssetSystemAPI.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
 #include <AzToolsFramework/Prefab/PrefabLoaderInterface.h>
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
@@ -28,35 +32,33 @@ namespace ROS2
         const AZStd::string& modelFilePath,
         urdf::ModelInterfaceSharedPtr model,
         AZStd::string prefabPath,
-        const AZStd::shared_ptr<Utils::UrdfAssetMap> urdfAssetsMapping)
+        const AZStd::shared_ptr<Utils::UrdfAssetMap> urdfAssetsMapping,
+        const ColliderMeshSettings& colliderMeshSettings,
+        bool mergeFixedJoints)
         : m_model(model)
+        , m_linkTransforms(model->root_link_)
         , m_visualsMaker(model->materials_, urdfAssetsMapping)
-        , m_collidersMaker(urdfAssetsMapping)
+        , m_collidersMaker(urdfAssetsMapping, colliderMeshSettings, Utils::ColliderManifestCacheInterface::Get())
         , m_prefabPath(std::move(prefabPath))
+        , m_mergeFixedJoints(mergeFixedJoints)
         , m_urdfAssetsMapping(urdfAssetsMapping)
     {
         AZ_Assert(!m_prefabPath.empty(), "Prefab path is empty");
         AZ_Assert(m_model, "Model is nullptr");
     }
 
-    void URDFPrefabMaker::LoadURDF(BuildReadyCallback buildReadyCb)
+    void URDFPrefabMaker::LoadURDF(BuildReadyCallback buildReadyCb, MeshProgressCallback meshProgressCb)
     {
         m_notifyBuildReadyCb = buildReadyCb;
 
         // Request the build of collider meshes by constructing .assetinfo files.
-        BuildAssetsForLink(m_model->root_link_);
-
-        // Spins thread that waits for all collider meshes to be ready. 
-        m_collidersMaker.ProcessMeshes(buildReadyCb);
-    }
-
-    void URDFPrefabMaker::BuildAssetsForLink(urdf::LinkSharedPtr link)
-    {
-        m_collidersMaker.BuildColliders(link);
-        for (auto childLink : link->child_links)
+        for (const auto& linkEntry : m_linkTransforms.GetLinks())
         {
-            BuildAssetsForLink(childLink);
+            m_collidersMaker.BuildColliders(linkEntry.m_link);
         }
+
+        // Spins thread that waits for all collider meshes to be ready.
+        m_collidersMaker.ProcessMeshes(buildReadyCb, meshProgressCb);
     }
 
     AzToolsFramework::Prefab::CreatePrefabResult URDFPrefabMaker::CreatePrefabFromURDF()
@@ -64,123 +66,165 @@ namespace ROS2
         {
             AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
             m_status.clear();
+            m_stageTimes.clear();
         }
-        AZStd::unordered_map<AZStd::string, AzToolsFramework::Prefab::PrefabEntityResult> createdLinks;
-        AzToolsFramework::Prefab::PrefabEntityResult createEntityRoot = AddEntitiesForLink(m_model->root_link_, AZ::EntityId());
-        AZStd::string rootName(m_model->root_link_->name.c_str(), m_model->root_link_->name.size());
-        createdLinks[rootName] = createEntityRoot;
-        if (!createEntityRoot.IsSuccess())
+        auto stageStart = AZStd::chrono::steady_clock::now();
+        auto finishStage = [this, &stageStart](const char* stageName)
         {
-            return AZ::Failure(AZStd::string(createEntityRoot.GetError()));
-        }
-
-        auto links = Utils::GetAllLinks(m_model->root_link_->child_links);
+            const auto stageEnd = AZStd::chrono::steady_clock::now();
+            const auto stageTime = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(stageEnd - stageStart);
+            AZ_TracePrintf("CreatePrefabFromURDF", "Stage %s took %lld ms\n", stageName, static_cast<long long>(stageTime.count()));
+            AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
+            m_stageTimes.emplace_back(stageName, stageTime);
+            stageStart = stageEnd;
+        };
 
-        for (const auto& [name, linkPtr] : links)
+        // The tree of links was flattened when the model was passed in, parents come before their children
+        const AZStd::vector<Utils::LinkTableEntry>& links = m_linkTransforms.GetLinks();
+        if (links.empty())
         {
-            createdLinks[name] = AddEntitiesForLink(linkPtr, createEntityRoot.GetValue());
+            return AZ::Failure(AZStd::string("URDF model has no root link"));
         }
 
-        for (const auto& [name, result] : createdLinks)
+        // Each link is carried by the rigid body of a body link, which is the link itself unless fixed joints are merged
+        AZStd::vector<Utils::LinkIndex> bodies;
+        if (m_mergeFixedJoints)
         {
-            AZ_TracePrintf(
-                "CreatePrefabFromURDF",
-                "Link with name %s was created as: %s\n",
-                name.c_str(),
-                result.IsSuccess() ? (result.GetValue().ToString().c_str()) : ("[Failed]"));
-            AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
-            if (result.IsSuccess())
-            {
-                m_status.emplace(name, AZStd::string::format("created as: %s", result.GetValue().ToString().c_str()));
-            }
-            else
+            bodies = Utils::GetFixedJointBodies(links);
+        }
+        else
+        {
+            bodies.reserve(links.size());
+            for (Utils::LinkIndex linkIndex = 0; linkIndex < links.size(); ++linkIndex)
             {
-                m_status.emplace(name, AZStd::string::format("failed : %s", result.GetError().c_str()));
+                bodies.push_back(linkIndex);
             }
         }
+        AZStd::vector<AZStd::vector<AZStd::pair<urdf::InertialSharedPtr, AZ::Transform>>> bodyInertials(links.size());
+        m_mergedLinkCount = 0;
+        for (Utils::LinkIndex linkIndex = 0; linkIndex < links.size(); ++linkIndex)
+        {
+            const Utils::LinkIndex bodyIndex = bodies[linkIndex];
+            const AZ::Transform linkToBody = links[bodyIndex].m_worldTransform.GetInverse() * links[linkIndex].m_worldTransform;
+            bodyInertials[bodyIndex].emplace_back(links[linkIndex].m_link->inertial, linkToBody);
+            m_mergedLinkCount += bodyIndex != linkIndex ? 1 : 0;
+        }
 
-        // Set the transforms of links
-        for (const auto& [name, linkPtr] : links)
+        // Query the asset system for everything links need, links are independent of each other
         {
-            const auto this_entry = createdLinks.at(name);
-            if (this_entry.IsSuccess())
+            AZ::JobCompletion completion;
+            for (const auto& linkEntry : links)
             {
-                AZ::Transform tf = Utils::GetWorldTransformURDF(linkPtr);
-                auto* entity = AzToolsFramework::GetEntityById(this_entry.GetValue());
-                if (entity)
-                {
-                    auto* transformInterface = entity->FindComponent<AzToolsFramework::Components::TransformComponent>();
-                    if (transformInterface)
-                    {
-                        AZ_TracePrintf(
-                            "CreatePrefabFromURDF",
-                            "Setting transform %s %s to [%f %f %f] [%f %f %f %f]\n",
-                            name.c_str(),
-                            this_entry.GetValue().ToString().c_str(),
-                            tf.GetTranslation().GetX(),
-                            tf.GetTranslation().GetY(),
-                            tf.GetTranslation().GetZ(),
-                            tf.GetRotation().GetX(),
-                            tf.GetRotation().GetY(),
-                            tf.GetRotation().GetZ(),
-                            tf.GetRotation().GetW());
-                        transformInterface->SetWorldTM(tf);
-                    }
-                    else
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [this, link = linkEntry.m_link]()
                     {
-                        AZ_TracePrintf(
-                            "CreatePrefabFromURDF", "Setting transform failed: %s does not have transform interface\n", name.c_str());
-                    }
-                }
+                        m_visualsMaker.PrepareVisuals(link);
+                        m_collidersMaker.PrepareColliders(link);
+                    },
+                    true);
+                job->SetDependent(&completion);
+                job->Start();
             }
+            completion.StartAndWaitForCompletion();
         }
+        finishStage("prepare");
 
-        // Set the hierarchy
-        for (const auto& [name, linkPtr] : links)
+        // Create entities of links in a single pass, each directly in the hierarchy under the entity of its parent link
+        AZStd::vector<AzToolsFramework::Prefab::PrefabEntityResult> createdLinks;
+        createdLinks.reserve(links.size());
+        for (Utils::LinkIndex linkIndex = 0; linkIndex < links.size(); ++linkIndex)
         {
-            const auto thisEntry = createdLinks.at(name);
-            if (!thisEntry.IsSuccess())
-            {
-                AZ_TracePrintf("CreatePrefabFromURDF", "Link %s creation failed\n", name.c_str());
-                continue;
-            }
-            auto parentPtr = linkPtr->getParent();
-            if (!parentPtr)
+            const auto& linkEntry = links[linkIndex];
+            const AZStd::string name(linkEntry.m_link->name.c_str(), linkEntry.m_link->name.size());
+
+            // If a parent link failed, the entity is attached to the closest ancestor which was created
+            Utils::LinkIndex ancestorIndex = linkEntry.m_parentIndex;
+            while (ancestorIndex != Utils::InvalidLinkIndex && !createdLinks[ancestorIndex].IsSuccess())
             {
-                AZ_TracePrintf("CreatePrefabFromURDF", "Link %s has no parents\n", name.c_str());
-                continue;
+                ancestorIndex = links[ancestorIndex].m_parentIndex;
             }
-            AZStd::string parentName(parentPtr->name.c_str(), parentPtr->name.size());
-            const auto parentEntry = createdLinks.find(parentName);
-            if (parentEntry == createdLinks.end())
+            if (linkEntry.m_parentIndex != Utils::InvalidLinkIndex && ancestorIndex == Utils::InvalidLinkIndex)
             {
-                AZ_TracePrintf("CreatePrefabFromURDF", "Link %s has invalid parent name %s\n", name.c_str(), parentName.c_str());
-                continue;
+                createdLinks.push_back(AZ::Failure(AZStd::string("root link was not created")));
             }
-            if (!parentEntry->second.IsSuccess())
+            else
             {
-                AZ_TracePrintf(
-                    "CreatePrefabFromURDF", "Link %s has parent %s which has failed to create\n", name.c_str(), parentName.c_str());
-                continue;
+                const AZ::EntityId parentEntityId =
+                    ancestorIndex == Utils::InvalidLinkIndex ? AZ::EntityId() : createdLinks[ancestorIndex].GetValue();
+                const Utils::LinkIndex bodyIndex = bodies[linkIndex];
+                if (bodyIndex == linkIndex)
+                {
+                    const auto& inertials = bodyInertials[linkIndex];
+                    const urdf::InertialSharedPtr inertial =
+                        inertials.size() > 1 ? Utils::CombineInertials(inertials) : linkEntry.m_link->inertial;
+                    createdLinks.push_back(
+                        AddEntitiesForLink(linkEntry.m_link, parentEntityId, inertial, AZ::EntityId(), AZ::Transform::CreateIdentity()));
+                    if (createdLinks.back().IsSuccess())
+                    { // Wheels are driven through their rigid bodies, which only links that are not merged have
+                        m_vehicleModelMaker.AddWheel(linkEntry.m_link, createdLinks.back().GetValue(), linkEntry.m_worldTransform);
+                    }
+                }
+                else if (createdLinks[bodyIndex].IsSuccess())
+                { // The rigid body of the body link holds colliders of the merged link, its entity is only a frame
+                    const AZ::Transform linkToBody = links[bodyIndex].m_worldTransform.GetInverse() * linkEntry.m_worldTransform;
+                    createdLinks.push_back(
+                        AddEntitiesForLink(linkEntry.m_link, parentEntityId, nullptr, createdLinks[bodyIndex].GetValue(), linkToBody));
+                }
+                else
+                {
+                    AZ_Warning("CreatePrefabFromURDF", false, "Link %s is not merged, its body link was not created", name.c_str());
+                    createdLinks.push_back(
+                        AddEntitiesForLink(linkEntry.m_link, parentEntityId, nullptr, AZ::EntityId(), AZ::Transform::CreateIdentity()));
+                }
             }
+
+            const auto& result = createdLinks.back();
             AZ_TracePrintf(
                 "CreatePrefabFromURDF",
-                "Link %s setting parent to %s\n",
-                thisEntry.GetValue().ToString().c_str(),
-                parentEntry->second.GetValue().ToString().c_str());
-            AZ_TracePrintf("CreatePrefabFromURDF", "Link %s setting parent to %s\n", name.c_str(), parentName.c_str());
-            auto* entity = AzToolsFramework::GetEntityById(thisEntry.GetValue());
-            entity->Activate();
-            AZ::TransformBus::Event(thisEntry.GetValue(), &AZ::TransformBus::Events::SetParent, parentEntry->second.GetValue());
-            entity->Deactivate();
+                "Link with name %s was created as: %s\n",
+                name.c_str(),
+                result.IsSuccess() ? (result.GetValue().ToString().c_str()) : ("[Failed]"));
+            {
+                AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
+                if (result.IsSuccess())
+                {
+                    m_status.emplace(name, AZStd::string::format("created as: %s", result.GetValue().ToString().c_str()));
+                }
+                else
+                {
+                    m_status.emplace(name, AZStd::string::format("failed : %s", result.GetError().c_str()));
+                }
+            }
+
+            // Set the transform of the link relative to the entity it is attached to
+            if (result.IsSuccess() && ancestorIndex != Utils::InvalidLinkIndex)
+            {
+                const AZ::Transform localTransform = links[ancestorIndex].m_worldTransform.GetInverse() * linkEntry.m_worldTransform;
+                PrefabMakerUtils::SetEntityTransformLocal(localTransform, result.GetValue());
+            }
         }
 
-        // Create the joints
-        auto joints = Utils::GetAllJoints(m_model->root_link_->child_links);
+        m_linkEntityCount = AZStd::count_if(
+            createdLinks.begin(),
+            createdLinks.end(),
+            [](const AzToolsFramework::Prefab::PrefabEntityResult& result)
+            {
+                return result.IsSuccess();
+            });
 
-        for (const auto& [jointName, jointPtr] : joints)
+        const auto& createEntityRoot = createdLinks.front();
+        if (!createEntityRoot.IsSuccess())
         {
-            AZ_Assert(jointPtr, "joint %s is null", jointName.c_str());
+            return AZ::Failure(AZStd::string(createEntityRoot.GetError()));
+        }
+
+        // Create the joints, once all links are in place. Every link but the root has a joint to its parent.
+        for (size_t linkIndex = 1; linkIndex < links.size(); ++linkIndex)
+        {
+            const auto& linkEntry = links[linkIndex];
+            const urdf::JointSharedPtr& jointPtr = linkEntry.m_link->parent_joint;
+            AZ_Assert(jointPtr, "link %s has no parent joint", linkEntry.m_link->name.c_str());
+            const AZStd::string jointName(jointPtr->name.c_str(), jointPtr->name.size());
             AZ_TracePrintf(
                 "CreatePrefabFromURDF",
                 "Creating joint %s : %s -> %s\n",
@@ -188,41 +232,53 @@ namespace ROS2
                 jointPtr->parent_link_name.c_str(),
                 jointPtr->child_link_name.c_str());
 
-            auto leadEntity = createdLinks.at(jointPtr->parent_link_name.c_str());
-            auto childEntity = createdLinks.at(jointPtr->child_link_name.c_str());
+            // The joint is between rigid bodies, which are on entities of body links
+            const auto& leadEntity = createdLinks[bodies[linkEntry.m_parentIndex]];
+            const auto& childEntity = createdLinks[linkIndex];
+            const bool isMerged = bodies[linkIndex] != linkIndex;
             // check if both has RigidBody
             if (leadEntity.IsSuccess() && childEntity.IsSuccess())
             {
                 AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
-                auto result = m_jointsMaker.AddJointComponent(jointPtr, childEntity.GetValue(), leadEntity.GetValue());
-                if (result.IsSuccess())
+                if (isMerged)
                 {
-                    m_status.emplace(jointName, AZStd::string::format("created as %llu", result.GetValue()));
+                    const std::string& bodyName = links[bodies[linkIndex]].m_link->name;
+                    m_status.emplace(jointName, AZStd::string::format("merged into %s", bodyName.c_str()));
                 }
                 else
                 {
-                    m_status.emplace(jointName, AZStd::string::format("Failed:  %s", result.GetError().c_str()));
+                    auto result = m_jointsMaker.AddJointComponent(jointPtr, childEntity.GetValue(), leadEntity.GetValue());
+                    if (result.IsSuccess())
+                    {
+                        m_status.emplace(jointName, AZStd::string::format("created as %llu", result.GetValue()));
+                    }
+                    else
+                    {
+                        m_status.emplace(jointName, AZStd::string::format("Failed:  %s", result.GetError().c_str()));
+                    }
                 }
 
+                // A merged link keeps the name of its joint, its frame is published as static
                 AZ::Entity* entity = AzToolsFramework::GetEntityById(childEntity.GetValue());
                 if (entity)
                 {
                     auto* component = Utils::GetGameOrEditorComponent<ROS2FrameComponent>(entity);
                     AZ_Assert(component, "ROS2 Frame Component does not exist for %s", childEntity.GetValue().ToString().c_str());
-                    component->SetJointName(AZStd::string(jointName.c_str()));
+                    component->SetJointName(jointName);
                 }
-
             }
             else
             {
                 AZ_Warning("CreatePrefabFromURDF", false, "cannot create joint %s", jointName.c_str());
             }
         }
+        finishStage("commit");
 
         MoveEntityToDefaultSpawnPoint(createEntityRoot.GetValue());
 
         auto contentEntityId = createEntityRoot.GetValue();
         AddRobotControl(contentEntityId);
+        m_vehicleModelMaker.AddVehicleModel(contentEntityId);
 
         // Create prefab, save it to disk immediately
         // Remove prefab, if it was already created.
@@ -251,10 +307,16 @@ namespace ROS2
             PrefabMakerUtils::AddRequiredComponentsToEntity(prefabContainerEntityId);
         }
         AZ_TracePrintf("CreatePrefabFromURDF", "Successfully created prefab %s\n", m_prefabPath.c_str());
+        finishStage("save");
         return outcome;
     }
 
-    AzToolsFramework::Prefab::PrefabEntityResult URDFPrefabMaker::AddEntitiesForLink(urdf::LinkSharedPtr link, AZ::EntityId parentEntityId)
+    AzToolsFramework::Prefab::PrefabEntityResult URDFPrefabMaker::AddEntitiesForLink(
+        urdf::LinkSharedPtr link,
+        AZ::EntityId parentEntityId,
+        urdf::InertialSharedPtr inertial,
+        AZ::EntityId colliderEntityId,
+        const AZ::Transform& linkToColliderEntity)
     {
         if (!link)
         {
@@ -277,8 +339,8 @@ namespace ROS2
             component->SetFrameID(AZStd::string(link->name.c_str(), link->name.size()));
         }
         m_visualsMaker.AddVisuals(link, entityId);
-        m_inertialsMaker.AddInertial(link->inertial, entityId);
-        m_collidersMaker.AddColliders(link, entityId);
+        m_inertialsMaker.AddInertial(inertial, entityId);
+        m_collidersMaker.AddColliders(link, colliderEntityId.IsValid() ? colliderEntityId : entityId, linkToColliderEntity);
         return AZ::Success(entityId);
     }
 
@@ -328,6 +390,21 @@ namespace ROS2
     {
         AZStd::string str;
         AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
+        for (const auto& [stageName, stageTime] : m_stageTimes)
+        {
+            str += AZStd::string::format("Stage %s took %lld ms\n", stageName.c_str(), static_cast<long long>(stageTime.count()));
+        }
+        str += AZStd::string::format(
+            "Prefab entities: %zu, links: %zu, visual sub-entities: %zu\n",
+            m_linkEntityCount + m_visualsMaker.GetSubEntityCount(),
+            m_linkEntityCount,
+            m_visualsMaker.GetSubEntityCount());
+        if (m_mergeFixedJoints)
+        {
+            str += AZStd::string::format("Links merged into their parents by fixed joints: %zu\n", m_mergedLinkCount);
+        }
+        str += m_visualsMaker.GetStatus();
+        str += m_collidersMaker.GetStatus();
         for (const auto& [entry, entryStatus] : m_status)
         {
             str += entry + " " + entryStatus + "\n";
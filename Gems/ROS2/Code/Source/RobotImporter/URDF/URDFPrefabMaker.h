@@ -12,13 +12,17 @@
 #include "InertialsMaker.h"
 #include "JointsMaker.h"
 #include "UrdfParser.h"
+#include "VehicleModelMaker.h"
 #include "VisualsMaker.h"
 #include <AzCore/Component/EntityId.h>
-#include <AzCore/std/string/string.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzToolsFramework/Prefab/PrefabPublicInterface.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
 
 namespace ROS2
@@ -32,18 +36,29 @@ namespace ROS2
         //! @param model parsed model.
         //! @param prefabPath path to the prefab which will be created as a result of import.
         //! @param urdfAssetsMapping prepared mapping of URDF meshes to Assets.
+        //! @param colliderMeshSettings how mesh colliders are cooked.
+        //! @param mergeFixedJoints merge links attached by fixed joints into their parents, see CreatePrefabFromURDF.
         URDFPrefabMaker(
             const AZStd::string& modelFilePath,
             urdf::ModelInterfaceSharedPtr model,
             AZStd::string prefabPath,
-            const AZStd::shared_ptr<Utils::UrdfAssetMap> urdfAssetsMapping);
+            const AZStd::shared_ptr<Utils::UrdfAssetMap> urdfAssetsMapping,
+            const ColliderMeshSettings& colliderMeshSettings = {},
+            bool mergeFixedJoints = false);
         ~URDFPrefabMaker() = default;
 
         //! Loads URDF file and builds all required meshes and colliders.
         //! @param buildReadyCb Function to call when the build finishes.
-        void LoadURDF(BuildReadyCallback buildReadyCb);
+        //! @param meshProgressCb Function to call for each collider mesh which is built or timed out, may be empty.
+        void LoadURDF(BuildReadyCallback buildReadyCb, MeshProgressCallback meshProgressCb = {});
 
         //! Create and return a prefab corresponding to the URDF model as set through the constructor.
+        //! The asset system is queried for all links in parallel first, then entities are created in a single pass over the table
+        //! of links, which is built once for the model. Durations of the stages are part of the status.
+        //! When fixed joints are merged, a link attached by a fixed joint gets no rigid body and no joint. Its colliders are added to the
+        //! entity of the closest ancestor with a rigid body, its inertial is combined with the inertial of that ancestor, while its entity
+        //! keeps the visuals and the frame of the link, so that transforms of all links are still published.
+        //! Robots with mecanum wheels get a mecanum vehicle model with twist control, see VehicleModelMaker.
         //! @return result which is either a prefab containing the imported model based on URDF or an error.
         AzToolsFramework::Prefab::CreatePrefabResult CreatePrefabFromURDF();
 
@@ -56,21 +71,35 @@ namespace ROS2
         AZStd::string GetStatus();
 
     private:
-        AzToolsFramework::Prefab::PrefabEntityResult AddEntitiesForLink(urdf::LinkSharedPtr link, AZ::EntityId parentEntityId);
-        void BuildAssetsForLink(urdf::LinkSharedPtr link);
+        //! Creates the entity of a link with its frame and visuals.
+        //! @param inertial inertial of the rigid body of the link, no rigid body is added if it is null.
+        //! @param colliderEntityId entity to hold colliders of the link, the entity of the link if invalid.
+        //! @param linkToColliderEntity transform from the link to the entity which holds the colliders.
+        AzToolsFramework::Prefab::PrefabEntityResult AddEntitiesForLink(
+            urdf::LinkSharedPtr link,
+            AZ::EntityId parentEntityId,
+            urdf::InertialSharedPtr inertial,
+            AZ::EntityId colliderEntityId,
+            const AZ::Transform& linkToColliderEntity);
         void AddRobotControl(AZ::EntityId rootEntityId);
         static void MoveEntityToDefaultSpawnPoint(const AZ::EntityId& rootEntityId);
 
         urdf::ModelInterfaceSharedPtr m_model;
+        Utils::LinkTransformCache m_linkTransforms; //!< Links of the model with their transforms, built once for the model.
         AZStd::string m_prefabPath;
         VisualsMaker m_visualsMaker;
         CollidersMaker m_collidersMaker;
         InertialsMaker m_inertialsMaker;
         JointsMaker m_jointsMaker;
+        VehicleModelMaker m_vehicleModelMaker;
 
         BuildReadyCallback m_notifyBuildReadyCb;
         AZStd::mutex m_statusLock;
         AZStd::multimap<AZStd::string, AZStd::string> m_status;
+        AZStd::vector<AZStd::pair<AZStd::string, AZStd::chrono::milliseconds>> m_stageTimes; //!< Duration of each stage of the last import.
+        size_t m_linkEntityCount = 0; //!< Entities of links created by the last import.
+        size_t m_mergedLinkCount = 0; //!< Links of the last import merged into their parents.
+        bool m_mergeFixedJoints = false;
 
         AZStd::shared_ptr<Utils::UrdfAssetMap> m_urdfAssetsMapping;
     };
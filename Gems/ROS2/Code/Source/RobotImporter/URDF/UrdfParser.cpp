@@ -10,7 +10,11 @@
 
 #include <fstream>
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Trace.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
 #include <console_bridge/console.h>
 #include <urdf_model/model.h>
@@ -26,14 +30,25 @@ namespace ROS2
             // locales are set to system with comma as decimal separator and URDF file is created with dot as decimal separator, URDF parser
             // will trim the floating point number after comma. For example, if parsing 0.1, URDF parser will parse it as 0.
             // This might lead to incorrect URDF loading. If the current locale is not a dot (as per standard ROS locale), we warn the user.
-            std::locale currentLocale("");
-            if (std::use_facet<std::numpunct<char>>(currentLocale).decimal_point() != '.')
+            // Constructing the system locale is slow and it does not change while the editor runs, so it is checked once.
+            static const bool localeHasDotDecimalSeparator = []()
             {
+                std::locale currentLocale("");
+                const bool hasDot = std::use_facet<std::numpunct<char>>(currentLocale).decimal_point() == '.';
                 AZ_Warning(
-                    "UrdfParser", false, "Locale %s might be incompatible with the URDF file content.\n", currentLocale.name().c_str());
-            }
+                    "UrdfParser", hasDot, "Locale %s might be incompatible with the URDF file content.\n", currentLocale.name().c_str());
+                return hasDot;
+            }();
+            AZ_UNUSED(localeHasDotDecimalSeparator);
         }
 
+        //! Size and duration of the last parse, reported with the parsing log.
+        struct ParseStatistics
+        {
+            size_t m_bytes = 0;
+            AZStd::chrono::microseconds m_duration{ 0 };
+        };
+
         class CustomConsoleHandler : public console_bridge::OutputHandler
         {
         private:
@@ -66,33 +81,59 @@ namespace ROS2
         }
 
         CustomConsoleHandler customConsoleHandler;
+        ParseStatistics lastParseStatistics;
+        AZStd::mutex parseMutex; //!< urdf_parser logs through a global console_bridge handler, parses run one at a time.
+
+        //! urdf_parser only takes a std::string, callers hand over the one buffer they have.
+        urdf::ModelInterfaceSharedPtr ParseBuffer(const std::string& xmlString)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(parseMutex);
+            console_bridge::useOutputHandler(&customConsoleHandler);
+            CheckIfCurrentLocaleHasDotAsADecimalSeparator();
+            const auto start = AZStd::chrono::steady_clock::now();
+            const auto ret = urdf::parseURDF(xmlString);
+            lastParseStatistics.m_bytes = xmlString.size();
+            lastParseStatistics.m_duration =
+                AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - start);
+            console_bridge::restorePreviousOutputHandler();
+            return ret;
+        }
     } // namespace UrdfParser::Internal
 
-    urdf::ModelInterfaceSharedPtr UrdfParser::Parse(const AZStd::string& xmlString)
+    urdf::ModelInterfaceSharedPtr UrdfParser::Parse(AZStd::string_view xmlString)
     {
-        console_bridge::useOutputHandler(&Internal::customConsoleHandler);
-        Internal::CheckIfCurrentLocaleHasDotAsADecimalSeparator();
-        const auto ret = urdf::parseURDF(xmlString.c_str());
-        console_bridge::restorePreviousOutputHandler();
-        return ret;
+        return Internal::ParseBuffer(std::string(xmlString.data(), xmlString.size()));
     }
 
     urdf::ModelInterfaceSharedPtr UrdfParser::ParseFromFile(const AZStd::string& filePath)
     {
-        std::ifstream istream(filePath.c_str());
+        std::ifstream istream(filePath.c_str(), std::ios::binary | std::ios::ate);
         if (!istream)
         {
             AZ_Error("UrdfParser", false, "File %s does not exist", filePath.c_str());
             return nullptr;
         }
 
-        std::string xmlStr((std::istreambuf_iterator<char>(istream)), std::istreambuf_iterator<char>());
-        return Parse(xmlStr.c_str());
+        // Read the whole file at once into a buffer of its size, large generated URDFs can have tens of megabytes
+        const std::streamsize size = istream.tellg();
+        std::string xmlStr(static_cast<size_t>(AZStd::max<std::streamsize>(size, 0)), '\0');
+        istream.seekg(0);
+        if (!istream.read(xmlStr.data(), size))
+        {
+            AZ_Error("UrdfParser", false, "Cannot read file %s", filePath.c_str());
+            return nullptr;
+        }
+        return Internal::ParseBuffer(xmlStr);
     }
 
     AZStd::string UrdfParser::GetUrdfParsingLog()
     {
-        return Internal::customConsoleHandler.GetLog();
+        AZStd::lock_guard<AZStd::mutex> lock(Internal::parseMutex);
+        const auto& statistics = Internal::lastParseStatistics;
+        AZStd::string log = Internal::customConsoleHandler.GetLog();
+        log += AZStd::string::format(
+            "Parsed %zu bytes in %.3f ms\n", statistics.m_bytes, aznumeric_cast<double>(statistics.m_duration.count()) / 1000.0);
+        return log;
     }
 
 } // namespace ROS2
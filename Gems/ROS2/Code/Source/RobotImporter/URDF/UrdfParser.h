@@ -9,25 +9,28 @@
 #pragma once
 
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
 #include <urdf_parser/urdf_parser.h>
 
 namespace ROS2
 {
     //! Class for parsing URDF data.
+    //! Parsing functions can be called from many threads, parses are serialized because urdf_parser logs through a global handler.
     namespace UrdfParser
     {
         //! Parse string with URDF data and generate model.
         //! @param xmlString a string that contains URDF data (XML format).
         //! @return model represented as a tree of parsed links.
-        urdf::ModelInterfaceSharedPtr Parse(const AZStd::string& xmlString);
+        urdf::ModelInterfaceSharedPtr Parse(AZStd::string_view xmlString);
 
         //! Parse file with URDF data and generate model.
+        //! The file is read once into the buffer handed to urdf_parser, without intermediate copies.
         //! @param filePath is a path to file with URDF data that will be loaded and parsed.
         //! @return model represented as a tree of parsed links.
         urdf::ModelInterfaceSharedPtr ParseFromFile(const AZStd::string& filePath);
 
         //! Retrieve console log from URDF parsing
-        //! @return a log with output from urdf_parser
+        //! @return a log with output from urdf_parser, followed by the size and parse time of the last parsed document
         AZStd::string GetUrdfParsingLog();
 
     }; // namespace UrdfParser
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "VehicleModelMaker.h"
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <AzToolsFramework/Entity/EditorEntityHelpers.h>
+#include <ROS2/ROS2GemUtilities.h>
+#include <RobotControl/Controllers/MecanumController/MecanumControlComponent.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
+#include <VehicleDynamics/ModelComponents/MecanumModelComponent.h>
+#include <VehicleDynamics/WheelControllerComponent.h>
+
+namespace ROS2
+{
+    namespace Internal
+    {
+        //! Radius of a cylinder or a sphere, zero for other geometries.
+        float GetGeometryRadius(const urdf::GeometrySharedPtr& geometry)
+        {
+            if (auto cylinder = std::dynamic_pointer_cast<urdf::Cylinder>(geometry))
+            {
+                return static_cast<float>(cylinder->radius);
+            }
+            if (auto sphere = std::dynamic_pointer_cast<urdf::Sphere>(geometry))
+            {
+                return static_cast<float>(sphere->radius);
+            }
+            return 0.0f;
+        }
+
+        //! Wheel radius from the collision of a wheel link, or from its visual if the collision is a mesh.
+        float GetWheelRadius(const urdf::LinkSharedPtr& link)
+        {
+            const float collisionRadius = link->collision ? GetGeometryRadius(link->collision->geometry) : 0.0f;
+            if (collisionRadius > 0.0f)
+            {
+                return collisionRadius;
+            }
+            return link->visual ? GetGeometryRadius(link->visual->geometry) : 0.0f;
+        }
+    } // namespace Internal
+
+    void VehicleModelMaker::AddWheel(urdf::LinkSharedPtr link, AZ::EntityId entityId, const AZ::Transform& linkToRoot)
+    {
+        if (!Utils::IsMecanumWheelURDFHeuristics(link))
+        {
+            return;
+        }
+
+        const float radius = Internal::GetWheelRadius(link);
+        if (radius <= 0.0f)
+        {
+            AZ_Warning("AddWheel", false, "Mecanum wheel %s has no cylinder or sphere to take its radius from", link->name.c_str());
+            return;
+        }
+
+        if (Utils::CreateComponent(entityId, VehicleDynamics::WheelControllerComponent::TYPEINFO_Uuid()) != AZ::InvalidComponentId)
+        {
+            m_wheels.push_back({ entityId, linkToRoot.GetTranslation(), radius });
+        }
+    }
+
+    void VehicleModelMaker::AddVehicleModel(AZ::EntityId rootEntityId) const
+    {
+        if (m_wheels.empty())
+        {
+            return;
+        }
+
+        const VehicleDynamics::VehicleConfiguration configuration = MakeVehicleConfiguration(m_wheels);
+        if (configuration.m_axles.size() < 2)
+        {
+            AZ_Warning("AddVehicleModel", false, "Mecanum wheels make less than two axles, no vehicle model is added");
+            return;
+        }
+        AZ_TracePrintf(
+            "AddVehicleModel",
+            "Adding a mecanum vehicle model with %zu axles, wheelbase %f and track %f\n",
+            configuration.m_axles.size(),
+            configuration.m_wheelbase,
+            configuration.m_track);
+
+        if (Utils::CreateComponent(rootEntityId, VehicleDynamics::MecanumModelComponent::TYPEINFO_Uuid()) == AZ::InvalidComponentId)
+        {
+            return;
+        }
+        AZ::Entity* rootEntity = AzToolsFramework::GetEntityById(rootEntityId);
+        auto* component = Utils::GetGameOrEditorComponent<VehicleDynamics::MecanumModelComponent>(rootEntity);
+        AZ_Assert(component, "Mecanum model component does not exist for %s", rootEntityId.ToString().c_str());
+        component->SetVehicleConfiguration(configuration);
+
+        Utils::CreateComponent(rootEntityId, MecanumControlComponent::TYPEINFO_Uuid());
+    }
+
+    VehicleDynamics::VehicleConfiguration VehicleModelMaker::MakeVehicleConfiguration(AZStd::vector<Wheel> wheels)
+    {
+        VehicleDynamics::VehicleConfiguration configuration;
+        if (wheels.empty())
+        {
+            return configuration;
+        }
+
+        AZStd::sort(
+            wheels.begin(),
+            wheels.end(),
+            [](const Wheel& a, const Wheel& b)
+            {
+                return a.m_position.GetX() > b.m_position.GetX();
+            });
+        configuration.m_wheelbase = wheels.front().m_position.GetX() - wheels.back().m_position.GetX();
+
+        float track = 0.0f;
+        for (size_t first = 0; first < wheels.size();)
+        {
+            // Wheels of an axle follow the first one within half of its radius
+            size_t last = first + 1;
+            const float axleX = wheels[first].m_position.GetX();
+            while (last < wheels.size() && axleX - wheels[last].m_position.GetX() <= 0.5f * wheels[first].m_radius)
+            {
+                ++last;
+            }
+            AZStd::sort(
+                wheels.begin() + first,
+                wheels.begin() + last,
+                [](const Wheel& a, const Wheel& b)
+                {
+                    return a.m_position.GetY() > b.m_position.GetY();
+                });
+
+            VehicleDynamics::AxleConfiguration& axle = configuration.m_axles.emplace_back();
+            axle.m_axleTag = AZStd::string::format("axle_%zu", configuration.m_axles.size() - 1);
+            axle.m_isDrive = true;
+            float radiusSum = 0.0f;
+            for (size_t i = first; i < last; ++i)
+            {
+                axle.m_axleWheels.push_back(wheels[i].m_entityId);
+                radiusSum += wheels[i].m_radius;
+            }
+            axle.m_wheelRadius = radiusSum / static_cast<float>(last - first);
+            track = AZStd::max(track, wheels[first].m_position.GetY() - wheels[last - 1].m_position.GetY());
+            first = last;
+        }
+
+        configuration.m_track = track;
+        return configuration;
+    }
+} // namespace ROS2
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "UrdfParser.h"
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+#include <VehicleDynamics/VehicleConfiguration.h>
+
+namespace ROS2
+{
+    //! Populates a robot with a mecanum vehicle model, when its wheels are recognized as mecanum wheels.
+    //! @see Utils::IsMecanumWheelURDFHeuristics.
+    class VehicleModelMaker
+    {
+    public:
+        //! Mecanum wheel of the robot.
+        struct Wheel
+        {
+            AZ::EntityId m_entityId;
+            AZ::Vector3 m_position; //!< Position relative to the root link, X forward and Y to the left.
+            float m_radius = 0.0f; //!< [m]
+        };
+
+        //! Adds a wheel controller to the entity of a link, if the link is a mecanum wheel.
+        //! @param link the link of the entity.
+        //! @param entityId entity of the link, which has the rigid body of the link.
+        //! @param linkToRoot transform of the link relative to the root link.
+        void AddWheel(urdf::LinkSharedPtr link, AZ::EntityId entityId, const AZ::Transform& linkToRoot);
+
+        //! Adds a mecanum vehicle model and its twist control to the root entity, if mecanum wheels make at least two axles.
+        //! The root entity needs to have the robot control component already.
+        void AddVehicleModel(AZ::EntityId rootEntityId) const;
+
+        //! Builds the vehicle configuration of wheels. Wheels at the same position along the robot, up to half of their radius,
+        //! make an axle. Axles are sorted front to rear, wheels of an axle left to right, and all of them are drive axles.
+        //! The wheelbase is the distance between the front and the rear axle, the track is the widest distance between
+        //! the outer wheels of an axle.
+        static VehicleDynamics::VehicleConfiguration MakeVehicleConfiguration(AZStd::vector<Wheel> wheels);
+
+    private:
+        AZStd::vector<Wheel> m_wheels;
+    };
+} // namespace ROS2
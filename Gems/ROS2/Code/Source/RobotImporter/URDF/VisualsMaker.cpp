@@ -10,10 +10,12 @@
 #include "RobotImporter/URDF/PrefabMakerUtils.h"
 #include "RobotImporter/Utils/TypeConversions.h"
 
+#include <Atom/RPI.Reflect/Model/ModelAsset.h>
 #include <AtomLyIntegration/CommonFeatures/Material/MaterialComponentBus.h>
 #include <AtomLyIntegration/CommonFeatures/Material/MaterialComponentConstants.h>
 #include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentBus.h>
 #include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentConstants.h>
+#include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/NonUniformScaleBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
@@ -37,7 +39,66 @@ namespace ROS2
             });
     }
 
-    void VisualsMaker::AddVisuals(urdf::LinkSharedPtr link, AZ::EntityId entityId) const
+    void VisualsMaker::PrepareVisuals(urdf::LinkSharedPtr link)
+    {
+        auto prepareVisual = [this](const urdf::VisualSharedPtr& visual)
+        {
+            if (!visual || !visual->geometry || visual->geometry->type != urdf::Geometry::MESH)
+            {
+                return;
+            }
+            auto meshGeometry = std::dynamic_pointer_cast<urdf::Mesh>(visual->geometry);
+            if (!meshGeometry)
+            {
+                return;
+            }
+            const auto asset = PrefabMakerUtils::GetAssetFromPath(*m_urdfAssetsMapping, meshGeometry->filename);
+            if (!asset)
+            {
+                return;
+            }
+            {
+                AZStd::lock_guard lock{ m_modelAssetsMutex };
+                if (m_modelAssets.contains(asset->m_sourceAssetGlobalPath))
+                {
+                    return;
+                }
+            }
+            // Links often share meshes, a mesh might be looked up by two links at the same time, with the same result
+            const AZ::Data::AssetId assetId = FindModelAsset(asset->m_sourceAssetGlobalPath);
+            AZStd::lock_guard lock{ m_modelAssetsMutex };
+            m_modelAssets.emplace(asset->m_sourceAssetGlobalPath, assetId);
+        };
+
+        for (const auto& visual : link->visual_array)
+        {
+            prepareVisual(visual);
+        }
+        if (link->visual_array.empty())
+        {
+            prepareVisual(link->visual);
+        }
+    }
+
+    AZ::Data::AssetId VisualsMaker::FindModelAsset(const AZStd::string& azMeshPath) const
+    {
+        const AZ::IO::Path azModelPath = PrefabMakerUtils::GetAzModelAssetPathFromModelPath(AZ::IO::Path(azMeshPath));
+        if (azModelPath.empty())
+        {
+            return {};
+        }
+
+        AZ::Data::AssetId assetId;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+            assetId,
+            &AZ::Data::AssetCatalogRequests::GetAssetIdByPath,
+            azModelPath.c_str(),
+            AZ::AzTypeInfo<AZ::RPI::ModelAsset>::Uuid(),
+            false);
+        return assetId;
+    }
+
+    void VisualsMaker::AddVisuals(urdf::LinkSharedPtr link, AZ::EntityId entityId)
     {
         const AZStd::string typeString = "visual";
         if (link->visual_array.size() < 1)
@@ -45,6 +106,14 @@ namespace ROS2
             AddVisual(link->visual, entityId, PrefabMakerUtils::MakeEntityName(link->name.c_str(), typeString));
             return;
         }
+        if (link->visual_array.size() == 1 && CanMergeIntoLinkEntity(link->visual_array.front()))
+        { // A single mesh at the origin of the link needs no entity of its own
+            CountVisual(link->visual_array.front());
+            AddVisualToEntity(link->visual_array.front(), entityId);
+            AddMaterialForVisual(link->visual_array.front(), entityId);
+            ++m_mergedVisualCount;
+            return;
+        }
         size_t nameSuffixIndex = 0; // For disambiguation when multiple unnamed visuals are present. The order does not matter here
 
         for (auto visual : link->visual_array)
@@ -54,7 +123,60 @@ namespace ROS2
         }
     }
 
-    void VisualsMaker::AddVisual(urdf::VisualSharedPtr visual, AZ::EntityId entityId, const AZStd::string& generatedName) const
+    bool VisualsMaker::CanMergeIntoLinkEntity(urdf::VisualSharedPtr visual) const
+    {
+        // Shape visuals are not merged, since a shape component of the link entity would be taken by its shape colliders.
+        // A scaled mesh needs the scale of its own entity, which would scale the whole link otherwise.
+        if (!visual || !visual->geometry || visual->geometry->type != urdf::Geometry::MESH)
+        {
+            return false;
+        }
+        auto meshGeometry = std::dynamic_pointer_cast<urdf::Mesh>(visual->geometry);
+        if (!meshGeometry || !URDF::TypeConversions::ConvertVector3(meshGeometry->scale).IsClose(AZ::Vector3::CreateOne()))
+        {
+            return false;
+        }
+        const AZ::Transform origin = URDF::TypeConversions::ConvertPose(visual->origin);
+        return origin.IsClose(AZ::Transform::CreateIdentity());
+    }
+
+    void VisualsMaker::CountVisual(urdf::VisualSharedPtr visual)
+    {
+        if (!visual->geometry || visual->geometry->type != urdf::Geometry::MESH)
+        {
+            return;
+        }
+        auto meshGeometry = std::dynamic_pointer_cast<urdf::Mesh>(visual->geometry);
+        if (!meshGeometry)
+        {
+            return;
+        }
+        AZStd::string key(meshGeometry->filename.c_str(), meshGeometry->filename.size());
+        if (visual->material)
+        {
+            key += '\t';
+            key += visual->material->name.c_str();
+        }
+        m_meshMaterialPairs.insert(AZStd::move(key));
+        ++m_meshVisualCount;
+    }
+
+    size_t VisualsMaker::GetSubEntityCount() const
+    {
+        return m_subEntityCount;
+    }
+
+    AZStd::string VisualsMaker::GetStatus() const
+    {
+        return AZStd::string::format(
+            "Visuals: %zu meshes of %zu distinct mesh and material pairs, %zu sub-entities, %zu visuals held by link entities\n",
+            m_meshVisualCount,
+            m_meshMaterialPairs.size(),
+            m_subEntityCount,
+            m_mergedVisualCount);
+    }
+
+    void VisualsMaker::AddVisual(urdf::VisualSharedPtr visual, AZ::EntityId entityId, const AZStd::string& generatedName)
     {
         if (!visual)
         { // It is ok not to have a visual in a link
@@ -79,15 +201,16 @@ namespace ROS2
             return;
         }
         auto visualEntityId = createEntityResult.GetValue();
+        ++m_subEntityCount;
+        CountVisual(visual);
+        // Apply transform as per origin
+        PrefabMakerUtils::SetEntityTransformLocal(visual->origin, visualEntityId);
         AddVisualToEntity(visual, visualEntityId);
         AddMaterialForVisual(visual, visualEntityId);
     }
 
     void VisualsMaker::AddVisualToEntity(urdf::VisualSharedPtr visual, AZ::EntityId entityId) const
     {
-        // Apply transform as per origin
-        PrefabMakerUtils::SetEntityTransformLocal(visual->origin, entityId);
-
         AZ::Entity* entity = AzToolsFramework::GetEntityById(entityId);
         auto geometry = visual->geometry;
         switch (geometry->type)
@@ -155,11 +278,20 @@ namespace ROS2
                     }
 
                     entity->Activate();
-                    // Set asset path
-                    AZ::Render::MeshComponentRequestBus::Event(
-                        entityId,
-                        &AZ::Render::MeshComponentRequestBus::Events::SetModelAssetPath,
-                        asset->m_sourceAssetRelativePath.c_str());
+                    // Visuals of the same mesh reference the same model asset, found once by PrepareVisuals
+                    const auto modelAsset = m_modelAssets.find(asset->m_sourceAssetGlobalPath);
+                    if (modelAsset != m_modelAssets.end() && modelAsset->second.IsValid())
+                    {
+                        AZ::Render::MeshComponentRequestBus::Event(
+                            entityId, &AZ::Render::MeshComponentRequestBus::Events::SetModelAssetId, modelAsset->second);
+                    }
+                    else
+                    {
+                        AZ::Render::MeshComponentRequestBus::Event(
+                            entityId,
+                            &AZ::Render::MeshComponentRequestBus::Events::SetModelAssetPath,
+                            asset->m_sourceAssetRelativePath.c_str());
+                    }
 
                     // Set scale, uniform or non-uniform
                     if (isUniformScale)
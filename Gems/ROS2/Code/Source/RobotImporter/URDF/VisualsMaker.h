@@ -11,13 +11,17 @@
 #include "UrdfParser.h"
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
 
 namespace ROS2
 {
-    //! Populates a given entity with all the contents of the <visual> tag in robot description
+    //! Populates a given entity with all the contents of the <visual> tag in robot description.
+    //! Visuals of the same mesh share one model asset, found once for the mesh, so that the renderer can instance repeated meshes.
     class VisualsMaker
     {
     public:
@@ -25,18 +29,42 @@ namespace ROS2
             const std::map<std::string, urdf::MaterialSharedPtr>& materials,
             const AZStd::shared_ptr<Utils::UrdfAssetMap>& urdfAssetsMapping);
 
+        //! Finds model assets of the link visual meshes, so that adding visuals does not need to query the asset system.
+        //! It is safe to call this function for different links concurrently.
+        //! @param link A parsed URDF tree link node which could hold information about visuals.
+        void PrepareVisuals(urdf::LinkSharedPtr link);
+
         //! Add zero, one or many visual elements to a given entity (depending on link content).
-        //! Note that a sub-entity will be added to hold each visual (since they can have different transforms).
+        //! Note that a sub-entity will be added to hold each visual (since they can have different transforms), unless the link
+        //! has a single mesh visual at the origin of the link, which is then added to the link entity itself.
         //! @param link A parsed URDF tree link node which could hold information about visuals.
         //! @param entityId A non-active entity which will be affected.
-        void AddVisuals(urdf::LinkSharedPtr link, AZ::EntityId entityId) const;
+        void AddVisuals(urdf::LinkSharedPtr link, AZ::EntityId entityId);
+
+        //! Get the number of entities created to hold visuals.
+        size_t GetSubEntityCount() const;
+
+        //! Get descriptive status of visuals, which can be understood by the user.
+        AZStd::string GetStatus() const;
 
     private:
-        void AddVisual(urdf::VisualSharedPtr visual, AZ::EntityId entityId, const AZStd::string& generatedName) const;
+        void AddVisual(urdf::VisualSharedPtr visual, AZ::EntityId entityId, const AZStd::string& generatedName);
         void AddVisualToEntity(urdf::VisualSharedPtr visual, AZ::EntityId entityId) const;
         void AddMaterialForVisual(urdf::VisualSharedPtr visual, AZ::EntityId entityId) const;
+        //! Counts the visual towards repeated mesh and material pairs.
+        void CountVisual(urdf::VisualSharedPtr visual);
+        //! Gets if the visual can be held by the link entity without a sub-entity.
+        bool CanMergeIntoLinkEntity(urdf::VisualSharedPtr visual) const;
+        AZ::Data::AssetId FindModelAsset(const AZStd::string& azMeshPath) const;
 
         AZStd::unordered_map<AZStd::string, urdf::MaterialSharedPtr> m_materials;
         AZStd::shared_ptr<Utils::UrdfAssetMap> m_urdfAssetsMapping;
+        AZStd::mutex m_modelAssetsMutex;
+        //! Model products found by PrepareVisuals, by global path of the source mesh. Shared by all visuals of the mesh.
+        AZStd::unordered_map<AZStd::string, AZ::Data::AssetId> m_modelAssets;
+        AZStd::unordered_set<AZStd::string> m_meshMaterialPairs; //!< Distinct pairs of mesh path and material of mesh visuals.
+        size_t m_meshVisualCount = 0;
+        size_t m_subEntityCount = 0;
+        size_t m_mergedVisualCount = 0; //!< Visuals held by link entities.
     };
 } // namespace ROS2
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "URDFBatchImporter.h"
+#include "URDF/UrdfParser.h"
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/string/conversions.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
+
+namespace ROS2
+{
+    namespace Internal
+    {
+        bool HasCapitalizedExtension(const AZ::IO::Path& filename, const char* extension)
+        {
+            AZStd::string fileExtension{ filename.Extension().Native() };
+            AZStd::to_upper(fileExtension.begin(), fileExtension.end());
+            return fileExtension == extension;
+        }
+    } // namespace Internal
+
+    size_t URDFBatchImportReport::GetSucceededCount() const
+    {
+        return AZStd::count_if(
+            m_results.begin(),
+            m_results.end(),
+            [](const URDFImportResult& result)
+            {
+                return result.m_success;
+            });
+    }
+
+    double URDFBatchImportReport::GetRobotsPerMinute() const
+    {
+        const double minutes = aznumeric_cast<double>(m_duration.count()) / 60000.0;
+        return minutes > 0.0 ? aznumeric_cast<double>(GetSucceededCount()) / minutes : 0.0;
+    }
+
+    URDFBatchImporter::~URDFBatchImporter()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    bool URDFBatchImporter::ImportUrdf(const AZStd::vector<URDFImportRequest>& requests, URDFBatchImportCallback doneCallback)
+    {
+        if (m_importing)
+        {
+            AZ_Warning("URDFBatchImporter", false, "Another import is running, %zu robots are not imported\n", requests.size());
+            return false;
+        }
+        m_importing = true;
+        m_startTime = AZStd::chrono::steady_clock::now();
+        m_doneCallback = AZStd::move(doneCallback);
+        m_readyCount = 0;
+        m_robots.clear();
+        m_robots.resize(requests.size());
+
+        // All robots are matched with one snapshot of the source assets index
+        const AZStd::unordered_map<AZ::u64, Utils::AvailableAsset> availableAssets = Utils::GetInterestingSourceAssetsHashes();
+        {
+            AZ::JobCompletion completion;
+            for (size_t i = 0; i < requests.size(); ++i)
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [this, &requests, &availableAssets, i]()
+                    {
+                        LoadRobot(requests[i], availableAssets, m_robots[i]);
+                    },
+                    true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+        AZ_Printf(
+            "URDFBatchImporter",
+            "Loaded %zu robots in %lld ms\n",
+            requests.size(),
+            static_cast<long long>(
+                AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - m_startTime).count()));
+
+        // Collider meshes of all robots are requested before any wait, so the Asset Processor builds them in one go
+        for (Robot& robot : m_robots)
+        {
+            if (!robot.m_model)
+            {
+                ++m_readyCount;
+                continue;
+            }
+            robot.m_prefabMaker = AZStd::make_unique<URDFPrefabMaker>(
+                robot.m_result.m_filePath,
+                robot.m_model,
+                robot.m_result.m_prefabPath,
+                robot.m_urdfAssetsMapping,
+                robot.m_colliderMeshSettings,
+                robot.m_mergeFixedJoints);
+            robot.m_prefabMaker->LoadURDF(
+                [this]()
+                {
+                    ++m_readyCount;
+                });
+        }
+
+        // Prefabs are created on the main thread once all meshes are ready
+        AZ::TickBus::Handler::BusConnect();
+        return true;
+    }
+
+    bool URDFBatchImporter::IsImporting() const
+    {
+        return m_importing;
+    }
+
+    void URDFBatchImporter::LoadRobot(
+        const URDFImportRequest& request, const AZStd::unordered_map<AZ::u64, Utils::AvailableAsset>& availableAssets, Robot& robot)
+    {
+        robot.m_result.m_filePath = request.m_filePath;
+        robot.m_colliderMeshSettings = request.m_colliderMeshSettings;
+        robot.m_mergeFixedJoints = request.m_mergeFixedJoints;
+        const AZ::IO::Path filePath(request.m_filePath);
+
+        urdf::ModelInterfaceSharedPtr model;
+        if (Internal::HasCapitalizedExtension(filePath, ".XACRO"))
+        {
+            const Utils::xacro::ExecutionOutcome outcome = Utils::xacro::ParseXacro(request.m_filePath, request.m_params, &m_xacroCache);
+            if (!outcome)
+            {
+                robot.m_result.m_status = AZStd::string::format(
+                    "XACRO parsing failed\n%s\n%s", outcome.m_called.c_str(), outcome.m_logErrorOutput.c_str());
+                return;
+            }
+            model = outcome.m_urdfHandle;
+        }
+        else if (Internal::HasCapitalizedExtension(filePath, ".URDF"))
+        {
+            model = UrdfParser::ParseFromFile(request.m_filePath);
+        }
+        else
+        {
+            robot.m_result.m_status = "Unknown file extension, expected .urdf or .xacro";
+            return;
+        }
+
+        if (!model || !model->getRoot())
+        {
+            robot.m_result.m_status = "The URDF was not opened";
+            return;
+        }
+
+        const AZStd::unordered_set<AZStd::string> meshNames = Utils::GetMeshesFilenames(model->getRoot(), true, true);
+        robot.m_urdfAssetsMapping =
+            AZStd::make_shared<Utils::UrdfAssetMap>(Utils::FindAssetsForUrdf(meshNames, request.m_filePath, availableAssets));
+
+        AZ::IO::Path prefabPath(request.m_prefabPath);
+        if (prefabPath.empty())
+        {
+            const AZStd::string robotName(model->getName().c_str(), model->getName().size());
+            prefabPath = AZ::IO::Path("Assets") / "Importer" / (robotName + ".prefab");
+        }
+        if (prefabPath.IsRelative())
+        {
+            prefabPath = AZ::IO::Path(AZ::Utils::GetProjectPath()) / prefabPath;
+        }
+        robot.m_result.m_prefabPath = prefabPath.String();
+        robot.m_model = model;
+    }
+
+    void URDFBatchImporter::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (m_readyCount < m_robots.size())
+        {
+            return;
+        }
+        AZ::TickBus::Handler::BusDisconnect();
+        FinishImport();
+    }
+
+    void URDFBatchImporter::FinishImport()
+    {
+        URDFBatchImportReport report;
+        report.m_results.reserve(m_robots.size());
+        for (Robot& robot : m_robots)
+        {
+            if (robot.m_prefabMaker)
+            {
+                const auto prefabOutcome = robot.m_prefabMaker->CreatePrefabFromURDF();
+                robot.m_result.m_success = prefabOutcome.IsSuccess();
+                robot.m_result.m_status = robot.m_prefabMaker->GetStatus();
+                if (!prefabOutcome.IsSuccess())
+                {
+                    robot.m_result.m_status = "Failed to create prefab\n" + prefabOutcome.GetError() + "\n" + robot.m_result.m_status;
+                }
+            }
+            report.m_results.push_back(AZStd::move(robot.m_result));
+        }
+        report.m_duration =
+            AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - m_startTime);
+
+        m_robots.clear();
+        m_importing = false;
+
+        AZ_Printf(
+            "URDFBatchImporter",
+            "Imported %zu of %zu robots in %.1f s, %.1f robots per minute\n",
+            report.GetSucceededCount(),
+            report.m_results.size(),
+            aznumeric_cast<double>(report.m_duration.count()) / 1000.0,
+            report.GetRobotsPerMinute());
+
+        // The callback may start another import
+        URDFBatchImportCallback doneCallback = AZStd::move(m_doneCallback);
+        m_doneCallback = nullptr;
+        if (doneCallback)
+        {
+            doneCallback(report);
+        }
+    }
+} // namespace ROS2
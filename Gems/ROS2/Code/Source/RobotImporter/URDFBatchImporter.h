@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "URDF/URDFPrefabMaker.h"
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <RobotImporter/Utils/SourceAssetsStorage.h>
+#include <RobotImporter/xacro/XacroUtils.h>
+
+namespace ROS2
+{
+    //! A robot description to import without the UI.
+    struct URDFImportRequest
+    {
+        AZStd::string m_filePath; //!< URDF or xacro file.
+        Utils::xacro::Params m_params; //!< Xacro arguments, defaults from the file are used for the missing ones.
+        AZStd::string m_prefabPath; //!< Prefab to write, relative to the project. Assets/Importer/<robot name>.prefab if empty.
+        ColliderMeshSettings m_colliderMeshSettings; //!< How mesh colliders are cooked.
+        bool m_mergeFixedJoints = false; //!< Merge links attached by fixed joints into their parents.
+    };
+
+    //! Outcome of the import of a single robot.
+    struct URDFImportResult
+    {
+        AZStd::string m_filePath;
+        AZStd::string m_prefabPath;
+        bool m_success = false;
+        AZStd::string m_status; //!< Status of the prefab maker, or the reason the robot could not be loaded.
+    };
+
+    //! Outcome of a batch import.
+    struct URDFBatchImportReport
+    {
+        //! Number of robots written to prefabs.
+        size_t GetSucceededCount() const;
+
+        //! Throughput of the whole import, from the start of loading to the last prefab written.
+        double GetRobotsPerMinute() const;
+
+        AZStd::vector<URDFImportResult> m_results; //!< In the order of requests.
+        AZStd::chrono::milliseconds m_duration{ 0 };
+    };
+
+    using URDFBatchImportCallback = AZStd::function<void(const URDFBatchImportReport&)>;
+
+    //! Imports robot descriptions to prefabs without any UI, e.g. to regenerate prefabs in asset pipelines.
+    //! The import runs in three phases:
+    //! - robots are parsed and their meshes are matched with assets concurrently on the job system, sharing one snapshot of
+    //!   source assets,
+    //! - collider meshes of all robots are requested at once and the Asset Processor builds them in a single wait,
+    //! - prefabs are created and saved one after another on the main thread. Existing prefabs are overwritten.
+    class URDFBatchImporter : private AZ::TickBus::Handler
+    {
+    public:
+        URDFBatchImporter() = default;
+        ~URDFBatchImporter();
+
+        //! Starts an import. It must be called on the main thread, the import continues on ticks of the main thread.
+        //! @param requests robots to import.
+        //! @param doneCallback called on the main thread with the report once all prefabs are written.
+        //! @returns false if another import is running.
+        bool ImportUrdf(const AZStd::vector<URDFImportRequest>& requests, URDFBatchImportCallback doneCallback);
+
+        //! Gets if an import is running.
+        bool IsImporting() const;
+
+    private:
+        struct Robot
+        {
+            URDFImportResult m_result;
+            urdf::ModelInterfaceSharedPtr m_model;
+            AZStd::shared_ptr<Utils::UrdfAssetMap> m_urdfAssetsMapping;
+            ColliderMeshSettings m_colliderMeshSettings;
+            bool m_mergeFixedJoints = false;
+            AZStd::unique_ptr<URDFPrefabMaker> m_prefabMaker;
+        };
+
+        //! Parses the robot description and matches its meshes with assets, safe to call for many robots at once.
+        void LoadRobot(
+            const URDFImportRequest& request, const AZStd::unordered_map<AZ::u64, Utils::AvailableAsset>& availableAssets, Robot& robot);
+
+        //! Creates prefabs of all loaded robots and reports the import.
+        void FinishImport();
+
+        // AZ::TickBus::Handler overrides
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        bool m_importing = false;
+        AZStd::vector<Robot> m_robots;
+        AZStd::atomic<size_t> m_readyCount{ 0 }; //!< Robots with all collider meshes built, or which failed to load.
+        AZStd::chrono::steady_clock::time_point m_startTime;
+        URDFBatchImportCallback m_doneCallback;
+        Utils::xacro::ExpansionCache m_xacroCache;
+    };
+} // namespace ROS2
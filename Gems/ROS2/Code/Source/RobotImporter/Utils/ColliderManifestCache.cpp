@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ColliderManifestCache.h"
+#include "SourceAssetsStorage.h"
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace ROS2::Utils
+{
+    namespace Internal
+    {
+        constexpr char ColliderManifestCacheHeader[] = "ROS2ColliderManifests 1";
+    } // namespace Internal
+
+    void ColliderManifestCache::Activate(const AZStd::string& cacheFilePath)
+    {
+        {
+            AZStd::lock_guard lock{ m_mutex };
+            m_filePath.clear();
+            if (!cacheFilePath.empty())
+            {
+                AZ::IO::FixedMaxPath resolvedPath;
+                if (auto* fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO && fileIO->ResolvePath(resolvedPath, cacheFilePath.c_str()))
+                {
+                    m_filePath = resolvedPath.String();
+                }
+                AZ_Warning(
+                    "ColliderManifestCache", !m_filePath.empty(), "Cannot resolve %s, the cache is not saved", cacheFilePath.c_str());
+            }
+            Load();
+        }
+
+        if (ColliderManifestCacheInterface::Get() == nullptr)
+        {
+            ColliderManifestCacheInterface::Register(this);
+        }
+    }
+
+    void ColliderManifestCache::Deactivate()
+    {
+        if (ColliderManifestCacheInterface::Get() == this)
+        {
+            ColliderManifestCacheInterface::Unregister(this);
+        }
+        Save();
+    }
+
+    bool ColliderManifestCache::IsUpToDate(
+        const AZStd::string& meshPath, AZ::u64 meshHash, const AZStd::string& settingsKey, const AZ::IO::Path& manifestPath)
+    {
+        AZStd::lock_guard lock{ m_mutex };
+        const auto entry = m_entries.find(meshPath);
+        return entry != m_entries.end() && entry->second.m_meshHash == meshHash && entry->second.m_settingsKey == settingsKey &&
+            entry->second.m_manifestHash == GetFileHash(manifestPath.String());
+    }
+
+    void ColliderManifestCache::Store(
+        const AZStd::string& meshPath, AZ::u64 meshHash, const AZStd::string& settingsKey, AZ::u64 manifestHash)
+    {
+        AZStd::lock_guard lock{ m_mutex };
+        m_entries[meshPath] = Entry{ meshHash, settingsKey, manifestHash };
+        m_modified = true;
+    }
+
+    void ColliderManifestCache::Save()
+    {
+        AZStd::lock_guard lock{ m_mutex };
+        if (m_filePath.empty() || !m_modified)
+        {
+            return;
+        }
+
+        AZStd::string content = Internal::ColliderManifestCacheHeader;
+        content += '\n';
+        for (const auto& [meshPath, entry] : m_entries)
+        {
+            content += AZStd::string::format(
+                "%016llx\t%s\t%016llx\t%s\n",
+                static_cast<unsigned long long>(entry.m_meshHash),
+                entry.m_settingsKey.c_str(),
+                static_cast<unsigned long long>(entry.m_manifestHash),
+                meshPath.c_str());
+        }
+
+        const AZ::IO::Path cacheDirectory = AZ::IO::PathView(m_filePath).ParentPath();
+        if (!cacheDirectory.empty() && !AZ::IO::SystemFile::Exists(cacheDirectory.c_str()))
+        {
+            AZ::IO::SystemFile::CreateDir(cacheDirectory.c_str());
+        }
+        auto outcome = AZ::Utils::WriteFile(content, m_filePath);
+        AZ_Warning("ColliderManifestCache", outcome.IsSuccess(), "Cannot write %s", m_filePath.c_str());
+        m_modified = !outcome.IsSuccess();
+    }
+
+    void ColliderManifestCache::Load()
+    {
+        m_entries.clear();
+        m_modified = false;
+        if (m_filePath.empty() || !AZ::IO::SystemFile::Exists(m_filePath.c_str()))
+        {
+            return;
+        }
+
+        auto content = AZ::Utils::ReadFile<AZStd::string>(m_filePath);
+        if (!content.IsSuccess())
+        {
+            AZ_Warning("ColliderManifestCache", false, "Cannot read %s: %s", m_filePath.c_str(), content.GetError().c_str());
+            return;
+        }
+
+        AZStd::vector<AZStd::string> lines;
+        AZ::StringFunc::Tokenize(content.GetValue(), lines, '\n');
+        if (lines.empty() || lines.front() != Internal::ColliderManifestCacheHeader)
+        {
+            return;
+        }
+
+        AZStd::vector<AZStd::string> fields;
+        for (size_t i = 1; i < lines.size(); ++i)
+        {
+            fields.clear();
+            AZ::StringFunc::Tokenize(lines[i], fields, '\t', true, true);
+            if (fields.size() == 4)
+            {
+                m_entries[fields[3]] = Entry{ AZStd::stoull(fields[0], nullptr, 16), fields[1], AZStd::stoull(fields[2], nullptr, 16) };
+            }
+        }
+    }
+} // namespace ROS2::Utils
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+namespace ROS2::Utils
+{
+    //! Collider manifests written by the importer, kept between imports and between editor sessions.
+    //! A manifest is reused when the source mesh, the collider settings and the manifest itself have not changed since it was
+    //! written, so that the mesh scene is not loaded again and the Asset Processor finds the collider mesh up to date.
+    class ColliderManifestCache
+    {
+    public:
+        AZ_RTTI(ColliderManifestCache, "{BB84A173-CE9B-4107-A931-ED260EAA2EE1}");
+
+        ColliderManifestCache() = default;
+        virtual ~ColliderManifestCache() = default;
+
+        //! Loads the cache and makes it available through ColliderManifestCacheInterface.
+        //! @param cacheFilePath file to keep the cache in, may start with an alias. The cache is not persisted if empty.
+        void Activate(const AZStd::string& cacheFilePath);
+
+        //! Saves the cache and makes it unavailable.
+        void Deactivate();
+
+        //! Checks if the manifest was written by the importer for the same mesh content and settings, and was not changed since.
+        //! @param meshPath global path of the source mesh.
+        //! @param meshHash content hash of the source mesh.
+        //! @param settingsKey key of the collider settings, see ColliderMeshSettings::GetKey.
+        //! @param manifestPath path of the collider manifest of the mesh.
+        bool IsUpToDate(
+            const AZStd::string& meshPath, AZ::u64 meshHash, const AZStd::string& settingsKey, const AZ::IO::Path& manifestPath);
+
+        //! Remembers the manifest written for the mesh content and settings.
+        void Store(const AZStd::string& meshPath, AZ::u64 meshHash, const AZStd::string& settingsKey, AZ::u64 manifestHash);
+
+        //! Writes the cache to its file, if it has changed.
+        void Save();
+
+    private:
+        struct Entry
+        {
+            AZ::u64 m_meshHash = 0;
+            AZStd::string m_settingsKey;
+            AZ::u64 m_manifestHash = 0;
+        };
+
+        void Load();
+
+        AZStd::mutex m_mutex;
+        bool m_modified = false; //!< The cache differs from its file.
+        AZStd::string m_filePath;
+        AZStd::unordered_map<AZStd::string, Entry> m_entries; //!< Keyed by global path of the source mesh.
+    };
+
+    using ColliderManifestCacheInterface = AZ::Interface<ColliderManifestCache>;
+} // namespace ROS2::Utils
@@ -10,6 +10,8 @@
 #include "TypeConversions.h"
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/std/string/regex.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
@@ -46,12 +48,23 @@ namespace ROS2
         return false;
     }
 
+    bool Utils::IsMecanumWheelURDFHeuristics(const urdf::LinkConstSharedPtr& link)
+    {
+        if (!IsWheelURDFHeuristics(link))
+        {
+            return false;
+        }
+        const AZStd::regex mecanum_regex("(?i)mecanum|omni");
+        const AZStd::string link_name(link->name.c_str(), link->name.size());
+        AZStd::smatch match;
+        return AZStd::regex_search(link_name, match, mecanum_regex);
+    }
+
     AZ::Transform Utils::GetWorldTransformURDF(const urdf::LinkSharedPtr& link, AZ::Transform t)
     {
-        if (link->getParent() != nullptr)
+        for (urdf::LinkSharedPtr currentLink = link; currentLink->getParent() != nullptr; currentLink = currentLink->getParent())
         {
-            t = URDF::TypeConversions::ConvertPose(link->parent_joint->parent_to_joint_origin_transform) * t;
-            return GetWorldTransformURDF(link->getParent(), t);
+            t = URDF::TypeConversions::ConvertPose(currentLink->parent_joint->parent_to_joint_origin_transform) * t;
         }
         return t;
     }
@@ -91,6 +104,135 @@ namespace ROS2
         return joints;
     }
 
+    AZStd::vector<Utils::LinkTableEntry> Utils::FlattenLinks(const urdf::LinkSharedPtr& rootLink)
+    {
+        AZStd::vector<LinkTableEntry> table;
+        if (!rootLink)
+        {
+            return table;
+        }
+        table.push_back(LinkTableEntry{ rootLink, InvalidLinkIndex, AZ::Transform::Identity() });
+        // Breadth first: the table itself is the queue of links whose children are still to be added
+        for (LinkIndex parentIndex = 0; parentIndex < table.size(); ++parentIndex)
+        {
+            // Copy the pointer, the entry may move when the table grows
+            const urdf::LinkSharedPtr parentLink = table[parentIndex].m_link;
+            for (const urdf::LinkSharedPtr& childLink : parentLink->child_links)
+            {
+                AZ::Transform worldTransform = table[parentIndex].m_worldTransform;
+                if (childLink->parent_joint)
+                {
+                    worldTransform *= URDF::TypeConversions::ConvertPose(childLink->parent_joint->parent_to_joint_origin_transform);
+                }
+                table.push_back(LinkTableEntry{ childLink, parentIndex, worldTransform });
+            }
+        }
+        return table;
+    }
+
+    Utils::LinkTransformCache::LinkTransformCache(const urdf::LinkSharedPtr& rootLink)
+        : m_links(FlattenLinks(rootLink))
+    {
+        m_linkIndices.reserve(m_links.size());
+        for (LinkIndex linkIndex = 0; linkIndex < m_links.size(); ++linkIndex)
+        {
+            const std::string& linkName = m_links[linkIndex].m_link->name;
+            m_linkIndices.emplace(AZStd::string(linkName.c_str(), linkName.size()), linkIndex);
+        }
+    }
+
+    AZ::Transform Utils::LinkTransformCache::GetWorldTransform(const AZStd::string& linkName) const
+    {
+        const LinkIndex linkIndex = GetLinkIndex(linkName);
+        return linkIndex == InvalidLinkIndex ? AZ::Transform::Identity() : m_links[linkIndex].m_worldTransform;
+    }
+
+    AZ::Transform Utils::LinkTransformCache::GetWorldTransform(const urdf::LinkConstSharedPtr& link) const
+    {
+        return link ? GetWorldTransform(AZStd::string(link->name.c_str(), link->name.size())) : AZ::Transform::Identity();
+    }
+
+    Utils::LinkIndex Utils::LinkTransformCache::GetLinkIndex(const AZStd::string& linkName) const
+    {
+        const auto foundLink = m_linkIndices.find(linkName);
+        return foundLink == m_linkIndices.end() ? InvalidLinkIndex : foundLink->second;
+    }
+
+    const AZStd::vector<Utils::LinkTableEntry>& Utils::LinkTransformCache::GetLinks() const
+    {
+        return m_links;
+    }
+
+    AZStd::vector<Utils::LinkIndex> Utils::GetFixedJointBodies(const AZStd::vector<LinkTableEntry>& links)
+    {
+        AZStd::vector<LinkIndex> bodies;
+        bodies.reserve(links.size());
+        for (LinkIndex linkIndex = 0; linkIndex < links.size(); ++linkIndex)
+        {
+            const LinkTableEntry& entry = links[linkIndex];
+            const bool isFixed = entry.m_parentIndex != InvalidLinkIndex && entry.m_link->parent_joint &&
+                entry.m_link->parent_joint->type == urdf::Joint::FIXED;
+            // Parents come before their children in the table, the body of the parent is already known
+            bodies.push_back(isFixed ? bodies[entry.m_parentIndex] : linkIndex);
+        }
+        return bodies;
+    }
+
+    urdf::InertialSharedPtr Utils::CombineInertials(const AZStd::vector<AZStd::pair<urdf::InertialSharedPtr, AZ::Transform>>& inertials)
+    {
+        struct BodyInertial
+        {
+            float m_mass;
+            AZ::Vector3 m_centerOfMass; //!< In the frame of the body.
+            AZ::Matrix3x3 m_inertiaTensor; //!< About the center of mass, in axes of the body.
+        };
+        AZStd::vector<BodyInertial> parts;
+        float totalMass = 0.0f;
+        AZ::Vector3 weightedCenters = AZ::Vector3::CreateZero();
+        for (const auto& [inertial, linkToBody] : inertials)
+        {
+            if (!inertial)
+            {
+                continue;
+            }
+            const AZ::Transform inertialToBody = linkToBody * URDF::TypeConversions::ConvertPose(inertial->origin);
+            const AZ::Matrix3x3 rotation = AZ::Matrix3x3::CreateFromQuaternion(inertialToBody.GetRotation());
+            const AZ::Matrix3x3 tensor = AZ::Matrix3x3::CreateFromRows(
+                AZ::Vector3(inertial->ixx, inertial->ixy, inertial->ixz),
+                AZ::Vector3(inertial->ixy, inertial->iyy, inertial->iyz),
+                AZ::Vector3(inertial->ixz, inertial->iyz, inertial->izz));
+            const float mass = aznumeric_cast<float>(inertial->mass);
+            parts.push_back(BodyInertial{ mass, inertialToBody.GetTranslation(), rotation * tensor * rotation.GetTranspose() });
+            totalMass += mass;
+            weightedCenters += inertialToBody.GetTranslation() * mass;
+        }
+        if (parts.empty())
+        {
+            return nullptr;
+        }
+
+        const AZ::Vector3 centerOfMass = totalMass > 0.0f ? weightedCenters / totalMass : parts.front().m_centerOfMass;
+        AZ::Matrix3x3 inertiaTensor = AZ::Matrix3x3::CreateZero();
+        for (const BodyInertial& part : parts)
+        {
+            // Parallel axis theorem: I + m * (|d|^2 * E - d * d^T)
+            const AZ::Vector3 d = part.m_centerOfMass - centerOfMass;
+            const AZ::Matrix3x3 outer = AZ::Matrix3x3::CreateFromColumns(d * d.GetX(), d * d.GetY(), d * d.GetZ());
+            inertiaTensor += part.m_inertiaTensor + (AZ::Matrix3x3::CreateScale(AZ::Vector3(d.GetLengthSq())) - outer) * part.m_mass;
+        }
+
+        auto combined = std::make_shared<urdf::Inertial>();
+        combined->mass = totalMass;
+        combined->origin.position = urdf::Vector3(centerOfMass.GetX(), centerOfMass.GetY(), centerOfMass.GetZ());
+        combined->ixx = inertiaTensor.GetElement(0, 0);
+        combined->ixy = inertiaTensor.GetElement(0, 1);
+        combined->ixz = inertiaTensor.GetElement(0, 2);
+        combined->iyy = inertiaTensor.GetElement(1, 1);
+        combined->iyz = inertiaTensor.GetElement(1, 2);
+        combined->izz = inertiaTensor.GetElement(2, 2);
+        return combined;
+    }
+
     AZStd::unordered_set<AZStd::string> Utils::GetMeshesFilenames(const urdf::LinkConstSharedPtr& rootLink, bool visual, bool colliders)
     {
         AZStd::unordered_set<AZStd::string> filenames;
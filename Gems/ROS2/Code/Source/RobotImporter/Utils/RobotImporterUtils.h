@@ -11,8 +11,11 @@
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/function/function_template.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/utils.h>
 #include <RobotImporter/URDF/UrdfParser.h>
 
 namespace ROS2
@@ -33,7 +36,13 @@ namespace ROS2
         //! @return true if the link is likely a wheel link.
         bool IsWheelURDFHeuristics(const urdf::LinkConstSharedPtr& link);
 
-        //! The recursive function for the given link goes through URDF and finds world-to-entity transformation for us.
+        //! Determine whether a given link is likely a mecanum (or omni) wheel link, which can be driven by a mecanum vehicle model.
+        //! @param link the link that will be subjected to the heuristic.
+        //! @return true if the link is likely a wheel link and its name refers to mecanum or omni wheels.
+        bool IsMecanumWheelURDFHeuristics(const urdf::LinkConstSharedPtr& link);
+
+        //! The function for the given link goes up through URDF to the root link and finds world-to-entity transformation for us.
+        //! It walks the whole path to the root on each call. Use LinkTransformCache to get transforms of many links.
         //! @param link pointer to URDF link that root of robot description
         //! @param t initial transform, should be identity for non-recursive call.
         //! @returns root to entity transform
@@ -50,6 +59,72 @@ namespace ROS2
         //! @returns mapping from joint name to joint pointer
         AZStd::unordered_map<AZStd::string, urdf::JointSharedPtr> GetAllJoints(const std::vector<urdf::LinkSharedPtr>& childLinks);
 
+        //! Index of a link in the table made by FlattenLinks.
+        using LinkIndex = size_t;
+        constexpr LinkIndex InvalidLinkIndex = AZStd::numeric_limits<LinkIndex>::max();
+
+        //! A link of a robot description as an entry of a flat table.
+        struct LinkTableEntry
+        {
+            urdf::LinkSharedPtr m_link;
+            LinkIndex m_parentIndex = InvalidLinkIndex; //!< Index of the parent link, InvalidLinkIndex for the root link.
+            AZ::Transform m_worldTransform = AZ::Transform::Identity(); //!< Root to link transform, same as GetWorldTransformURDF.
+        };
+
+        //! Flatten the tree of links to a table in a single pass, without recursion.
+        //! Each link comes after its parent in the table, the root link is the first entry.
+        //! The joint between a link and its parent is the parent_joint of the link.
+        //! @param rootLink pointer to URDF link that is a root of robot description
+        //! @returns table of all links of the robot description
+        AZStd::vector<LinkTableEntry> FlattenLinks(const urdf::LinkSharedPtr& rootLink);
+
+        //! World transforms of all links of a robot description, computed once in a single pass over the tree of links.
+        //! The cache is meant to be built right after the robot description is parsed and shared by everything that needs transforms.
+        class LinkTransformCache
+        {
+        public:
+            LinkTransformCache() = default;
+
+            //! Build the cache for a robot description.
+            //! @param rootLink pointer to URDF link that is a root of robot description
+            explicit LinkTransformCache(const urdf::LinkSharedPtr& rootLink);
+
+            //! Get the transform of a link.
+            //! @param linkName name of the link.
+            //! @returns root to link transform, same as GetWorldTransformURDF, or identity for unknown links.
+            AZ::Transform GetWorldTransform(const AZStd::string& linkName) const;
+
+            //! Get the transform of a link.
+            //! @param link pointer to URDF link.
+            //! @returns root to link transform, same as GetWorldTransformURDF, or identity for unknown links.
+            AZ::Transform GetWorldTransform(const urdf::LinkConstSharedPtr& link) const;
+
+            //! Get index of a link in the table of links.
+            //! @param linkName name of the link.
+            //! @returns index of the link or InvalidLinkIndex for unknown links.
+            LinkIndex GetLinkIndex(const AZStd::string& linkName) const;
+
+            //! Get the table of links, as made by FlattenLinks.
+            const AZStd::vector<LinkTableEntry>& GetLinks() const;
+
+        private:
+            AZStd::vector<LinkTableEntry> m_links;
+            AZStd::unordered_map<AZStd::string, LinkIndex> m_linkIndices;
+        };
+
+        //! Find the link whose rigid body carries each link when links attached by fixed joints are merged into their parents.
+        //! @param links table of links, as made by FlattenLinks.
+        //! @returns for each entry of the table, index of the closest ancestor of the link (or the link itself) which is not attached to
+        //! its parent by a fixed joint.
+        AZStd::vector<LinkIndex> GetFixedJointBodies(const AZStd::vector<LinkTableEntry>& links);
+
+        //! Combine inertials of links which are rigidly attached to each other into the inertial of a single body.
+        //! Masses are summed, the center of mass is the weighted average of centers of mass, and the inertia tensors are moved to the
+        //! common center of mass with the parallel axis theorem.
+        //! @param inertials inertials, which might be null, with transforms from their links to the frame of the body.
+        //! @returns inertial in the frame of the body, with no rotation of its origin, or null if no inertial is given.
+        urdf::InertialSharedPtr CombineInertials(const AZStd::vector<AZStd::pair<urdf::InertialSharedPtr, AZ::Transform>>& inertials);
+
         //! Retrieve all meshes referenced in URDF as unresolved URDF patches.
         //! Note that returned filenames are unresolved URDF patches.
         //! @param visual - search for visual meshes.
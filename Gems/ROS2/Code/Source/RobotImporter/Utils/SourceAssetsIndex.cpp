@@ -0,0 +1,458 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "SourceAssetsIndex.h"
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzToolsFramework/API/EditorAssetSystemAPI.h>
+
+namespace ROS2::Utils
+{
+    namespace Internal
+    {
+        constexpr char IndexHeader[] = "ROS2SourceAssetsIndex 1";
+        constexpr char AzModelExtension[] = ".azmodel";
+
+        bool IsInterestingSourceExtension(const AZ::IO::PathView& sourcePath)
+        {
+            constexpr AZStd::string_view InterestingExtensions[] = { ".dae", ".stl", ".obj", ".fbx" };
+            const AZStd::string_view extension = sourcePath.Extension().Native();
+            return AZStd::find(AZStd::begin(InterestingExtensions), AZStd::end(InterestingExtensions), extension) !=
+                AZStd::end(InterestingExtensions);
+        }
+
+        bool IsMeshProduct(const AZ::Data::AssetInfo& assetInfo)
+        {
+            return assetInfo.m_relativePath.ends_with(AzModelExtension) &&
+                AZ::Data::AssetManager::Instance().GetHandler(assetInfo.m_assetType) != nullptr;
+        }
+    } // namespace Internal
+
+    void SourceAssetsIndex::Activate(const AZStd::string& indexFilePath)
+    {
+        m_indexFilePath.clear();
+        if (!indexFilePath.empty())
+        {
+            AZ::IO::FixedMaxPath resolvedPath;
+            if (auto* fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO && fileIO->ResolvePath(resolvedPath, indexFilePath.c_str()))
+            {
+                m_indexFilePath = resolvedPath.String();
+            }
+            AZ_Warning("SourceAssetsIndex", !m_indexFilePath.empty(), "Cannot resolve %s, the index is not saved", indexFilePath.c_str());
+        }
+        Load();
+
+        if (SourceAssetsIndexInterface::Get() == nullptr)
+        {
+            SourceAssetsIndexInterface::Register(this);
+        }
+        AzFramework::AssetCatalogEventBus::Handler::BusConnect();
+    }
+
+    void SourceAssetsIndex::Deactivate()
+    {
+        AzFramework::AssetCatalogEventBus::Handler::BusDisconnect();
+        if (SourceAssetsIndexInterface::Get() == this)
+        {
+            SourceAssetsIndexInterface::Unregister(this);
+        }
+        Save();
+    }
+
+    AZStd::unordered_map<AZ::u64, AvailableAsset> SourceAssetsIndex::GetSourceAssetsByHash()
+    {
+        Update();
+
+        AZStd::unordered_map<AZ::u64, AvailableAsset> availableAssets;
+        for (const auto& [productPath, product] : m_products)
+        {
+            auto source = m_sources.find(product.m_sourceGlobalPath);
+            if (source == m_sources.end())
+            {
+                continue;
+            }
+
+            const AZ::IO::PathView sourcePath(product.m_sourceGlobalPath);
+            AvailableAsset foundAsset;
+            foundAsset.m_sourceAssetRelativePath = productPath;
+            foundAsset.m_assetId = product.m_assetId;
+            foundAsset.m_sourceAssetGlobalPath = product.m_sourceGlobalPath;
+            foundAsset.m_productAssetRelativePath = productPath;
+            auto [availableAssetIt, inserted] = availableAssets.emplace(source->second.m_hash, foundAsset);
+            if (!inserted)
+            {
+                // probably there is already submesh added. Replace only if there is exact name
+                const AZStd::string stem(sourcePath.Stem().Native());
+                if (productPath.contains(stem + Internal::AzModelExtension))
+                {
+                    availableAssetIt->second = AZStd::move(foundAsset);
+                }
+            }
+        }
+        return availableAssets;
+    }
+
+    void SourceAssetsIndex::Update()
+    {
+        ChangedAssets changedAssets;
+        bool catalogSynced = false;
+        {
+            AZStd::lock_guard lock(m_changedAssetsMutex);
+            changedAssets.swap(m_changedAssets);
+            catalogSynced = m_catalogSynced;
+            m_catalogSynced = true;
+        }
+
+        SourcePaths touchedSources;
+        AZStd::vector<AZ::Data::AssetId> unresolvedAssets;
+        const size_t lookedUpProducts = catalogSynced ? ApplyCatalogChanges(changedAssets, touchedSources, unresolvedAssets)
+                                                      : SyncWithCatalog(changedAssets, touchedSources, unresolvedAssets);
+        const size_t hashedSources = UpdateSources(touchedSources);
+
+        if (!unresolvedAssets.empty())
+        {
+            // Sources may not be known yet, the products are looked up again on the next update
+            AZStd::lock_guard lock(m_changedAssetsMutex);
+            for (const auto& assetId : unresolvedAssets)
+            {
+                m_changedAssets[assetId].m_added = true;
+            }
+        }
+
+        AZ_Printf(
+            "SourceAssetsIndex",
+            "%zu mesh products, %zu looked up, %zu source meshes, %zu hashed\n",
+            m_products.size(),
+            lookedUpProducts,
+            m_sources.size(),
+            hashedSources);
+
+        // Saved right away, so that the work is kept even if the editor does not close cleanly
+        Save();
+    }
+
+    size_t SourceAssetsIndex::SyncWithCatalog(
+        const ChangedAssets& changedAssets, SourcePaths& touchedSources, AZStd::vector<AZ::Data::AssetId>& unresolvedAssets)
+    {
+        // Enumerating the catalog is cheap, looking up sources of products is not
+        AZStd::unordered_map<AZStd::string, AZ::Data::AssetId> catalogProducts;
+        AZ::Data::AssetCatalogRequests::AssetEnumerationCB collectAssetsCb =
+            [&catalogProducts](const AZ::Data::AssetId id, const AZ::Data::AssetInfo& info)
+        {
+            if (Internal::IsMeshProduct(info))
+            {
+                catalogProducts.emplace(info.m_relativePath, id);
+            }
+        };
+        AZ::Data::AssetCatalogRequestBus::Broadcast(
+            &AZ::Data::AssetCatalogRequestBus::Events::EnumerateAssets, nullptr, collectAssetsCb, nullptr);
+
+        AZStd::vector<AZStd::string> removedProducts;
+        for (const auto& [productPath, product] : m_products)
+        {
+            if (!catalogProducts.contains(productPath))
+            {
+                removedProducts.push_back(productPath);
+            }
+        }
+        for (const auto& productPath : removedProducts)
+        {
+            RemoveProduct(productPath, touchedSources);
+        }
+
+        size_t lookedUpProducts = 0;
+        for (const auto& [productPath, assetId] : catalogProducts)
+        {
+            auto product = m_products.find(productPath);
+            if (product != m_products.end() && product->second.m_assetId == assetId && !changedAssets.contains(assetId))
+            {
+                continue;
+            }
+            if (!LookUpProduct(productPath, assetId, touchedSources))
+            {
+                unresolvedAssets.push_back(assetId);
+                continue;
+            }
+            ++lookedUpProducts;
+        }
+
+        // Sources may have been modified while the catalog was not tracked, all of them are checked
+        for (const auto& [sourcePath, source] : m_sources)
+        {
+            touchedSources.insert(sourcePath);
+        }
+        for (const auto& [sourcePath, productCount] : m_sourceProductCounts)
+        {
+            touchedSources.insert(sourcePath);
+        }
+        return lookedUpProducts;
+    }
+
+    size_t SourceAssetsIndex::ApplyCatalogChanges(
+        const ChangedAssets& changedAssets, SourcePaths& touchedSources, AZStd::vector<AZ::Data::AssetId>& unresolvedAssets)
+    {
+        size_t lookedUpProducts = 0;
+        for (const auto& [assetId, changedAsset] : changedAssets)
+        {
+            if (!changedAsset.m_removedProductPath.empty())
+            {
+                // The path may have been taken by another product in the meantime
+                auto product = m_products.find(changedAsset.m_removedProductPath);
+                if (product != m_products.end() && product->second.m_assetId == assetId)
+                {
+                    RemoveProduct(changedAsset.m_removedProductPath, touchedSources);
+                }
+            }
+            if (!changedAsset.m_added)
+            {
+                continue;
+            }
+
+            AZ::Data::AssetInfo assetInfo;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetInfo, &AZ::Data::AssetCatalogRequests::GetAssetInfoById, assetId);
+            if (!assetInfo.m_assetId.IsValid() || !Internal::IsMeshProduct(assetInfo))
+            {
+                continue;
+            }
+            if (!LookUpProduct(assetInfo.m_relativePath, assetId, touchedSources))
+            {
+                unresolvedAssets.push_back(assetId);
+                continue;
+            }
+            ++lookedUpProducts;
+        }
+        return lookedUpProducts;
+    }
+
+    bool SourceAssetsIndex::LookUpProduct(const AZStd::string& productPath, const AZ::Data::AssetId& assetId, SourcePaths& touchedSources)
+    {
+        using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
+        bool pathFound{ false };
+        AZStd::string fullSourcePathStr;
+        AssetSysReqBus::BroadcastResult(
+            pathFound, &AssetSysReqBus::Events::GetFullSourcePathFromRelativeProductPath, productPath, fullSourcePathStr);
+        if (!pathFound)
+        {
+            return false;
+        }
+        if (!Internal::IsInterestingSourceExtension(AZ::IO::PathView(fullSourcePathStr)))
+        {
+            fullSourcePathStr.clear();
+        }
+        SetProduct(productPath, ProductEntry{ assetId, AZStd::move(fullSourcePathStr) }, touchedSources);
+        return true;
+    }
+
+    void SourceAssetsIndex::SetProduct(const AZStd::string& productPath, ProductEntry product, SourcePaths& touchedSources)
+    {
+        RemoveProduct(productPath, touchedSources);
+        if (!product.m_sourceGlobalPath.empty())
+        {
+            ++m_sourceProductCounts[product.m_sourceGlobalPath];
+            touchedSources.insert(product.m_sourceGlobalPath);
+        }
+        m_products.emplace(productPath, AZStd::move(product));
+        m_modified = true;
+    }
+
+    void SourceAssetsIndex::RemoveProduct(const AZStd::string& productPath, SourcePaths& touchedSources)
+    {
+        auto product = m_products.find(productPath);
+        if (product == m_products.end())
+        {
+            return;
+        }
+        const AZStd::string& sourcePath = product->second.m_sourceGlobalPath;
+        if (auto productCount = m_sourceProductCounts.find(sourcePath); productCount != m_sourceProductCounts.end())
+        {
+            if (--productCount->second == 0)
+            {
+                m_sourceProductCounts.erase(productCount);
+            }
+            touchedSources.insert(sourcePath);
+        }
+        m_products.erase(product);
+        m_modified = true;
+    }
+
+    size_t SourceAssetsIndex::UpdateSources(const SourcePaths& sourcePaths)
+    {
+        // Hashes are kept for sources which did not change since they were hashed
+        AZStd::vector<AZStd::string> sourcesToHash;
+        for (const auto& sourcePath : sourcePaths)
+        {
+            if (!m_sourceProductCounts.contains(sourcePath))
+            {
+                m_modified |= m_sources.erase(sourcePath) > 0;
+                continue;
+            }
+            SourceEntry entry;
+            entry.m_modificationTime = AZ::IO::SystemFile::ModificationTime(sourcePath.c_str());
+            entry.m_size = AZ::IO::SystemFile::Length(sourcePath.c_str());
+            auto known = m_sources.find(sourcePath);
+            if (known != m_sources.end() && known->second.m_modificationTime == entry.m_modificationTime &&
+                known->second.m_size == entry.m_size)
+            {
+                continue;
+            }
+            m_sources[sourcePath] = entry;
+            sourcesToHash.push_back(sourcePath);
+        }
+
+        if (sourcesToHash.empty())
+        {
+            return 0;
+        }
+
+        AZStd::vector<AZ::u64> hashes(sourcesToHash.size(), 0);
+        AZ::JobCompletion completion;
+        for (size_t i = 0; i < sourcesToHash.size(); ++i)
+        {
+            AZ::Job* job = AZ::CreateJobFunction(
+                [&sourcesToHash, &hashes, i]()
+                {
+                    hashes[i] = GetFileHash(sourcesToHash[i]);
+                },
+                true);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+
+        for (size_t i = 0; i < sourcesToHash.size(); ++i)
+        {
+            m_sources[sourcesToHash[i]].m_hash = hashes[i];
+        }
+        m_modified = true;
+        return sourcesToHash.size();
+    }
+
+    void SourceAssetsIndex::Load()
+    {
+        m_products.clear();
+        m_sources.clear();
+        m_sourceProductCounts.clear();
+        m_modified = false;
+        {
+            AZStd::lock_guard lock(m_changedAssetsMutex);
+            m_changedAssets.clear();
+            m_catalogSynced = false;
+        }
+        if (m_indexFilePath.empty() || !AZ::IO::SystemFile::Exists(m_indexFilePath.c_str()))
+        {
+            return;
+        }
+
+        auto content = AZ::Utils::ReadFile<AZStd::string>(m_indexFilePath);
+        if (!content.IsSuccess())
+        {
+            AZ_Warning("SourceAssetsIndex", false, "Cannot read %s: %s", m_indexFilePath.c_str(), content.GetError().c_str());
+            return;
+        }
+
+        AZStd::vector<AZStd::string> lines;
+        AZ::StringFunc::Tokenize(content.GetValue(), lines, '\n');
+        if (lines.empty() || lines.front() != Internal::IndexHeader)
+        {
+            AZ_Printf("SourceAssetsIndex", "Index %s has a different version, it is rebuilt\n", m_indexFilePath.c_str());
+            return;
+        }
+
+        AZStd::vector<AZStd::string> fields;
+        for (size_t i = 1; i < lines.size(); ++i)
+        {
+            fields.clear();
+            AZ::StringFunc::Tokenize(lines[i], fields, '\t', true, true);
+            if (fields.size() == 4 && fields[0] == "P")
+            {
+                m_products[fields[2]] = ProductEntry{ AZ::Data::AssetId::CreateString(fields[1]), fields[3] };
+                if (!fields[3].empty())
+                {
+                    ++m_sourceProductCounts[fields[3]];
+                }
+            }
+            else if (fields.size() == 5 && fields[0] == "S")
+            {
+                SourceEntry entry;
+                entry.m_modificationTime = AZStd::stoull(fields[1]);
+                entry.m_size = AZStd::stoull(fields[2]);
+                entry.m_hash = AZStd::stoull(fields[3], nullptr, 16);
+                m_sources[fields[4]] = entry;
+            }
+        }
+    }
+
+    void SourceAssetsIndex::Save()
+    {
+        if (m_indexFilePath.empty() || !m_modified)
+        {
+            return;
+        }
+
+        AZStd::string content = Internal::IndexHeader;
+        content += '\n';
+        for (const auto& [productPath, product] : m_products)
+        {
+            content += AZStd::string::format(
+                "P\t%s\t%s\t%s\n",
+                product.m_assetId.ToString<AZStd::string>().c_str(),
+                productPath.c_str(),
+                product.m_sourceGlobalPath.c_str());
+        }
+        for (const auto& [sourcePath, source] : m_sources)
+        {
+            content += AZStd::string::format(
+                "S\t%llu\t%llu\t%016llx\t%s\n",
+                static_cast<unsigned long long>(source.m_modificationTime),
+                static_cast<unsigned long long>(source.m_size),
+                static_cast<unsigned long long>(source.m_hash),
+                sourcePath.c_str());
+        }
+
+        const AZ::IO::Path indexDirectory = AZ::IO::PathView(m_indexFilePath).ParentPath();
+        if (!indexDirectory.empty() && !AZ::IO::SystemFile::Exists(indexDirectory.c_str()))
+        {
+            AZ::IO::SystemFile::CreateDir(indexDirectory.c_str());
+        }
+        auto outcome = AZ::Utils::WriteFile(content, m_indexFilePath);
+        AZ_Warning("SourceAssetsIndex", outcome.IsSuccess(), "Cannot write %s", m_indexFilePath.c_str());
+        m_modified = !outcome.IsSuccess();
+    }
+
+    void SourceAssetsIndex::OnCatalogLoaded([[maybe_unused]] const char* catalogFile)
+    {
+        // Products may have changed in any way, the next update checks the whole catalog
+        AZStd::lock_guard lock(m_changedAssetsMutex);
+        m_catalogSynced = false;
+    }
+
+    void SourceAssetsIndex::OnCatalogAssetChanged(const AZ::Data::AssetId& assetId)
+    {
+        AZStd::lock_guard lock(m_changedAssetsMutex);
+        m_changedAssets[assetId].m_added = true;
+    }
+
+    void SourceAssetsIndex::OnCatalogAssetAdded(const AZ::Data::AssetId& assetId)
+    {
+        AZStd::lock_guard lock(m_changedAssetsMutex);
+        m_changedAssets[assetId].m_added = true;
+    }
+
+    void SourceAssetsIndex::OnCatalogAssetRemoved(const AZ::Data::AssetId& assetId, const AZ::Data::AssetInfo& assetInfo)
+    {
+        AZStd::lock_guard lock(m_changedAssetsMutex);
+        m_changedAssets[assetId] = ChangedAsset{ assetInfo.m_relativePath, false };
+    }
+} // namespace ROS2::Utils
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "SourceAssetsStorage.h"
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Asset/AssetCatalogBus.h>
+
+namespace ROS2::Utils
+{
+    //! Content hashes of source meshes of the asset catalog, kept between imports and between editor sessions.
+    //! The index remembers the source file of each mesh product and the hash of each source file with its modification time
+    //! and size. The first update after the catalog is loaded checks the index against the whole catalog, later updates only look
+    //! up the products reported by catalog events. Only source files which are new or have been modified are hashed, hashing is
+    //! done in parallel on the job system.
+    class SourceAssetsIndex : private AzFramework::AssetCatalogEventBus::Handler
+    {
+    public:
+        AZ_RTTI(SourceAssetsIndex, "{0F62D319-C619-4863-ABC6-F5D5D47EA2CA}");
+
+        SourceAssetsIndex() = default;
+        virtual ~SourceAssetsIndex() = default;
+
+        //! Loads the index and starts tracking changes of the asset catalog.
+        //! @param indexFilePath file to keep the index in, may start with an alias. The index is not persisted if empty.
+        void Activate(const AZStd::string& indexFilePath);
+
+        //! Saves the index and stops tracking changes of the asset catalog.
+        void Deactivate();
+
+        //! Brings the index up to date with the asset catalog.
+        //! @returns source meshes by content hash of their source file.
+        AZStd::unordered_map<AZ::u64, AvailableAsset> GetSourceAssetsByHash();
+
+    private:
+        //! Product mesh and its source, the source path is empty if the source is not a supported mesh.
+        struct ProductEntry
+        {
+            AZ::Data::AssetId m_assetId;
+            AZStd::string m_sourceGlobalPath;
+        };
+
+        struct SourceEntry
+        {
+            AZ::u64 m_modificationTime = 0;
+            AZ::u64 m_size = 0;
+            AZ::u64 m_hash = 0;
+        };
+
+        //! Product reported by catalog events since the last update.
+        struct ChangedAsset
+        {
+            AZStd::string m_removedProductPath; //!< Path the product was removed from, empty if it was not removed.
+            bool m_added = false; //!< The product was added or changed after it was removed.
+        };
+
+        using ChangedAssets = AZStd::unordered_map<AZ::Data::AssetId, ChangedAsset>;
+        using SourcePaths = AZStd::unordered_set<AZStd::string>;
+
+        void Update();
+
+        //! Drops products which are not in the catalog anymore and looks up products which are new or reported by catalog events.
+        //! @returns number of products looked up.
+        size_t SyncWithCatalog(
+            const ChangedAssets& changedAssets, SourcePaths& touchedSources, AZStd::vector<AZ::Data::AssetId>& unresolvedAssets);
+
+        //! Drops removed products and looks up the added and changed ones.
+        //! @returns number of products looked up.
+        size_t ApplyCatalogChanges(
+            const ChangedAssets& changedAssets, SourcePaths& touchedSources, AZStd::vector<AZ::Data::AssetId>& unresolvedAssets);
+
+        //! Asks the asset system for the source of a product.
+        //! @returns false if the source is not known yet.
+        bool LookUpProduct(const AZStd::string& productPath, const AZ::Data::AssetId& assetId, SourcePaths& touchedSources);
+
+        void SetProduct(const AZStd::string& productPath, ProductEntry product, SourcePaths& touchedSources);
+        void RemoveProduct(const AZStd::string& productPath, SourcePaths& touchedSources);
+
+        //! Drops sources no product uses anymore and hashes the sources which are new or have been modified.
+        //! @returns number of hashed sources.
+        size_t UpdateSources(const SourcePaths& sourcePaths);
+
+        void Load();
+        void Save();
+
+        // AzFramework::AssetCatalogEventBus::Handler overrides
+        void OnCatalogLoaded(const char* catalogFile) override;
+        void OnCatalogAssetChanged(const AZ::Data::AssetId& assetId) override;
+        void OnCatalogAssetAdded(const AZ::Data::AssetId& assetId) override;
+        void OnCatalogAssetRemoved(const AZ::Data::AssetId& assetId, const AZ::Data::AssetInfo& assetInfo) override;
+
+        AZStd::string m_indexFilePath;
+        AZStd::unordered_map<AZStd::string, ProductEntry> m_products; //!< Keyed by relative product path.
+        AZStd::unordered_map<AZStd::string, SourceEntry> m_sources; //!< Keyed by global source path.
+        AZStd::unordered_map<AZStd::string, size_t> m_sourceProductCounts; //!< Number of products of each source, not saved.
+        bool m_modified = false; //!< The index differs from its file.
+
+        AZStd::mutex m_changedAssetsMutex;
+        ChangedAssets m_changedAssets;
+        bool m_catalogSynced = false; //!< The index was checked against the whole catalog since the catalog was loaded.
+    };
+
+    using SourceAssetsIndexInterface = AZ::Interface<SourceAssetsIndex>;
+} // namespace ROS2::Utils
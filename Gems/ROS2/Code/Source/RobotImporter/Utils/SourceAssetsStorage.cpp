@@ -7,101 +7,54 @@
  */
 #include "SourceAssetsStorage.h"
 #include "RobotImporterUtils.h"
+#include "SourceAssetsIndex.h"
+#include <AzCore/Utils/TypeHash.h>
 
 namespace ROS2::Utils
 {
-    /// Function computes CRC32 on first kilobyte of file.
-    AZ::Crc32 GetFileCRC(const AZStd::string& filename)
+    AZ::u64 GetFileHash(const AZStd::string& filename)
     {
-        auto fileSize = AZ::IO::SystemFile::Length(filename.c_str());
-        fileSize = AZStd::min(fileSize, 1024ull); // limit crc computation to first kilobyte
-        if (fileSize == 0)
+        AZ::IO::SystemFile file;
+        if (!file.Open(filename.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
         {
-            return AZ::Crc32();
+            return 0;
         }
-        AZStd::vector<char> buffer;
-        buffer.resize_no_construct(fileSize + 1);
-        buffer[fileSize] = '\0';
-        if (!AZ::IO::SystemFile::Read(filename.c_str(), buffer.data(), fileSize))
+
+        // Chunks are chained through the seed, so that a file of any size is hashed with constant memory
+        constexpr AZ::IO::SystemFile::SizeType ChunkSize = 256 * 1024;
+        AZStd::vector<AZ::u8> buffer;
+        buffer.resize_no_construct(ChunkSize);
+        AZ::HashValue64 hash{ 0 };
+        bool empty = true;
+        while (const AZ::IO::SystemFile::SizeType bytesRead = file.Read(ChunkSize, buffer.data()))
         {
-            return AZ::Crc32();
+            hash = AZ::TypeHash64(buffer.data(), bytesRead, hash);
+            empty = false;
         }
-        AZ::Crc32 r;
-        r.Add(buffer.data(), fileSize);
-        return r;
+        return empty ? 0 : static_cast<AZ::u64>(hash);
     }
 
-    AZStd::unordered_map<AZ::Crc32, AvailableAsset> GetInterestingSourceAssetsCRC()
+    AZStd::unordered_map<AZ::u64, AvailableAsset> GetInterestingSourceAssetsHashes()
     {
-        const AZStd::unordered_set<AZStd::string> kInterestingExtensions{ ".dae", ".stl", ".obj", ".fbx" };
-        constexpr char AzModelExtension[] {".azmodel"} ;
-        AZStd::unordered_map<AZ::Crc32, AvailableAsset> availableAssets;
-
-        // take all meshes in catalog
-        AZ::Data::AssetCatalogRequests::AssetEnumerationCB collectAssetsCb =
-            [&](const AZ::Data::AssetId id, const AZ::Data::AssetInfo& info)
+        if (auto* sourceAssetsIndex = SourceAssetsIndexInterface::Get())
         {
-            if (AZ::Data::AssetManager::Instance().GetHandler(info.m_assetType))
-            {
-                if (!info.m_relativePath.ends_with(AzModelExtension))
-                {
-                    return;
-                }
-                using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
-                bool pathFound{ false };
-                AZStd::string fullSourcePathStr;
-
-                AssetSysReqBus::BroadcastResult(
-                    pathFound, &AssetSysReqBus::Events::GetFullSourcePathFromRelativeProductPath, info.m_relativePath, fullSourcePathStr);
-                if (!pathFound)
-                {
-                    return;
-                }
-                const AZ::IO::Path fullSourcePath(fullSourcePathStr);
-                const AZStd::string extension = fullSourcePath.Extension().Native();
-
-                if (!kInterestingExtensions.contains(extension))
-                {
-                    return;
-                }
-
-                AZ::Crc32 crc = Utils::GetFileCRC(fullSourcePathStr);
-                AZ_Printf(
-                    "RobotImporterWidget",
-                    "m_relativePath %s %s : %s %llu \n",
-                    info.m_relativePath.c_str(),
-                    info.m_assetId.ToString<AZStd::string>().c_str(),
-                    fullSourcePath.c_str(),
-                    crc);
-
-                AvailableAsset foundAsset;
-                foundAsset.m_sourceAssetRelativePath = info.m_relativePath;
-                foundAsset.m_assetId = info.m_assetId;
-                foundAsset.m_sourceAssetGlobalPath = fullSourcePathStr;
-                foundAsset.m_productAssetRelativePath = info.m_relativePath;
-                auto availableAssetIt = availableAssets.find(crc);
-                if (availableAssetIt != availableAssets.end())
-                {
-                    const AZStd::string stem(fullSourcePath.Stem().Native());
-                    // probably there is already submesh added. Replace only if there is exact name
-                    if (info.m_relativePath.contains(stem + AzModelExtension))
-                    {
-                        availableAssetIt->second = foundAsset;
-                    }
-                }
-                else
-                {
-                    availableAssets.insert({crc, foundAsset});
-                }
-            }
-        };
-        AZ::Data::AssetCatalogRequestBus::Broadcast(
-            &AZ::Data::AssetCatalogRequestBus::Events::EnumerateAssets, nullptr, collectAssetsCb, nullptr);
+            return sourceAssetsIndex->GetSourceAssetsByHash();
+        }
 
-        return availableAssets;
+        // Without the editor index, the whole catalog is hashed
+        SourceAssetsIndex temporaryIndex;
+        return temporaryIndex.GetSourceAssetsByHash();
     }
 
     UrdfAssetMap FindAssetsForUrdf(const AZStd::unordered_set<AZStd::string>& meshesFilenames, const AZStd::string& urdFilename)
+    {
+        return FindAssetsForUrdf(meshesFilenames, urdFilename, Utils::GetInterestingSourceAssetsHashes());
+    }
+
+    UrdfAssetMap FindAssetsForUrdf(
+        const AZStd::unordered_set<AZStd::string>& meshesFilenames,
+        const AZStd::string& urdFilename,
+        const AZStd::unordered_map<AZ::u64, AvailableAsset>& availableAssets)
     {
         UrdfAssetMap urdfToAsset;
         for (const auto& t : meshesFilenames)
@@ -109,17 +62,15 @@ namespace ROS2::Utils
             Utils::UrdfAsset asset;
             asset.m_urdfPath = t;
             asset.m_resolvedUrdfPath = Utils::ResolveURDFPath(asset.m_urdfPath, urdFilename);
-            asset.m_urdfFileCRC = Utils::GetFileCRC(asset.m_resolvedUrdfPath);
+            asset.m_urdfFileHash = Utils::GetFileHash(asset.m_resolvedUrdfPath);
             urdfToAsset.emplace(t, AZStd::move(asset));
         }
 
-        const AZStd::unordered_map<AZ::Crc32, AvailableAsset> availableAssets = Utils::GetInterestingSourceAssetsCRC();
-
-        // Search for suitable mappings by comparing checksum
+        // Search for suitable mappings by comparing content hashes
         for (auto it = urdfToAsset.begin(); it != urdfToAsset.end(); it++)
         {
             Utils::UrdfAsset& asset = it->second;
-            auto found_source_asset = availableAssets.find(asset.m_urdfFileCRC);
+            auto found_source_asset = availableAssets.find(asset.m_urdfFileHash);
             if (found_source_asset != availableAssets.end())
             {
                 asset.m_availableAssetInfo = found_source_asset->second;
@@ -44,8 +44,8 @@ namespace ROS2::Utils
         //! Resolved URDF path, points to the valid mesh in the filestystem, eg `/home/user/ros_ws/src/foo_robot/meshes/bar_link.dae'
         AZStd::string m_resolvedUrdfPath;
 
-        //! Checksum of the file located pointed by `m_resolvedUrdfPath`.
-        AZ::Crc32 m_urdfFileCRC;
+        //! Content hash of the file located pointed by `m_resolvedUrdfPath`, @see GetFileHash.
+        AZ::u64 m_urdfFileHash = 0;
 
         //! Found O3DE asset.
         AvailableAsset m_availableAssetInfo;
@@ -54,23 +54,33 @@ namespace ROS2::Utils
     /// Type that hold result of mapping from URDF path to asset info
     using UrdfAssetMap = AZStd::unordered_map<AZStd::string, Utils::UrdfAsset>;
 
-    //! Function computes CRC32 on first kilobyte of file.
-    AZ::Crc32 GetFileCRC(const AZStd::string& filename);
+    //! Function computes a 64-bit hash (xxHash) of the whole content of a file.
+    //! @returns hash of the file, 0 if the file is empty or cannot be read.
+    AZ::u64 GetFileHash(const AZStd::string& filename);
 
-    //! Compute CRC for every source mesh from the assets catalog.
-    //! @returns map where key is crc of source file and value is AvailableAsset.
-    AZStd::unordered_map<AZ::Crc32, AvailableAsset> GetInterestingSourceAssetsCRC();
+    //! Find content hashes of every source mesh from the assets catalog.
+    //! Hashes are taken from the SourceAssetsIndex of the editor when it is available, only new and modified sources are hashed.
+    //! @returns map where key is hash of source file and value is AvailableAsset.
+    AZStd::unordered_map<AZ::u64, AvailableAsset> GetInterestingSourceAssetsHashes();
 
     //! Discover an association between meshes in URDF and O3DE source and product assets.
     //! The @param meshesFilenames contains the list of unresolved URDF filenames that are to be found as assets.
     //! Steps:
     //! - Functions resolves URDF filenames with `ResolveURDFPath`.
-    //! - Files pointed by resolved URDF patches have their checksum computed `GetFileCRC`.
-    //! - Function scans all available O3DE assets by calling `GetInterestingSourceAssetsCRC`.
+    //! - Files pointed by resolved URDF patches have their content hash computed `GetFileHash`.
+    //! - Function finds hashes of all available O3DE assets by calling `GetInterestingSourceAssetsHashes`.
     //! - Suitable mapping to the O3DE asset is found by comparing the checksum of the file pointed by the URDF path and source asset.
     //! @param meshesFilenames - list of the unresolved path from the URDF file
     //! @param urdFilename - filename of URDF file, used for resolvement
     //! @returns a URDF Asset map where the key is unresolved URDF path to AvailableAsset
     UrdfAssetMap FindAssetsForUrdf(const AZStd::unordered_set<AZStd::string>& meshesFilenames, const AZStd::string& urdFilename);
 
+    //! Discover an association between meshes in URDF and given source assets, @see FindAssetsForUrdf.
+    //! Lets imports of many robots share one result of `GetInterestingSourceAssetsHashes`, it is safe to call from many threads.
+    //! @param availableAssets - source assets by content hash of their source file.
+    UrdfAssetMap FindAssetsForUrdf(
+        const AZStd::unordered_set<AZStd::string>& meshesFilenames,
+        const AZStd::string& urdFilename,
+        const AZStd::unordered_map<AZ::u64, AvailableAsset>& availableAssets);
+
 } // namespace ROS2::Utils
@@ -0,0 +1,1544 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "XacroEvaluator.h"
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/XML/rapidxml.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/string_view.h>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+
+namespace ROS2::Utils::xacro
+{
+    namespace Internal
+    {
+        using XmlNode = AZ::rapidxml::xml_node<char>;
+
+        constexpr AZStd::string_view XacroPrefix = "xacro:";
+        constexpr int MaxMacroDepth = 100;
+        constexpr size_t MaxIncludeDepth = 50;
+        constexpr double Pi = 3.14159265358979323846;
+#if defined(AZ_PLATFORM_WINDOWS)
+        constexpr const char* PathListSeparator = ";";
+#else
+        constexpr const char* PathListSeparator = ":";
+#endif
+
+        //! Formats a floating point number the way Python does, with the shortest text that reads back as the same number.
+        AZStd::string FormatFloat(double number)
+        {
+            if (!std::isfinite(number))
+            {
+                return std::isnan(number) ? "nan" : (number > 0.0 ? "inf" : "-inf");
+            }
+            AZStd::string text;
+            for (int precision = 1; precision <= 17; ++precision)
+            {
+                text = AZStd::string::format("%.*g", precision, number);
+                if (std::strtod(text.c_str(), nullptr) == number)
+                {
+                    break;
+                }
+            }
+            if (text.find_first_of(".e") == AZStd::string::npos)
+            {
+                text += ".0";
+            }
+            return text;
+        }
+
+        //! Value of a xacro expression.
+        struct Value
+        {
+            enum class Type
+            {
+                Integer,
+                Float,
+                Boolean,
+                String
+            };
+
+            static Value MakeNumber(double number, bool isInteger)
+            {
+                Value value;
+                value.m_type = isInteger ? Type::Integer : Type::Float;
+                value.m_number = isInteger ? std::trunc(number) : number;
+                return value;
+            }
+
+            static Value MakeBoolean(bool boolean)
+            {
+                Value value;
+                value.m_type = Type::Boolean;
+                value.m_number = boolean ? 1.0 : 0.0;
+                return value;
+            }
+
+            static Value MakeString(AZStd::string text)
+            {
+                Value value;
+                value.m_type = Type::String;
+                value.m_text = AZStd::move(text);
+                return value;
+            }
+
+            //! Value of a property or a parameter, which is a number if the text is a number.
+            static Value FromText(const AZStd::string& text)
+            {
+                AZStd::string trimmed = text;
+                AZ::StringFunc::TrimWhiteSpace(trimmed, true, true);
+                const bool isNumberText = !trimmed.empty() && trimmed.find_first_not_of("0123456789+-.eE") == AZStd::string::npos;
+                if (isNumberText)
+                {
+                    char* end = nullptr;
+                    const double number = std::strtod(trimmed.c_str(), &end);
+                    if (end == trimmed.c_str() + trimmed.size())
+                    {
+                        return MakeNumber(number, trimmed.find_first_of(".eE") == AZStd::string::npos);
+                    }
+                }
+                return MakeString(text);
+            }
+
+            bool IsNumeric() const
+            {
+                return m_type != Type::String;
+            }
+
+            //! Booleans count as integers in arithmetic, as in Python.
+            bool IsInteger() const
+            {
+                return m_type == Type::Integer || m_type == Type::Boolean;
+            }
+
+            bool IsTruthy() const
+            {
+                return IsNumeric() ? m_number != 0.0 : !m_text.empty();
+            }
+
+            AZStd::string ToString() const
+            {
+                switch (m_type)
+                {
+                case Type::Integer:
+                    return AZStd::string::format("%lld", static_cast<long long>(m_number));
+                case Type::Float:
+                    return FormatFloat(m_number);
+                case Type::Boolean:
+                    return m_number != 0.0 ? "True" : "False";
+                default:
+                    return m_text;
+                }
+            }
+
+            Type m_type = Type::String;
+            double m_number = 0.0;
+            AZStd::string m_text;
+        };
+
+        using NameResolver = AZStd::function<AZ::Outcome<Value, AZStd::string>(const AZStd::string&)>;
+
+        //! Recursive descent parser and evaluator of the Python expression subset used in ${} of xacro files.
+        class ExpressionParser
+        {
+        public:
+            ExpressionParser(AZStd::string_view text, const NameResolver& resolveName)
+                : m_text(text)
+                , m_resolveName(resolveName)
+            {
+            }
+
+            AZ::Outcome<Value, AZStd::string> Parse()
+            {
+                Value value;
+                if (!ParseOr(value))
+                {
+                    return AZ::Failure(m_error);
+                }
+                SkipSpaces();
+                if (m_position != m_text.size())
+                {
+                    const AZStd::string_view rest = m_text.substr(m_position);
+                    return AZ::Failure(AZStd::string::format("unexpected '%.*s'", AZ_STRING_ARG(rest)));
+                }
+                return AZ::Success(AZStd::move(value));
+            }
+
+        private:
+            bool Fail(AZStd::string message)
+            {
+                if (m_error.empty())
+                {
+                    m_error = AZStd::move(message);
+                }
+                return false;
+            }
+
+            static bool IsIdentifierCharacter(char character)
+            {
+                return std::isalnum(static_cast<unsigned char>(character)) || character == '_' || character == '.';
+            }
+
+            void SkipSpaces()
+            {
+                while (m_position < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_position])))
+                {
+                    ++m_position;
+                }
+            }
+
+            bool MatchOperator(AZStd::string_view op)
+            {
+                SkipSpaces();
+                if (m_text.substr(m_position).starts_with(op))
+                {
+                    m_position += op.size();
+                    return true;
+                }
+                return false;
+            }
+
+            bool MatchKeyword(AZStd::string_view keyword)
+            {
+                SkipSpaces();
+                const size_t end = m_position + keyword.size();
+                if (m_text.substr(m_position).starts_with(keyword) && (end == m_text.size() || !IsIdentifierCharacter(m_text[end])))
+                {
+                    m_position = end;
+                    return true;
+                }
+                return false;
+            }
+
+            bool ParseOr(Value& value)
+            {
+                if (!ParseAnd(value))
+                {
+                    return false;
+                }
+                while (MatchKeyword("or"))
+                {
+                    Value rhs;
+                    if (!ParseAnd(rhs))
+                    {
+                        return false;
+                    }
+                    if (!value.IsTruthy())
+                    {
+                        value = AZStd::move(rhs);
+                    }
+                }
+                return true;
+            }
+
+            bool ParseAnd(Value& value)
+            {
+                if (!ParseNot(value))
+                {
+                    return false;
+                }
+                while (MatchKeyword("and"))
+                {
+                    Value rhs;
+                    if (!ParseNot(rhs))
+                    {
+                        return false;
+                    }
+                    if (value.IsTruthy())
+                    {
+                        value = AZStd::move(rhs);
+                    }
+                }
+                return true;
+            }
+
+            bool ParseNot(Value& value)
+            {
+                if (MatchKeyword("not"))
+                {
+                    if (!ParseNot(value))
+                    {
+                        return false;
+                    }
+                    value = Value::MakeBoolean(!value.IsTruthy());
+                    return true;
+                }
+                return ParseComparison(value);
+            }
+
+            bool ParseComparison(Value& value)
+            {
+                if (!ParseAdditive(value))
+                {
+                    return false;
+                }
+                constexpr AZStd::string_view operators[] = { "==", "!=", "<=", ">=", "<", ">" };
+                for (const AZStd::string_view op : operators)
+                {
+                    if (!MatchOperator(op))
+                    {
+                        continue;
+                    }
+                    Value rhs;
+                    if (!ParseAdditive(rhs))
+                    {
+                        return false;
+                    }
+                    int order = 0;
+                    if (value.IsNumeric() && rhs.IsNumeric())
+                    {
+                        order = value.m_number < rhs.m_number ? -1 : (value.m_number > rhs.m_number ? 1 : 0);
+                    }
+                    else if (!value.IsNumeric() && !rhs.IsNumeric())
+                    {
+                        order = value.m_text.compare(rhs.m_text);
+                    }
+                    else if (op == "==" || op == "!=")
+                    {
+                        value = Value::MakeBoolean(op == "!=");
+                        return true;
+                    }
+                    else
+                    {
+                        return Fail("cannot compare a number with a string");
+                    }
+
+                    bool result = false;
+                    if (op == "==")
+                    {
+                        result = order == 0;
+                    }
+                    else if (op == "!=")
+                    {
+                        result = order != 0;
+                    }
+                    else if (op == "<=")
+                    {
+                        result = order <= 0;
+                    }
+                    else if (op == ">=")
+                    {
+                        result = order >= 0;
+                    }
+                    else if (op == "<")
+                    {
+                        result = order < 0;
+                    }
+                    else
+                    {
+                        result = order > 0;
+                    }
+                    value = Value::MakeBoolean(result);
+                    return true;
+                }
+                return true;
+            }
+
+            bool ParseAdditive(Value& value)
+            {
+                if (!ParseTerm(value))
+                {
+                    return false;
+                }
+                while (true)
+                {
+                    const bool isAddition = MatchOperator("+");
+                    if (!isAddition && !MatchOperator("-"))
+                    {
+                        return true;
+                    }
+                    Value rhs;
+                    if (!ParseTerm(rhs))
+                    {
+                        return false;
+                    }
+                    if (value.IsNumeric() && rhs.IsNumeric())
+                    {
+                        const double result = isAddition ? value.m_number + rhs.m_number : value.m_number - rhs.m_number;
+                        value = Value::MakeNumber(result, value.IsInteger() && rhs.IsInteger());
+                    }
+                    else if (isAddition && !value.IsNumeric() && !rhs.IsNumeric())
+                    {
+                        value = Value::MakeString(value.m_text + rhs.m_text);
+                    }
+                    else
+                    {
+                        return Fail(AZStd::string::format(
+                            "unsupported operands '%s' and '%s' of %s",
+                            value.ToString().c_str(),
+                            rhs.ToString().c_str(),
+                            isAddition ? "+" : "-"));
+                    }
+                }
+            }
+
+            bool ParseTerm(Value& value)
+            {
+                if (!ParseUnary(value))
+                {
+                    return false;
+                }
+                while (true)
+                {
+                    SkipSpaces();
+                    if (m_text.substr(m_position).starts_with("**"))
+                    {
+                        return true;
+                    }
+                    AZStd::string_view op;
+                    for (const AZStd::string_view candidate : { AZStd::string_view("//"), AZStd::string_view("*"), AZStd::string_view("/"),
+                                                                AZStd::string_view("%") })
+                    {
+                        if (MatchOperator(candidate))
+                        {
+                            op = candidate;
+                            break;
+                        }
+                    }
+                    if (op.empty())
+                    {
+                        return true;
+                    }
+
+                    Value rhs;
+                    if (!ParseUnary(rhs))
+                    {
+                        return false;
+                    }
+                    if (!value.IsNumeric() || !rhs.IsNumeric())
+                    {
+                        return Fail(AZStd::string::format(
+                            "unsupported operands '%s' and '%s' of %.*s",
+                            value.ToString().c_str(),
+                            rhs.ToString().c_str(),
+                            AZ_STRING_ARG(op)));
+                    }
+                    const bool isInteger = value.IsInteger() && rhs.IsInteger();
+                    if (op == "*")
+                    {
+                        value = Value::MakeNumber(value.m_number * rhs.m_number, isInteger);
+                        continue;
+                    }
+                    if (rhs.m_number == 0.0)
+                    {
+                        return Fail("division by zero");
+                    }
+                    if (op == "/")
+                    {
+                        value = Value::MakeNumber(value.m_number / rhs.m_number, false);
+                    }
+                    else if (op == "//")
+                    {
+                        value = Value::MakeNumber(std::floor(value.m_number / rhs.m_number), isInteger);
+                    }
+                    else
+                    {
+                        const double remainder = value.m_number - rhs.m_number * std::floor(value.m_number / rhs.m_number);
+                        value = Value::MakeNumber(remainder, isInteger);
+                    }
+                }
+            }
+
+            bool ParseUnary(Value& value)
+            {
+                const bool isNegation = MatchOperator("-");
+                if (isNegation || MatchOperator("+"))
+                {
+                    if (!ParseUnary(value))
+                    {
+                        return false;
+                    }
+                    if (!value.IsNumeric())
+                    {
+                        return Fail(AZStd::string::format("bad operand '%s' of unary operator", value.ToString().c_str()));
+                    }
+                    value = Value::MakeNumber(isNegation ? -value.m_number : value.m_number, value.IsInteger());
+                    return true;
+                }
+                return ParsePower(value);
+            }
+
+            bool ParsePower(Value& value)
+            {
+                if (!ParsePrimary(value))
+                {
+                    return false;
+                }
+                if (!MatchOperator("**"))
+                {
+                    return true;
+                }
+                Value exponent;
+                if (!ParseUnary(exponent))
+                {
+                    return false;
+                }
+                if (!value.IsNumeric() || !exponent.IsNumeric())
+                {
+                    return Fail("unsupported operands of **");
+                }
+                const bool isInteger = value.IsInteger() && exponent.IsInteger() && exponent.m_number >= 0.0;
+                value = Value::MakeNumber(std::pow(value.m_number, exponent.m_number), isInteger);
+                return true;
+            }
+
+            bool ParsePrimary(Value& value)
+            {
+                SkipSpaces();
+                if (m_position >= m_text.size())
+                {
+                    return Fail("unexpected end of expression");
+                }
+
+                const char character = m_text[m_position];
+                if (character == '(')
+                {
+                    ++m_position;
+                    if (!ParseOr(value))
+                    {
+                        return false;
+                    }
+                    return MatchOperator(")") || Fail("missing ')'");
+                }
+                const bool startsFraction = character == '.' && m_position + 1 < m_text.size() &&
+                    std::isdigit(static_cast<unsigned char>(m_text[m_position + 1]));
+                if (std::isdigit(static_cast<unsigned char>(character)) || startsFraction)
+                {
+                    return ParseNumber(value);
+                }
+                if (character == '\'' || character == '"')
+                {
+                    return ParseString(value);
+                }
+                if (!std::isalpha(static_cast<unsigned char>(character)) && character != '_')
+                {
+                    return Fail(AZStd::string::format("unexpected character '%c'", character));
+                }
+
+                const size_t start = m_position;
+                while (m_position < m_text.size() && IsIdentifierCharacter(m_text[m_position]))
+                {
+                    ++m_position;
+                }
+                const AZStd::string name(m_text.substr(start, m_position - start));
+
+                if (MatchOperator("("))
+                {
+                    AZStd::vector<Value> arguments;
+                    if (!MatchOperator(")"))
+                    {
+                        do
+                        {
+                            Value argument;
+                            if (!ParseOr(argument))
+                            {
+                                return false;
+                            }
+                            arguments.push_back(AZStd::move(argument));
+                        } while (MatchOperator(","));
+                        if (!MatchOperator(")"))
+                        {
+                            return Fail(AZStd::string::format("missing ')' after arguments of %s", name.c_str()));
+                        }
+                    }
+                    return CallFunction(name, arguments, value);
+                }
+
+                if (name == "True" || name == "False")
+                {
+                    value = Value::MakeBoolean(name == "True");
+                    return true;
+                }
+                if (name == "pi" || name == "math.pi")
+                {
+                    value = Value::MakeNumber(Pi, false);
+                    return true;
+                }
+
+                auto resolved = m_resolveName(name);
+                if (!resolved.IsSuccess())
+                {
+                    return Fail(resolved.GetError());
+                }
+                value = resolved.TakeValue();
+                return true;
+            }
+
+            bool ParseNumber(Value& value)
+            {
+                const size_t start = m_position;
+                bool isInteger = true;
+                auto skipDigits = [this]()
+                {
+                    while (m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position])))
+                    {
+                        ++m_position;
+                    }
+                };
+                skipDigits();
+                if (m_position < m_text.size() && m_text[m_position] == '.')
+                {
+                    isInteger = false;
+                    ++m_position;
+                    skipDigits();
+                }
+                if (m_position < m_text.size() && (m_text[m_position] == 'e' || m_text[m_position] == 'E'))
+                {
+                    isInteger = false;
+                    ++m_position;
+                    if (m_position < m_text.size() && (m_text[m_position] == '+' || m_text[m_position] == '-'))
+                    {
+                        ++m_position;
+                    }
+                    skipDigits();
+                }
+                const AZStd::string numberText(m_text.substr(start, m_position - start));
+                value = Value::MakeNumber(std::strtod(numberText.c_str(), nullptr), isInteger);
+                return true;
+            }
+
+            bool ParseString(Value& value)
+            {
+                const char quote = m_text[m_position++];
+                const size_t end = m_text.find(quote, m_position);
+                if (end == AZStd::string_view::npos)
+                {
+                    return Fail("unterminated string");
+                }
+                value = Value::MakeString(AZStd::string(m_text.substr(m_position, end - m_position)));
+                m_position = end + 1;
+                return true;
+            }
+
+            bool CallFunction(AZStd::string name, const AZStd::vector<Value>& arguments, Value& value)
+            {
+                if (name.starts_with("math."))
+                {
+                    name.erase(0, 5);
+                }
+
+                // Conversions accept strings
+                if (arguments.size() == 1 && (name == "float" || name == "int" || name == "str"))
+                {
+                    const Value argument = arguments[0].IsNumeric() ? arguments[0] : Value::FromText(arguments[0].m_text);
+                    if (name == "str")
+                    {
+                        value = Value::MakeString(arguments[0].ToString());
+                        return true;
+                    }
+                    if (!argument.IsNumeric())
+                    {
+                        return Fail(AZStd::string::format("cannot convert '%s' with %s", argument.ToString().c_str(), name.c_str()));
+                    }
+                    value = Value::MakeNumber(argument.m_number, name == "int");
+                    return true;
+                }
+
+                for (const Value& argument : arguments)
+                {
+                    if (!argument.IsNumeric())
+                    {
+                        return Fail(
+                            AZStd::string::format("argument '%s' of %s is not a number", argument.ToString().c_str(), name.c_str()));
+                    }
+                }
+
+                if (arguments.size() == 1)
+                {
+                    const double x = arguments[0].m_number;
+                    using UnaryFunction = double (*)(double);
+                    const AZStd::pair<AZStd::string_view, UnaryFunction> unaryFunctions[] = {
+                        { "sin", [](double a) { return std::sin(a); } },     { "cos", [](double a) { return std::cos(a); } },
+                        { "tan", [](double a) { return std::tan(a); } },     { "asin", [](double a) { return std::asin(a); } },
+                        { "acos", [](double a) { return std::acos(a); } },   { "atan", [](double a) { return std::atan(a); } },
+                        { "sqrt", [](double a) { return std::sqrt(a); } },   { "exp", [](double a) { return std::exp(a); } },
+                        { "log", [](double a) { return std::log(a); } },     { "fabs", [](double a) { return std::fabs(a); } },
+                        { "radians", [](double a) { return a * Pi / 180.0; } }, { "degrees", [](double a) { return a * 180.0 / Pi; } },
+                    };
+                    for (const auto& [functionName, function] : unaryFunctions)
+                    {
+                        if (name == functionName)
+                        {
+                            value = Value::MakeNumber(function(x), false);
+                            return true;
+                        }
+                    }
+                    if (name == "abs")
+                    {
+                        value = Value::MakeNumber(std::fabs(x), arguments[0].IsInteger());
+                        return true;
+                    }
+                    if (name == "floor" || name == "ceil")
+                    {
+                        value = Value::MakeNumber(name == "floor" ? std::floor(x) : std::ceil(x), true);
+                        return true;
+                    }
+                }
+                else if (arguments.size() == 2)
+                {
+                    const Value& x = arguments[0];
+                    const Value& y = arguments[1];
+                    if (name == "atan2")
+                    {
+                        value = Value::MakeNumber(std::atan2(x.m_number, y.m_number), false);
+                        return true;
+                    }
+                    if (name == "pow")
+                    {
+                        value = Value::MakeNumber(std::pow(x.m_number, y.m_number), false);
+                        return true;
+                    }
+                    if (name == "hypot")
+                    {
+                        value = Value::MakeNumber(std::hypot(x.m_number, y.m_number), false);
+                        return true;
+                    }
+                    if (name == "min" || name == "max")
+                    {
+                        const bool takeFirst = (name == "min") == (x.m_number <= y.m_number);
+                        value = takeFirst ? x : y;
+                        return true;
+                    }
+                }
+                return Fail(AZStd::string::format("unsupported function %s with %zu arguments", name.c_str(), arguments.size()));
+            }
+
+            AZStd::string_view m_text;
+            size_t m_position = 0;
+            const NameResolver& m_resolveName;
+            AZStd::string m_error;
+        };
+
+        void AppendEscaped(AZStd::string& output, AZStd::string_view text)
+        {
+            for (const char character : text)
+            {
+                switch (character)
+                {
+                case '&':
+                    output += "&amp;";
+                    break;
+                case '<':
+                    output += "&lt;";
+                    break;
+                case '>':
+                    output += "&gt;";
+                    break;
+                case '"':
+                    output += "&quot;";
+                    break;
+                default:
+                    output += character;
+                    break;
+                }
+            }
+        }
+
+        XmlNode* NextElement(XmlNode* node)
+        {
+            while (node && node->type() != AZ::rapidxml::node_element)
+            {
+                node = node->next_sibling();
+            }
+            return node;
+        }
+
+        //! Finds a package in the prefixes of AMENT_PREFIX_PATH, then next to folders of the expanded file.
+        AZStd::optional<AZStd::string> FindPackage(
+            const AZStd::string& name, const AZ::IO::Path& rootDirectory, const AZStd::optional<AZStd::string>& prefixPath)
+        {
+            auto isPackage = [](const AZ::IO::Path& directory)
+            {
+                return AZ::IO::SystemFile::Exists((directory / "package.xml").c_str());
+            };
+
+            if (prefixPath)
+            {
+                AZStd::vector<AZStd::string> prefixes;
+                AZ::StringFunc::Tokenize(*prefixPath, prefixes, PathListSeparator);
+                for (const auto& prefix : prefixes)
+                {
+                    const AZ::IO::Path candidate = AZ::IO::Path(prefix) / "share" / name;
+                    if (isPackage(candidate))
+                    {
+                        return candidate.String();
+                    }
+                }
+            }
+
+            // Source workspaces keep packages next to each other, look around folders of the expanded file
+            for (AZ::IO::Path directory = rootDirectory; !directory.empty(); directory = directory.ParentPath())
+            {
+                if (directory.Filename().Native() == name && isPackage(directory))
+                {
+                    return directory.String();
+                }
+                const AZ::IO::Path candidate = directory / name;
+                if (isPackage(candidate))
+                {
+                    return candidate.String();
+                }
+                if (directory == directory.ParentPath())
+                {
+                    break;
+                }
+            }
+            return AZStd::nullopt;
+        }
+
+        AZStd::optional<AZStd::string> GetEnvironmentValue(const AZStd::string& name)
+        {
+            if (const char* value = std::getenv(name.c_str()))
+            {
+                return AZStd::string(value);
+            }
+            return AZStd::nullopt;
+        }
+
+        //! Expands one xacro document with its includes, writing the URDF document to a string.
+        class XacroExpander
+        {
+        public:
+            explicit XacroExpander(const AZStd::unordered_map<AZStd::string, AZStd::string>& params)
+                : m_args(params)
+            {
+            }
+
+            AZ::Outcome<AZStd::string, AZStd::string> Expand(const AZStd::string& filename)
+            {
+                const AZ::IO::Path path = AZ::IO::Path(filename).LexicallyNormal();
+                XmlNode* root = nullptr;
+                if (!LoadDocument(path, root))
+                {
+                    return AZ::Failure(m_error);
+                }
+                m_rootDirectory = path.ParentPath();
+                m_includeStack.push_back(path);
+                m_scopes.emplace_back();
+
+                m_output = "<?xml version=\"1.0\"?>\n";
+                if (!ProcessNode(root))
+                {
+                    return AZ::Failure(m_error);
+                }
+                return AZ::Success(AZStd::move(m_output));
+            }
+
+            const ExpansionInputs& GetInputs() const
+            {
+                return m_inputs;
+            }
+
+        private:
+            struct Document
+            {
+                AZStd::vector<char> m_buffer;
+                AZ::rapidxml::xml_document<char> m_document;
+            };
+
+            //! An element to insert with xacro:insert_block, or only its children.
+            struct Block
+            {
+                XmlNode* m_node = nullptr;
+                bool m_childrenOnly = false;
+            };
+
+            struct Scope
+            {
+                AZStd::unordered_map<AZStd::string, AZStd::string> m_properties;
+                AZStd::unordered_map<AZStd::string, Block> m_blocks;
+            };
+
+            struct MacroParameter
+            {
+                enum class Kind
+                {
+                    Value,
+                    Block, //!< *name, an element of the call.
+                    ContentBlock //!< **name, children of an element of the call.
+                };
+
+                AZStd::string m_name;
+                Kind m_kind = Kind::Value;
+                AZStd::optional<AZStd::string> m_default;
+                bool m_forwarded = false; //!< :=^, the value is taken from the calling scope if defined there.
+            };
+
+            struct Macro
+            {
+                XmlNode* m_node = nullptr;
+                AZStd::vector<MacroParameter> m_parameters;
+            };
+
+            bool Fail(AZStd::string message)
+            {
+                if (m_error.empty())
+                {
+                    m_error = AZStd::move(message);
+                }
+                return false;
+            }
+
+            static AZStd::string_view GetName(const XmlNode* node)
+            {
+                return AZStd::string_view(node->name(), node->name_size());
+            }
+
+            static const char* GetAttribute(const XmlNode* node, const char* name)
+            {
+                const auto* attribute = node->first_attribute(name);
+                return attribute ? attribute->value() : nullptr;
+            }
+
+            bool LoadDocument(const AZ::IO::Path& path, XmlNode*& root)
+            {
+                auto readOutcome = AZ::Utils::ReadFile<AZStd::string>(path.Native());
+                if (!readOutcome.IsSuccess())
+                {
+                    return Fail(AZStd::string::format("cannot read %s", path.c_str()));
+                }
+                const AZStd::string& content = readOutcome.GetValue();
+                auto document = AZStd::make_unique<Document>();
+                document->m_buffer.reserve(content.size() + 1);
+                document->m_buffer.assign(content.begin(), content.end());
+                document->m_buffer.push_back('\0');
+                document->m_document.parse<AZ::rapidxml::parse_default>(document->m_buffer.data());
+                root = NextElement(document->m_document.first_node());
+                if (!root)
+                {
+                    return Fail(AZStd::string::format("%s has no root element", path.c_str()));
+                }
+                m_inputs.m_readFiles.push_back(path.String());
+                m_documents.push_back(AZStd::move(document));
+                return true;
+            }
+
+            bool ProcessChildren(XmlNode* parent)
+            {
+                for (XmlNode* child = parent->first_node(); child; child = child->next_sibling())
+                {
+                    if (!ProcessNode(child))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            bool ProcessNode(XmlNode* node)
+            {
+                switch (node->type())
+                {
+                case AZ::rapidxml::node_element:
+                    {
+                        const AZStd::string_view name = GetName(node);
+                        if (name.starts_with(XacroPrefix))
+                        {
+                            return ProcessXacroElement(node, name.substr(XacroPrefix.size()));
+                        }
+                        return ProcessElement(node);
+                    }
+                case AZ::rapidxml::node_data:
+                    {
+                        AZStd::string text;
+                        if (!EvaluateText(AZStd::string_view(node->value(), node->value_size()), text))
+                        {
+                            return false;
+                        }
+                        AppendEscaped(m_output, text);
+                        return true;
+                    }
+                case AZ::rapidxml::node_cdata:
+                    m_output += "<![CDATA[";
+                    m_output.append(node->value(), node->value_size());
+                    m_output += "]]>";
+                    return true;
+                default:
+                    return true;
+                }
+            }
+
+            bool ProcessElement(XmlNode* node)
+            {
+                const AZStd::string_view name = GetName(node);
+                m_output += '<';
+                m_output += name;
+                for (const auto* attribute = node->first_attribute(); attribute; attribute = attribute->next_attribute())
+                {
+                    const AZStd::string_view attributeName(attribute->name(), attribute->name_size());
+                    if (attributeName == "xmlns:xacro")
+                    {
+                        continue;
+                    }
+                    AZStd::string value;
+                    if (!EvaluateText(AZStd::string_view(attribute->value(), attribute->value_size()), value))
+                    {
+                        return false;
+                    }
+                    m_output += ' ';
+                    m_output += attributeName;
+                    m_output += "=\"";
+                    AppendEscaped(m_output, value);
+                    m_output += '"';
+                }
+
+                if (!node->first_node())
+                {
+                    m_output += "/>";
+                    return true;
+                }
+                m_output += '>';
+                if (!ProcessChildren(node))
+                {
+                    return false;
+                }
+                m_output += "</";
+                m_output += name;
+                m_output += '>';
+                return true;
+            }
+
+            bool ProcessXacroElement(XmlNode* node, AZStd::string_view xacroName)
+            {
+                if (xacroName == "arg")
+                {
+                    return ProcessArg(node);
+                }
+                if (xacroName == "property")
+                {
+                    return ProcessProperty(node);
+                }
+                if (xacroName == "macro")
+                {
+                    return ProcessMacroDefinition(node);
+                }
+                if (xacroName == "include")
+                {
+                    return ProcessInclude(node);
+                }
+                if (xacroName == "if" || xacroName == "unless")
+                {
+                    const char* conditionText = GetAttribute(node, "value");
+                    if (!conditionText)
+                    {
+                        return Fail(AZStd::string::format("xacro:%.*s without a value", AZ_STRING_ARG(xacroName)));
+                    }
+                    bool condition = false;
+                    if (!EvaluateCondition(conditionText, condition))
+                    {
+                        return false;
+                    }
+                    return condition == (xacroName == "if") ? ProcessChildren(node) : true;
+                }
+                if (xacroName == "insert_block")
+                {
+                    const char* blockName = GetAttribute(node, "name");
+                    const Block* block = blockName ? FindBlock(blockName) : nullptr;
+                    if (!block)
+                    {
+                        return Fail(AZStd::string::format("undefined block '%s'", blockName ? blockName : ""));
+                    }
+                    return block->m_childrenOnly ? ProcessChildren(block->m_node) : ProcessNode(block->m_node);
+                }
+
+                const auto macro = m_macros.find(AZStd::string(xacroName));
+                if (macro == m_macros.end())
+                {
+                    return Fail(AZStd::string::format("unsupported element xacro:%.*s", AZ_STRING_ARG(xacroName)));
+                }
+                return CallMacro(node, macro->second);
+            }
+
+            bool ProcessArg(XmlNode* node)
+            {
+                const char* name = GetAttribute(node, "name");
+                if (!name)
+                {
+                    return Fail("xacro:arg without a name");
+                }
+                const char* defaultValue = GetAttribute(node, "default");
+                if (m_args.contains(name) || !defaultValue)
+                {
+                    return true;
+                }
+                AZStd::string value;
+                if (!EvaluateText(defaultValue, value))
+                {
+                    return false;
+                }
+                m_args.emplace(name, AZStd::move(value));
+                return true;
+            }
+
+            bool ProcessProperty(XmlNode* node)
+            {
+                const char* name = GetAttribute(node, "name");
+                if (!name)
+                {
+                    return Fail("xacro:property without a name");
+                }
+                if (GetAttribute(node, "remove") || GetAttribute(node, "lazy_eval"))
+                {
+                    return Fail(AZStd::string::format("unsupported attribute of xacro:property %s", name));
+                }
+
+                Scope* scope = &m_scopes.back();
+                if (const char* scopeName = GetAttribute(node, "scope"))
+                {
+                    if (strcmp(scopeName, "global") == 0)
+                    {
+                        scope = &m_scopes.front();
+                    }
+                    else if (strcmp(scopeName, "parent") == 0 && m_scopes.size() > 1)
+                    {
+                        scope = &m_scopes[m_scopes.size() - 2];
+                    }
+                }
+
+                const char* value = GetAttribute(node, "value");
+                const char* defaultValue = GetAttribute(node, "default");
+                if (!value && defaultValue)
+                {
+                    if (FindProperty(name))
+                    {
+                        return true;
+                    }
+                    value = defaultValue;
+                }
+                if (!value)
+                {
+                    scope->m_blocks[name] = Block{ node, true };
+                    return true;
+                }
+
+                AZStd::string evaluatedValue;
+                if (!EvaluateText(value, evaluatedValue))
+                {
+                    return false;
+                }
+                scope->m_properties[name] = AZStd::move(evaluatedValue);
+                return true;
+            }
+
+            bool ProcessMacroDefinition(XmlNode* node)
+            {
+                const char* nameAttribute = GetAttribute(node, "name");
+                if (!nameAttribute)
+                {
+                    return Fail("xacro:macro without a name");
+                }
+                AZStd::string_view name(nameAttribute);
+                if (name.starts_with(XacroPrefix))
+                {
+                    name.remove_prefix(XacroPrefix.size());
+                }
+
+                Macro macro;
+                macro.m_node = node;
+                AZStd::vector<AZStd::string> tokens;
+                if (const char* params = GetAttribute(node, "params"))
+                {
+                    AZ::StringFunc::Tokenize(params, tokens, " \t\r\n");
+                }
+                for (AZStd::string_view token : tokens)
+                {
+                    MacroParameter parameter;
+                    if (token.starts_with("**"))
+                    {
+                        parameter.m_kind = MacroParameter::Kind::ContentBlock;
+                        token.remove_prefix(2);
+                    }
+                    else if (token.starts_with("*"))
+                    {
+                        parameter.m_kind = MacroParameter::Kind::Block;
+                        token.remove_prefix(1);
+                    }
+
+                    const size_t assignment = token.find(":=");
+                    if (assignment != AZStd::string_view::npos)
+                    {
+                        AZStd::string_view defaultValue = token.substr(assignment + 2);
+                        token = token.substr(0, assignment);
+                        if (defaultValue.starts_with("^"))
+                        {
+                            // :=^ forwards the value from the calling scope, :=^|value also gives a default
+                            parameter.m_forwarded = true;
+                            defaultValue.remove_prefix(1);
+                            if (defaultValue.starts_with("|"))
+                            {
+                                parameter.m_default = AZStd::string(defaultValue.substr(1));
+                            }
+                        }
+                        else
+                        {
+                            parameter.m_default = AZStd::string(defaultValue);
+                        }
+                    }
+                    parameter.m_name = token;
+                    macro.m_parameters.push_back(AZStd::move(parameter));
+                }
+                m_macros[AZStd::string(name)] = AZStd::move(macro);
+                return true;
+            }
+
+            bool ProcessInclude(XmlNode* node)
+            {
+                const char* filenameAttribute = GetAttribute(node, "filename");
+                if (!filenameAttribute)
+                {
+                    return Fail("xacro:include without a filename");
+                }
+                if (GetAttribute(node, "ns"))
+                {
+                    return Fail(AZStd::string::format("unsupported namespaced include of %s", filenameAttribute));
+                }
+                AZStd::string filename;
+                if (!EvaluateText(filenameAttribute, filename))
+                {
+                    return false;
+                }
+
+                AZ::IO::Path path(filename);
+                if (path.IsRelative())
+                {
+                    path = m_includeStack.back().ParentPath() / path;
+                }
+                path = path.LexicallyNormal();
+
+                // A file may be included more than once, but not while it is being expanded
+                if (auto including = AZStd::find(m_includeStack.begin(), m_includeStack.end(), path); including != m_includeStack.end())
+                {
+                    AZStd::string cycle;
+                    for (; including != m_includeStack.end(); ++including)
+                    {
+                        cycle += including->String() + " -> ";
+                    }
+                    return Fail(AZStd::string::format("include cycle %s%s", cycle.c_str(), path.c_str()));
+                }
+                if (m_includeStack.size() > MaxIncludeDepth)
+                {
+                    return Fail(AZStd::string::format("includes are nested too deeply at %s", path.c_str()));
+                }
+
+                XmlNode* root = nullptr;
+                if (!LoadDocument(path, root))
+                {
+                    return false;
+                }
+                m_includeStack.push_back(path);
+                const bool result = ProcessChildren(root);
+                m_includeStack.pop_back();
+                return result;
+            }
+
+            bool CallMacro(XmlNode* node, const Macro& macro)
+            {
+                const AZStd::string_view macroName = GetName(node);
+                for (const auto* attribute = node->first_attribute(); attribute; attribute = attribute->next_attribute())
+                {
+                    const AZStd::string_view attributeName(attribute->name(), attribute->name_size());
+                    const bool isParameter = AZStd::any_of(
+                        macro.m_parameters.begin(),
+                        macro.m_parameters.end(),
+                        [attributeName](const MacroParameter& parameter)
+                        {
+                            return parameter.m_kind == MacroParameter::Kind::Value && parameter.m_name == attributeName;
+                        });
+                    if (!isParameter)
+                    {
+                        return Fail(AZStd::string::format(
+                            "unknown parameter %.*s of %.*s", AZ_STRING_ARG(attributeName), AZ_STRING_ARG(macroName)));
+                    }
+                }
+
+                Scope scope;
+                XmlNode* blockElement = NextElement(node->first_node());
+                for (const MacroParameter& parameter : macro.m_parameters)
+                {
+                    if (parameter.m_kind != MacroParameter::Kind::Value)
+                    {
+                        if (!blockElement)
+                        {
+                            return Fail(AZStd::string::format(
+                                "missing block %s of %.*s", parameter.m_name.c_str(), AZ_STRING_ARG(macroName)));
+                        }
+                        scope.m_blocks[parameter.m_name] = Block{ blockElement, parameter.m_kind == MacroParameter::Kind::ContentBlock };
+                        blockElement = NextElement(blockElement->next_sibling());
+                        continue;
+                    }
+
+                    AZStd::string value;
+                    if (const char* argument = GetAttribute(node, parameter.m_name.c_str()))
+                    {
+                        if (!EvaluateText(argument, value))
+                        {
+                            return false;
+                        }
+                    }
+                    else if (const AZStd::string* forwarded = parameter.m_forwarded ? FindProperty(parameter.m_name) : nullptr)
+                    {
+                        value = *forwarded;
+                    }
+                    else if (parameter.m_default)
+                    {
+                        if (!EvaluateText(*parameter.m_default, value))
+                        {
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        return Fail(AZStd::string::format(
+                            "missing parameter %s of %.*s", parameter.m_name.c_str(), AZ_STRING_ARG(macroName)));
+                    }
+                    scope.m_properties[parameter.m_name] = AZStd::move(value);
+                }
+
+                if (m_scopes.size() > MaxMacroDepth)
+                {
+                    return Fail(AZStd::string::format("macros are nested too deeply at %.*s", AZ_STRING_ARG(macroName)));
+                }
+                // Scopes are dynamic as in xacro: the body of a macro sees properties of the scope the macro is called from
+                m_scopes.push_back(AZStd::move(scope));
+                const bool result = ProcessChildren(macro.m_node);
+                m_scopes.pop_back();
+                return result;
+            }
+
+            const AZStd::string* FindProperty(const AZStd::string& name) const
+            {
+                for (auto scope = m_scopes.rbegin(); scope != m_scopes.rend(); ++scope)
+                {
+                    if (const auto property = scope->m_properties.find(name); property != scope->m_properties.end())
+                    {
+                        return &property->second;
+                    }
+                }
+                return nullptr;
+            }
+
+            const Block* FindBlock(const AZStd::string& name) const
+            {
+                for (auto scope = m_scopes.rbegin(); scope != m_scopes.rend(); ++scope)
+                {
+                    if (const auto block = scope->m_blocks.find(name); block != scope->m_blocks.end())
+                    {
+                        return &block->second;
+                    }
+                }
+                return nullptr;
+            }
+
+            bool EvaluateText(AZStd::string_view text, AZStd::string& result)
+            {
+                result.clear();
+                size_t position = 0;
+                while (position < text.size())
+                {
+                    const size_t dollar = text.find('$', position);
+                    if (dollar == AZStd::string_view::npos || dollar + 1 == text.size())
+                    {
+                        result.append(text.substr(position));
+                        break;
+                    }
+                    result.append(text.substr(position, dollar - position));
+
+                    const char next = text[dollar + 1];
+                    if (next == '$' && dollar + 2 < text.size() && (text[dollar + 2] == '{' || text[dollar + 2] == '('))
+                    { // $${ and $$( are escaped ${ and $(
+                        result += '$';
+                        result += text[dollar + 2];
+                        position = dollar + 3;
+                        continue;
+                    }
+                    if (next != '{' && next != '(')
+                    {
+                        result += '$';
+                        position = dollar + 1;
+                        continue;
+                    }
+
+                    const size_t close = text.find(next == '{' ? '}' : ')', dollar + 2);
+                    if (close == AZStd::string_view::npos)
+                    {
+                        return Fail(AZStd::string::format("unterminated '$%c' in '%.*s'", next, AZ_STRING_ARG(text)));
+                    }
+                    const AZStd::string_view inner = text.substr(dollar + 2, close - dollar - 2);
+                    if (next == '{')
+                    {
+                        Value value;
+                        if (!EvaluateExpression(inner, value))
+                        {
+                            return false;
+                        }
+                        result += value.ToString();
+                    }
+                    else
+                    {
+                        AZStd::string substitution;
+                        if (!EvaluateSubstitution(inner, substitution))
+                        {
+                            return false;
+                        }
+                        result += substitution;
+                    }
+                    position = close + 1;
+                }
+                return true;
+            }
+
+            bool EvaluateExpression(AZStd::string_view expression, Value& value)
+            {
+                const NameResolver resolveName = [this](const AZStd::string& name) -> AZ::Outcome<Value, AZStd::string>
+                {
+                    if (const AZStd::string* property = FindProperty(name))
+                    {
+                        return AZ::Success(Value::FromText(*property));
+                    }
+                    return AZ::Failure(AZStd::string::format("undefined property %s", name.c_str()));
+                };
+                ExpressionParser parser(expression, resolveName);
+                auto outcome = parser.Parse();
+                if (!outcome.IsSuccess())
+                {
+                    return Fail(
+                        AZStd::string::format("cannot evaluate ${%.*s}: %s", AZ_STRING_ARG(expression), outcome.GetError().c_str()));
+                }
+                value = outcome.TakeValue();
+                return true;
+            }
+
+            bool EvaluateSubstitution(AZStd::string_view substitution, AZStd::string& result)
+            {
+                AZStd::vector<AZStd::string> tokens;
+                AZ::StringFunc::Tokenize(substitution, tokens, " \t\r\n");
+                if (tokens.empty())
+                {
+                    return Fail("empty $() substitution");
+                }
+
+                const AZStd::string& command = tokens[0];
+                if (command == "arg" && tokens.size() == 2)
+                {
+                    const auto arg = m_args.find(tokens[1]);
+                    if (arg == m_args.end())
+                    {
+                        return Fail(AZStd::string::format("undefined argument %s", tokens[1].c_str()));
+                    }
+                    result = arg->second;
+                    return true;
+                }
+                if (command == "find" && tokens.size() == 2)
+                {
+                    return FindPackage(tokens[1], result);
+                }
+                if ((command == "env" && tokens.size() == 2) || (command == "optenv" && tokens.size() >= 2))
+                {
+                    if (const auto value = ReadEnvironmentVariable(tokens[1]))
+                    {
+                        result = *value;
+                        return true;
+                    }
+                    if (command == "env")
+                    {
+                        return Fail(AZStd::string::format("undefined environment variable %s", tokens[1].c_str()));
+                    }
+                    result.clear();
+                    for (size_t i = 2; i < tokens.size(); ++i)
+                    {
+                        result += (i > 2 ? " " : "") + tokens[i];
+                    }
+                    return true;
+                }
+                if (command == "dirname" && tokens.size() == 1)
+                {
+                    result = m_includeStack.back().ParentPath().String();
+                    return true;
+                }
+                return Fail(AZStd::string::format("unsupported substitution $(%.*s)", AZ_STRING_ARG(substitution)));
+            }
+
+            bool EvaluateCondition(AZStd::string_view text, bool& condition)
+            {
+                AZStd::string value;
+                if (!EvaluateText(text, value))
+                {
+                    return false;
+                }
+                AZ::StringFunc::TrimWhiteSpace(value, true, true);
+                AZStd::to_lower(value.begin(), value.end());
+                if (value == "true" || value == "false")
+                {
+                    condition = value == "true";
+                    return true;
+                }
+                const Value number = Value::FromText(value);
+                if (!number.IsNumeric())
+                {
+                    return Fail(AZStd::string::format("'%s' is not a boolean value", value.c_str()));
+                }
+                condition = number.IsTruthy();
+                return true;
+            }
+
+            //! Reads an environment variable, recording its value in the inputs of the expansion.
+            AZStd::optional<AZStd::string> ReadEnvironmentVariable(const AZStd::string& name)
+            {
+                auto value = GetEnvironmentValue(name);
+                m_inputs.m_environment.emplace(name, value);
+                return value;
+            }
+
+            bool FindPackage(const AZStd::string& name, AZStd::string& result)
+            {
+                auto path = Internal::FindPackage(name, m_rootDirectory, ReadEnvironmentVariable("AMENT_PREFIX_PATH"));
+                if (!path)
+                {
+                    return Fail(AZStd::string::format("cannot find package %s", name.c_str()));
+                }
+                result = *path;
+                m_inputs.m_packages.emplace(name, AZStd::move(*path));
+                return true;
+            }
+
+            AZStd::unordered_map<AZStd::string, AZStd::string> m_args;
+            AZStd::vector<AZStd::unique_ptr<Document>> m_documents; //!< Documents stay loaded, macros and blocks point to their nodes.
+            AZStd::vector<Scope> m_scopes; //!< Global scope first, then a scope for each macro being expanded.
+            AZStd::unordered_map<AZStd::string, Macro> m_macros;
+            AZ::IO::Path m_rootDirectory;
+            AZStd::vector<AZ::IO::Path> m_includeStack; //!< Files being expanded, the expanded file first and the innermost include last.
+            ExpansionInputs m_inputs;
+            AZStd::string m_output;
+            AZStd::string m_error;
+        };
+    } // namespace Internal
+
+    AZ::Outcome<AZStd::string, AZStd::string> ExpandXacro(
+        const AZStd::string& filename, const AZStd::unordered_map<AZStd::string, AZStd::string>& params, ExpansionInputs& inputs)
+    {
+        Internal::XacroExpander expander(params);
+        auto outcome = expander.Expand(filename);
+        inputs = expander.GetInputs();
+        return outcome;
+    }
+
+    AZStd::optional<AZStd::string> FindPackage(const AZStd::string& name, const AZStd::string& filename)
+    {
+        const AZ::IO::Path rootDirectory = AZ::IO::Path(filename).LexicallyNormal().ParentPath();
+        return Internal::FindPackage(name, rootDirectory, Internal::GetEnvironmentValue("AMENT_PREFIX_PATH"));
+    }
+} // namespace ROS2::Utils::xacro
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/string/string.h>
+
+namespace ROS2::Utils::xacro
+{
+    //! Inputs of an expansion besides its params, the expansion can be reused as long as none of them changes.
+    struct ExpansionInputs
+    {
+        AZStd::vector<AZStd::string> m_readFiles; //!< Files read by the expansion, the expanded file first.
+        //! Environment variables read by $(env), $(optenv) and $(find), with their values or nothing if they were not set.
+        AZStd::unordered_map<AZStd::string, AZStd::optional<AZStd::string>> m_environment;
+        AZStd::unordered_map<AZStd::string, AZStd::string> m_packages; //!< Paths of packages found by $(find).
+    };
+
+    //! Expand a xacro file to URDF in process, without the xacro executable.
+    //! A subset of xacro is supported: xacro:arg, xacro:property (values and blocks), xacro:macro with regular, block (*) and
+    //! content block (**) parameters, xacro:insert_block, xacro:include, xacro:if and xacro:unless, ${} expressions with
+    //! arithmetic, comparisons, boolean operators and common math functions, and $(arg), $(find), $(env), $(optenv) and
+    //! $(dirname) substitutions. Packages for $(find) are looked up in AMENT_PREFIX_PATH and next to folders of the expanded file.
+    //! Anything else makes the expansion fail with a description, so that the caller can use the xacro executable instead.
+    //! So do include cycles, with the files of the cycle in the description, and includes nested too deeply.
+    //! @param filename path to the xacro file.
+    //! @param params values of arguments, which override defaults given in xacro:arg elements.
+    //! @param inputs filled with the files, environment variables and packages the expansion depends on.
+    //! @returns the URDF document or a description of the reason the file could not be expanded.
+    AZ::Outcome<AZStd::string, AZStd::string> ExpandXacro(
+        const AZStd::string& filename, const AZStd::unordered_map<AZStd::string, AZStd::string>& params, ExpansionInputs& inputs);
+
+    //! Finds a package the way $(find) does in the expansion of a file.
+    //! @param name name of the package.
+    //! @param filename path to the expanded xacro file.
+    //! @returns path to the package, or nothing if it cannot be found.
+    AZStd::optional<AZStd::string> FindPackage(const AZStd::string& name, const AZStd::string& filename);
+} // namespace ROS2::Utils::xacro
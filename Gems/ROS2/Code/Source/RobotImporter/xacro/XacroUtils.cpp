@@ -7,17 +7,132 @@
  */
 
 #include "XacroUtils.h"
+#include "XacroEvaluator.h"
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/XML/rapidxml.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Process/ProcessCommunicator.h>
 #include <AzFramework/Process/ProcessWatcher.h>
 #include <QString>
+#include <RobotImporter/Utils/SourceAssetsStorage.h>
+#include <cstdlib>
 
 namespace ROS2::Utils::xacro
 {
+    namespace Internal
+    {
+        ExecutionOutcome CallXacroExecutable(const AZStd::string& filename, const Params& params);
+    } // namespace Internal
+
+    AZStd::string ExpansionCache::GetKey(const AZStd::string& filename, const Params& params)
+    {
+        AZStd::vector<AZStd::string> sortedParams;
+        sortedParams.reserve(params.size());
+        for (const auto& [name, value] : params)
+        {
+            sortedParams.push_back(name + ":=" + value);
+        }
+        AZStd::sort(sortedParams.begin(), sortedParams.end());
+
+        AZStd::string key = filename;
+        for (const auto& param : sortedParams)
+        {
+            key += '\n';
+            key += param;
+        }
+        return key;
+    }
+
+    AZStd::optional<AZStd::string> ExpansionCache::Find(const AZStd::string& filename, const Params& params) const
+    {
+        AZStd::lock_guard lock(m_mutex);
+        const auto entry = m_entries.find(GetKey(filename, params));
+        if (entry == m_entries.end())
+        {
+            return AZStd::nullopt;
+        }
+        for (const auto& [name, value] : entry->second.m_environment)
+        {
+            const char* currentValue = std::getenv(name.c_str());
+            if (value != (currentValue ? AZStd::optional<AZStd::string>(currentValue) : AZStd::nullopt))
+            {
+                AZ_Printf("ParseXacro", "Environment variable %s has changed since %s was expanded\n", name.c_str(), filename.c_str());
+                return AZStd::nullopt;
+            }
+        }
+        for (const auto& [name, path] : entry->second.m_packages)
+        {
+            if (FindPackage(name, filename) != path)
+            {
+                AZ_Printf("ParseXacro", "Package %s has moved since %s was expanded\n", name.c_str(), filename.c_str());
+                return AZStd::nullopt;
+            }
+        }
+        for (const auto& [file, hash] : entry->second.m_fileHashes)
+        {
+            if (Utils::GetFileHash(file) != hash)
+            {
+                AZ_Printf("ParseXacro", "%s has changed since %s was expanded\n", file.c_str(), filename.c_str());
+                return AZStd::nullopt;
+            }
+        }
+        return entry->second.m_urdf;
+    }
+
+    void ExpansionCache::Store(
+        const AZStd::string& filename, const Params& params, const AZStd::string& urdf, const ExpansionInputs& inputs)
+    {
+        Entry entry;
+        entry.m_urdf = urdf;
+        entry.m_fileHashes.reserve(inputs.m_readFiles.size());
+        for (const auto& file : inputs.m_readFiles)
+        {
+            entry.m_fileHashes.emplace_back(file, Utils::GetFileHash(file));
+        }
+        entry.m_environment = inputs.m_environment;
+        entry.m_packages = inputs.m_packages;
+
+        AZStd::lock_guard lock(m_mutex);
+        m_entries[GetKey(filename, params)] = AZStd::move(entry);
+    }
+
+    ExecutionOutcome ParseXacro(const AZStd::string& filename, const Params& params, ExpansionCache* cache)
+    {
+        ExecutionOutcome outcome;
+        outcome.m_called = AZStd::string::format("in-process xacro expansion of %s", filename.c_str());
+
+        if (cache)
+        {
+            if (auto urdf = cache->Find(filename, params))
+            {
+                AZ_Printf("ParseXacro", "Using cached expansion of %s\n", filename.c_str());
+                outcome.m_urdfHandle = UrdfParser::Parse(*urdf);
+                outcome.m_succeed = true;
+                return outcome;
+            }
+        }
+
+        ExpansionInputs inputs;
+        auto expansion = ExpandXacro(filename, params, inputs);
+        if (!expansion.IsSuccess())
+        {
+            AZ_Printf("ParseXacro", "Cannot expand %s in process: %s\n", filename.c_str(), expansion.GetError().c_str());
+            return Internal::CallXacroExecutable(filename, params);
+        }
+
+        AZ_Printf("ParseXacro", "Expanded %s in process from %zu files\n", filename.c_str(), inputs.m_readFiles.size());
+        const AZStd::string& urdf = expansion.GetValue();
+        if (cache)
+        {
+            cache->Store(filename, params, urdf, inputs);
+        }
+        outcome.m_urdfHandle = UrdfParser::Parse(urdf);
+        outcome.m_succeed = true;
+        return outcome;
+    }
 
-    ExecutionOutcome ParseXacro(const AZStd::string& filename, const Params& params)
+    ExecutionOutcome Internal::CallXacroExecutable(const AZStd::string& filename, const Params& params)
     {
         ExecutionOutcome outcome;
         // test if xacro exists
@@ -9,7 +9,11 @@
 #pragma once
 
 #include <RobotImporter/URDF/UrdfParser.h>
+#include <RobotImporter/xacro/XacroEvaluator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
 
 namespace ROS2::Utils::xacro
@@ -41,7 +45,40 @@ namespace ROS2::Utils::xacro
     AZStd::unordered_map<AZStd::string, AZStd::string> GetParameterFromXacroData(const AZStd::string& data);
     AZStd::unordered_map<AZStd::string, AZStd::string> GetParameterFromXacroFile(const AZStd::string& filename);
 
-    ExecutionOutcome ParseXacro(const AZStd::string& filename, const Params& params);
+    //! URDF documents expanded in process from xacro files, kept as long as none of the inputs of the expansion changes.
+    class ExpansionCache
+    {
+    public:
+        //! Finds the URDF expanded from the file with the same params.
+        //! @returns the URDF document, or nothing if it was not expanded or any of the files it was read from, environment
+        //! variables it read or packages it found have changed since.
+        AZStd::optional<AZStd::string> Find(const AZStd::string& filename, const Params& params) const;
+
+        //! Stores the URDF expanded from the file with the params, with content hashes of all files read by the expansion.
+        void Store(const AZStd::string& filename, const Params& params, const AZStd::string& urdf, const ExpansionInputs& inputs);
+
+    private:
+        struct Entry
+        {
+            AZStd::string m_urdf;
+            AZStd::vector<AZStd::pair<AZStd::string, AZ::u64>> m_fileHashes;
+            AZStd::unordered_map<AZStd::string, AZStd::optional<AZStd::string>> m_environment;
+            AZStd::unordered_map<AZStd::string, AZStd::string> m_packages;
+        };
+
+        static AZStd::string GetKey(const AZStd::string& filename, const Params& params);
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZStd::string, Entry> m_entries; //!< Keyed by the file name followed by sorted params.
+    };
+
+    //! Converts a xacro file to URDF and parses it.
+    //! The file is expanded in process when it only uses the supported subset of xacro (see ExpandXacro),
+    //! otherwise the xacro executable is called.
+    //! @param filename path to the xacro file.
+    //! @param params values of xacro arguments.
+    //! @param cache optional cache of in-process expansions, which are reused if none of the files they were read from has changed.
+    ExecutionOutcome ParseXacro(const AZStd::string& filename, const Params& params, ExpansionCache* cache = nullptr);
 
 
 } // namespace ROS2::Utils::xacro
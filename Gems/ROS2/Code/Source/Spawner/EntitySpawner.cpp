@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "EntitySpawner.h"
+#include <AzCore/Component/Entity.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <ROS2/Frame/ROS2FrameComponent.h>
+#include <ROS2/ROS2GemUtilities.h>
+
+namespace ROS2
+{
+    namespace Internal
+    {
+        void PreSpawn(AzFramework::SpawnableEntityContainerView view, const AZ::Transform& transform, const AZStd::string& instanceName)
+        {
+            if (view.empty())
+            {
+                return;
+            }
+            AZ::Entity* root = *view.begin();
+
+            auto* transformInterface = root->FindComponent<AzFramework::TransformComponent>();
+            transformInterface->SetWorldTM(transform);
+
+            for (AZ::Entity* entity : view)
+            { // Update name for the first entity with ROS2Frame in hierarchy (left to right)
+                const auto* frameComponent = Utils::GetGameOrEditorComponent<ROS2FrameComponent>(entity);
+                if (frameComponent)
+                {
+                    entity->SetName(instanceName);
+                    break;
+                }
+            }
+        }
+    } // namespace Internal
+
+    void EntitySpawner::SpawnBatch(const AZStd::vector<SpawnEntityDescription>& entities, SpawnBatchCallback callback)
+    {
+        if (entities.empty())
+        { // No completion would ever report an empty batch
+            if (callback)
+            {
+                callback({});
+            }
+            return;
+        }
+
+        struct PendingBatch
+        {
+            AZStd::vector<SpawnedInstance> m_instances;
+            size_t m_pendingCount = 0;
+            SpawnBatchCallback m_callback;
+        };
+
+        auto batch = AZStd::make_shared<PendingBatch>();
+        batch->m_pendingCount = entities.size();
+        batch->m_callback = AZStd::move(callback);
+        batch->m_instances.reserve(entities.size());
+        for (const auto& entity : entities)
+        {
+            batch->m_instances.push_back({ AZStd::string::format("%s_%d", entity.m_spawnableName.c_str(), m_counter++), {} });
+        }
+
+        auto completeOne = [batch](size_t index, const AZStd::vector<AZ::EntityId>& entityIds)
+        {
+            batch->m_instances[index].m_entityIds = entityIds;
+            if (--batch->m_pendingCount == 0 && batch->m_callback)
+            {
+                batch->m_callback(batch->m_instances);
+            }
+        };
+
+        auto spawner = AZ::Interface<AzFramework::SpawnableEntitiesDefinition>::Get();
+        AZ_Assert(spawner, "No spawnable entities interface");
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            const AZ::Transform& transform = entities[i].m_transform;
+            const AZStd::string& instanceName = batch->m_instances[i].m_name;
+            if (const auto* pooledEntityIds = m_instancePool.Acquire(entities[i].m_spawnableName, transform, instanceName))
+            {
+                completeOne(i, *pooledEntityIds);
+                continue;
+            }
+
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_preInsertionCallback = [transform, instanceName]([[maybe_unused]] auto id, auto view)
+            {
+                Internal::PreSpawn(view, transform, instanceName);
+            };
+            optionalArgs.m_completionCallback = [completeOne, i]([[maybe_unused]] auto id, auto view)
+            {
+                AZStd::vector<AZ::EntityId> entityIds;
+                entityIds.reserve(view.size());
+                for (const AZ::Entity* entity : view)
+                {
+                    entityIds.push_back(entity->GetId());
+                }
+                completeOne(i, entityIds);
+            };
+
+            // Each instance has its own ticket, so that it can be deleted alone
+            auto ticket = m_tickets.emplace(instanceName, AzFramework::EntitySpawnTicket(entities[i].m_spawnable)).first;
+            spawner->SpawnAllEntities(ticket->second, AZStd::move(optionalArgs));
+        }
+    }
+
+    bool EntitySpawner::Delete(const AZStd::string& instanceName)
+    {
+        if (m_instancePool.Release(instanceName))
+        {
+            return true;
+        }
+
+        auto ticket = m_tickets.find(instanceName);
+        if (ticket == m_tickets.end())
+        {
+            return false;
+        }
+
+        // Despawning is queued, entities of the ticket are removed even after the ticket is released
+        AZ::Interface<AzFramework::SpawnableEntitiesDefinition>::Get()->DespawnAllEntities(ticket->second);
+        m_tickets.erase(ticket);
+        return true;
+    }
+
+    void EntitySpawner::Clear()
+    {
+        // Destroying tickets despawns their entities
+        m_tickets.clear();
+        m_instancePool.Clear();
+    }
+
+    SpawnableInstancePool& EntitySpawner::GetInstancePool()
+    {
+        return m_instancePool;
+    }
+} // namespace ROS2
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "SpawnableInstancePool.h"
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+
+namespace ROS2
+{
+    //! Entity to spawn, as a part of a batch.
+    struct SpawnEntityDescription
+    {
+        AZStd::string m_spawnableName;
+        AZ::Data::Asset<AzFramework::Spawnable> m_spawnable;
+        AZ::Transform m_transform;
+    };
+
+    //! Spawned instance of a spawnable.
+    struct SpawnedInstance
+    {
+        AZStd::string m_name; //!< Name of the first entity with a ROS2 frame.
+        AZStd::vector<AZ::EntityId> m_entityIds; //!< Entities of the instance, root first.
+    };
+
+    //! Spawns named instances of spawnables in batches and deletes them by name.
+    //! Instances are taken from the instance pool when it has one available, and spawned from the asset otherwise.
+    class EntitySpawner
+    {
+    public:
+        //! Called once all entities of a batch are spawned, with spawned instances in order of the batch.
+        using SpawnBatchCallback = AZStd::function<void(const AZStd::vector<SpawnedInstance>& instances)>;
+
+        //! Queues spawning of entities. All spawns are queued at once, the spawnable system runs pre-insertion of each of them
+        //! and reports their completion in order.
+        //! @param callback called once all entities are spawned, right away for an empty batch. Can be empty.
+        void SpawnBatch(const AZStd::vector<SpawnEntityDescription>& entities, SpawnBatchCallback callback);
+
+        //! Despawns an instance, or returns it to the instance pool.
+        //! @returns false if there is no spawned instance with this name.
+        bool Delete(const AZStd::string& instanceName);
+
+        //! Despawns all instances, including the pooled ones.
+        void Clear();
+
+        SpawnableInstancePool& GetInstancePool();
+
+    private:
+        int m_counter = 1;
+        AZStd::unordered_map<AZStd::string, AzFramework::EntitySpawnTicket> m_tickets; //!< Spawned instances by name, without pooled ones.
+        SpawnableInstancePool m_instancePool;
+    };
+} // namespace ROS2
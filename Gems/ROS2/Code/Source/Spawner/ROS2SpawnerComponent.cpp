@@ -9,6 +9,8 @@
 #include "ROS2SpawnerComponent.h"
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
 #include <ROS2/ROS2Bus.h>
@@ -17,9 +19,48 @@
 
 namespace ROS2
 {
+    namespace Internal
+    {
+        //! Prefix of entries of spawned_entities for entities which could not be spawned, followed by the status.
+        constexpr const char* SpawnFailedPrefix = "error: ";
+
+        //! Describes an instance for clients as YAML: namespace, frames and entity ids.
+        AZStd::string DescribeSpawnedInstance(const SpawnedInstance& instance)
+        {
+            AZStd::string ros2Namespace;
+            AZStd::string frames;
+            AZStd::string entities;
+            for (const AZ::EntityId& entityId : instance.m_entityIds)
+            {
+                entities += AZStd::string::format("%s%llu", entities.empty() ? "" : ", ", static_cast<AZ::u64>(entityId));
+
+                AZ::Entity* entity = nullptr;
+                AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationRequests::FindEntity, entityId);
+                const auto* frameComponent = entity ? Utils::GetGameOrEditorComponent<ROS2FrameComponent>(entity) : nullptr;
+                if (!frameComponent)
+                {
+                    continue;
+                }
+                if (ros2Namespace.empty())
+                {
+                    ros2Namespace = frameComponent->GetNamespace();
+                }
+                frames += AZStd::string::format("%s%s", frames.empty() ? "" : ", ", frameComponent->GetFrameID().c_str());
+            }
+            return AZStd::string::format(
+                "name: %s\nnamespace: %s\nframes: [%s]\nentities: [%s]",
+                instance.m_name.c_str(),
+                ros2Namespace.c_str(),
+                frames.c_str(),
+                entities.c_str());
+        }
+    } // namespace Internal
 
     void ROS2SpawnerComponent::Activate()
     {
+        AZ::TransformNotificationBus::Handler::BusConnect(GetEntityId());
+        m_spawnPointsValid = false;
+
         auto ros2Node = ROS2Interface::Get()->GetNode();
 
         m_getSpawnablesNamesService = ros2Node->create_service<gazebo_msgs::srv::GetWorldProperties>(
@@ -31,9 +72,9 @@ namespace ROS2
 
         m_spawnService = ros2Node->create_service<gazebo_msgs::srv::SpawnEntity>(
             "spawn_entity",
-            [this](const SpawnEntityRequest request, SpawnEntityResponse response)
+            [this](const std::shared_ptr<rmw_request_id_t> requestHeader, const SpawnEntityRequest request)
             {
-                SpawnEntity(request, response);
+                SpawnEntity(requestHeader, request);
             });
 
         m_getSpawnPointInfoService = ros2Node->create_service<gazebo_msgs::srv::GetModelState>(
@@ -49,14 +90,51 @@ namespace ROS2
             {
                 GetSpawnPointsNames(request, response);
             });
+
+        m_deleteService = ros2Node->create_service<gazebo_msgs::srv::DeleteEntity>(
+            "delete_entity",
+            [this](const DeleteEntityRequest request, DeleteEntityResponse response)
+            {
+                DeleteEntity(request, response);
+            });
+
+        m_spawnedEntitiesPublisher =
+            ros2Node->create_publisher<gazebo_msgs::msg::ModelStates>("spawned_entities", rclcpp::ServicesQoS());
+        m_spawnEntitiesSubscription = ros2Node->create_subscription<gazebo_msgs::msg::ModelStates>(
+            "spawn_entities",
+            rclcpp::ServicesQoS(),
+            [this](const gazebo_msgs::msg::ModelStates& message)
+            {
+                SpawnEntities(message);
+            });
+
+        for (const auto& [spawnableName, spawnable] : m_spawnables)
+        {
+            m_entitySpawner.GetInstancePool().Fill(spawnableName, spawnable, m_instancePoolSize);
+        }
     }
 
     void ROS2SpawnerComponent::Deactivate()
     {
+        // Clients waiting for a spawn get an answer, the completion callbacks of pending spawns do not respond anymore
+        for (const auto& requestHeader : m_pendingSpawnRequests)
+        {
+            gazebo_msgs::srv::SpawnEntity::Response response;
+            response.success = false;
+            response.status_message = "Spawner was deactivated before the entity was spawned";
+            m_spawnService->send_response(*requestHeader, response);
+        }
+        m_pendingSpawnRequests.clear();
+
         m_getSpawnablesNamesService.reset();
         m_spawnService.reset();
         m_getSpawnPointInfoService.reset();
         m_getSpawnPointsNamesService.reset();
+        m_spawnEntitiesSubscription.reset();
+        m_spawnedEntitiesPublisher.reset();
+        m_deleteService.reset();
+        m_entitySpawner.GetInstancePool().Clear();
+        AZ::TransformNotificationBus::Handler::BusDisconnect();
     }
 
     void ROS2SpawnerComponent::Reflect(AZ::ReflectContext* context)
@@ -64,9 +142,10 @@ namespace ROS2
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serialize->Class<ROS2SpawnerComponent, AZ::Component>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("Spawnables", &ROS2SpawnerComponent::m_spawnables)
-                ->Field("Default spawn point", &ROS2SpawnerComponent::m_defaultSpawnPose);
+                ->Field("Default spawn point", &ROS2SpawnerComponent::m_defaultSpawnPose)
+                ->Field("Instance pool size", &ROS2SpawnerComponent::m_instancePoolSize);
 
             if (AZ::EditContext* ec = serialize->GetEditContext())
             {
@@ -79,7 +158,13 @@ namespace ROS2
                         AZ::Edit::UIHandlers::EntityId,
                         &ROS2SpawnerComponent::m_defaultSpawnPose,
                         "Default spawn pose",
-                        "Default spawn pose");
+                        "Default spawn pose")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ROS2SpawnerComponent::m_instancePoolSize,
+                        "Instance pool size",
+                        "Number of inactive instances of each spawnable, spawned on activation. Spawning takes an instance from the pool "
+                        "and deleting returns it, which is much faster than spawning from the asset");
             }
         }
     }
@@ -93,84 +178,118 @@ namespace ROS2
         }
     }
 
-    void ROS2SpawnerComponent::SpawnEntity(const SpawnEntityRequest request, SpawnEntityResponse response)
+    void ROS2SpawnerComponent::SpawnEntity(const std::shared_ptr<rmw_request_id_t> requestHeader, const SpawnEntityRequest request)
     {
         AZStd::string spawnableName(request->name.c_str());
         AZStd::string spawnPointName(request->xml.c_str(), request->xml.size());
 
-        auto spawnPoints = GetSpawnPoints();
-
         if (!m_spawnables.contains(spawnableName))
         {
-            response->success = false;
-            response->status_message = "Could not find spawnable with given name: " + request->name;
+            gazebo_msgs::srv::SpawnEntity::Response response;
+            response.success = false;
+            response.status_message = "Could not find spawnable with given name: " + request->name;
+            m_spawnService->send_response(*requestHeader, response);
             return;
         }
 
-        if (!m_tickets.contains(spawnableName))
-        {
-            // if a ticket for this spawnable was not created but the spawnable name is correct, create the ticket and then use it to
-            // spawn an entity
-            auto spawnable = m_spawnables.find(spawnableName);
-            m_tickets.emplace(spawnable->first, AzFramework::EntitySpawnTicket(spawnable->second));
-        }
-
-        auto spawner = AZ::Interface<AzFramework::SpawnableEntitiesDefinition>::Get();
+        const AZStd::optional<SpawnPointInfo> spawnPoint = FindSpawnPoint(spawnPointName);
+        const AZ::Transform transform = spawnPoint ? spawnPoint->pose : ROS2Conversions::FromROS2Pose(request->initial_pose);
 
-        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
-
-        AZ::Transform transform;
+        // The response is deferred until the robot exists, so that clients do not need to poll for it
+        m_pendingSpawnRequests.push_back(requestHeader);
+        m_entitySpawner.SpawnBatch(
+            { SpawnEntityDescription{ spawnableName, m_spawnables.at(spawnableName), transform } },
+            [this, requestHeader](const AZStd::vector<SpawnedInstance>& instances)
+            {
+                auto pending = AZStd::find(m_pendingSpawnRequests.begin(), m_pendingSpawnRequests.end(), requestHeader);
+                if (pending == m_pendingSpawnRequests.end())
+                {
+                    return; // Already answered on deactivation
+                }
+                m_pendingSpawnRequests.erase(pending);
+
+                gazebo_msgs::srv::SpawnEntity::Response response;
+                response.success = true;
+                response.status_message = Internal::DescribeSpawnedInstance(instances.front()).c_str();
+                m_spawnService->send_response(*requestHeader, response);
+            });
+    }
 
-        if (spawnPoints.contains(spawnPointName))
-        {
-            transform = spawnPoints.at(spawnPointName).pose;
-        }
-        else
+    void ROS2SpawnerComponent::SpawnEntities(const gazebo_msgs::msg::ModelStates& message)
+    {
+        // The result has an entry for each requested entity, entities which cannot be spawned are named with their status
+        gazebo_msgs::msg::ModelStates result;
+        result.name.resize(message.name.size());
+        result.pose.resize(message.name.size());
+        result.twist.resize(message.name.size());
+        const auto fail = [&result](size_t index, const AZStd::string& status)
         {
-            transform = { AZ::Vector3(request->initial_pose.position.x, request->initial_pose.position.y, request->initial_pose.position.z),
-                          AZ::Quaternion(
-                              request->initial_pose.orientation.x,
-                              request->initial_pose.orientation.y,
-                              request->initial_pose.orientation.z,
-                              request->initial_pose.orientation.w),
-                          1.0f };
-        }
+            AZ_Error("ROS2SpawnerComponent", false, "%s", status.c_str());
+            result.name[index] = (Internal::SpawnFailedPrefix + status).c_str();
+        };
 
-        optionalArgs.m_preInsertionCallback = [this, transform, spawnableName](auto id, auto view)
+        // Entities to spawn, with their entries in the result
+        AZStd::vector<SpawnEntityDescription> entities;
+        AZStd::vector<size_t> entryIndices;
+        entities.reserve(message.name.size());
+        entryIndices.reserve(message.name.size());
+        const bool posesMatchNames = message.name.size() == message.pose.size();
+        for (size_t i = 0; i < message.name.size(); ++i)
         {
-            PreSpawn(id, view, transform, spawnableName);
-        };
+            if (!posesMatchNames)
+            {
+                fail(i, AZStd::string::format("Spawn request has %zu names and %zu poses", message.name.size(), message.pose.size()));
+                continue;
+            }
 
-        spawner->SpawnAllEntities(m_tickets.at(spawnableName), optionalArgs);
+            result.pose[i] = message.pose[i];
+            AZStd::string spawnableName(message.name[i].c_str(), message.name[i].size());
+            if (!m_spawnables.contains(spawnableName))
+            {
+                fail(i, AZStd::string::format("Could not find spawnable with given name: %s", spawnableName.c_str()));
+                continue;
+            }
+            const auto& spawnable = m_spawnables.at(spawnableName);
+            entities.push_back({ AZStd::move(spawnableName), spawnable, ROS2Conversions::FromROS2Pose(message.pose[i]) });
+            entryIndices.push_back(i);
+        }
 
-        response->success = true;
+        const auto requestTime = AZStd::chrono::steady_clock::now();
+        m_entitySpawner.SpawnBatch(
+            entities,
+            [this, result = AZStd::move(result), entryIndices, requestTime](const AZStd::vector<SpawnedInstance>& instances) mutable
+            {
+                // Time to fleet ready, from the request until all entities of the batch exist
+                const auto spawnTime =
+                    AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - requestTime);
+                AZ_Printf(
+                    "ROS2SpawnerComponent",
+                    "Spawned %zu entities in %lld ms",
+                    instances.size(),
+                    static_cast<long long>(spawnTime.count()));
+                if (!m_spawnedEntitiesPublisher)
+                {
+                    return;
+                }
+
+                for (size_t i = 0; i < instances.size(); ++i)
+                {
+                    result.name[entryIndices[i]] = instances[i].m_name.c_str();
+                }
+                m_spawnedEntitiesPublisher->publish(result);
+            });
     }
 
-    void ROS2SpawnerComponent::PreSpawn(
-        AzFramework::EntitySpawnTicket::Id id [[maybe_unused]],
-        AzFramework::SpawnableEntityContainerView view,
-        const AZ::Transform& transform,
-        const AZStd::string& spawnableName)
+    void ROS2SpawnerComponent::DeleteEntity(const DeleteEntityRequest request, DeleteEntityResponse response)
     {
-        if (view.empty())
+        const AZStd::string instanceName(request->name.c_str(), request->name.size());
+        if (!m_entitySpawner.Delete(instanceName))
         {
+            response->success = false;
+            response->status_message = "Could not find spawned entity with given name: " + request->name;
             return;
         }
-        AZ::Entity* root = *view.begin();
-
-        auto* transformInterface = root->FindComponent<AzFramework::TransformComponent>();
-        transformInterface->SetWorldTM(transform);
-
-        AZStd::string instanceName = AZStd::string::format("%s_%d", spawnableName.c_str(), m_counter++);
-        for (AZ::Entity* entity : view)
-        { // Update name for the first entity with ROS2Frame in hierarchy (left to right)
-            const auto* frameComponent = Utils::GetGameOrEditorComponent<ROS2FrameComponent>(entity);
-            if (frameComponent)
-            {
-                entity->SetName(instanceName);
-                break;
-            }
-        }
+        response->success = true;
     }
 
     const AZ::Transform& ROS2SpawnerComponent::GetDefaultSpawnPose() const
@@ -181,7 +300,7 @@ namespace ROS2
     void ROS2SpawnerComponent::GetSpawnPointsNames(
         const ROS2::GetSpawnPointsNamesRequest request, ROS2::GetSpawnPointsNamesResponse response)
     {
-        for (auto spawnPoint : GetSpawnPoints())
+        for (const auto& spawnPoint : GetSpawnPoints())
         {
             response->model_names.emplace_back(spawnPoint.first.c_str());
         }
@@ -189,14 +308,12 @@ namespace ROS2
 
     void ROS2SpawnerComponent::GetSpawnPointInfo(const ROS2::GetSpawnPointInfoRequest request, ROS2::GetSpawnPointInfoResponse response)
     {
-        const AZStd::string_view key(request->model_name.c_str(), request->model_name.size());
+        const AZStd::string key(request->model_name.c_str(), request->model_name.size());
 
-        auto spawnPoints = GetSpawnPoints();
-        if (spawnPoints.contains(key))
+        if (const AZStd::optional<SpawnPointInfo> spawnPoint = FindSpawnPoint(key))
         {
-            auto info = spawnPoints.at(key);
-            response->pose = ROS2Conversions::ToROS2Pose(info.pose);
-            response->status_message = info.info.c_str();
+            response->pose = ROS2Conversions::ToROS2Pose(spawnPoint->pose);
+            response->status_message = spawnPoint->info.c_str();
         }
         else
         {
@@ -204,13 +321,27 @@ namespace ROS2
         }
     }
 
-    AZStd::unordered_map<AZStd::string, SpawnPointInfo> ROS2SpawnerComponent::GetSpawnPoints()
+    void ROS2SpawnerComponent::OnChildAdded([[maybe_unused]] AZ::EntityId child)
     {
+        m_spawnPointsValid = false;
+    }
+
+    void ROS2SpawnerComponent::OnChildRemoved([[maybe_unused]] AZ::EntityId child)
+    {
+        m_spawnPointsValid = false;
+    }
+
+    const AZStd::unordered_map<AZStd::string, ROS2SpawnerComponent::SpawnPointEntity>& ROS2SpawnerComponent::GetSpawnPoints()
+    {
+        if (m_spawnPointsValid)
+        {
+            return m_spawnPoints;
+        }
+
         AZStd::vector<AZ::EntityId> children;
         AZ::TransformBus::EventResult(children, GetEntityId(), &AZ::TransformBus::Events::GetChildren);
 
-        AZStd::unordered_map<AZStd::string, SpawnPointInfo> result;
-
+        m_spawnPoints.clear();
         for (const AZ::EntityId& child : children)
         {
             AZ::Entity* childEntity = nullptr;
@@ -223,12 +354,34 @@ namespace ROS2
                 continue;
             }
 
-            result.insert(spawnPoint->GetInfo());
+            auto [name, info] = spawnPoint->GetInfo();
+            m_spawnPoints.emplace(AZStd::move(name), SpawnPointEntity{ AZStd::move(info.info), child });
         }
 
         // setting name of spawn point component "default" in a child entity will have no effect since it is overwritten here with the
         // default spawn pose of spawner
-        result["default"] = SpawnPointInfo{ "Default spawn pose defined in the Editor", m_defaultSpawnPose };
-        return result;
+        m_spawnPoints["default"] = SpawnPointEntity{ "Default spawn pose defined in the Editor", AZ::EntityId() };
+        m_spawnPointsValid = true;
+        return m_spawnPoints;
+    }
+
+    AZStd::optional<SpawnPointInfo> ROS2SpawnerComponent::FindSpawnPoint(const AZStd::string& name)
+    {
+        const auto& spawnPoints = GetSpawnPoints();
+        auto spawnPoint = spawnPoints.find(name);
+        if (spawnPoint == spawnPoints.end())
+        {
+            return AZStd::nullopt;
+        }
+
+        // Spawn points can be moved, their pose is read on every request
+        const SpawnPointEntity& entity = spawnPoint->second;
+        SpawnPointInfo info{ entity.m_info, m_defaultSpawnPose };
+        if (entity.m_entityId.IsValid())
+        {
+            info.pose = AZ::Transform::CreateIdentity();
+            AZ::TransformBus::EventResult(info.pose, entity.m_entityId, &AZ::TransformBus::Events::GetWorldTM);
+        }
+        return info;
     }
 } // namespace ROS2
@@ -7,14 +7,20 @@
  */
 #pragma once
 
+#include "EntitySpawner.h"
 #include "ROS2SpawnPointComponent.h"
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 #include <ROS2/Spawner/SpawnerBus.h>
+#include <gazebo_msgs/msg/model_states.hpp>
+#include <gazebo_msgs/srv/delete_entity.hpp>
 #include <gazebo_msgs/srv/get_model_state.hpp>
 #include <gazebo_msgs/srv/get_world_properties.hpp>
 #include <gazebo_msgs/srv/spawn_entity.hpp>
@@ -30,12 +36,22 @@ namespace ROS2
     using GetSpawnPointInfoResponse = std::shared_ptr<gazebo_msgs::srv::GetModelState::Response>;
     using GetSpawnPointsNamesRequest = std::shared_ptr<gazebo_msgs::srv::GetWorldProperties::Request>;
     using GetSpawnPointsNamesResponse = std::shared_ptr<gazebo_msgs::srv::GetWorldProperties::Response>;
+    using DeleteEntityRequest = std::shared_ptr<gazebo_msgs::srv::DeleteEntity::Request>;
+    using DeleteEntityResponse = std::shared_ptr<gazebo_msgs::srv::DeleteEntity::Response>;
 
     //! Manages robots spawning.
     //! Allows user to set spawnable prefabs in the Editor and spawn them using ROS2 service during the simulation.
+    //! The spawn_entity service responds once the robot exists, with its namespace, frames and entity ids in the status message.
+    //! Fleets are spawned in one batch through the spawn_entities topic, which takes spawnable names and poses
+    //! (gazebo_msgs/ModelStates). Once all of them exist, spawned_entities is published with an entry for each requested
+    //! entity, in order of the request: the name of the spawned instance, or "error: " followed by the reason why the entity
+    //! could not be spawned. An empty request gets an empty result.
+    //! Spawned instances are deleted by name with the delete_entity service. With an instance pool, spawning and deleting
+    //! take and return pre-spawned instances.
     class ROS2SpawnerComponent
         : public AZ::Component
         , public SpawnerRequestsBus::Handler
+        , private AZ::TransformNotificationBus::Handler
     {
     public:
         AZ_COMPONENT(ROS2SpawnerComponent, "{5950AC6B-75F3-4E0F-BA5C-17C877013710}", AZ::Component, SpawnerRequestsBus::Handler);
@@ -56,28 +72,47 @@ namespace ROS2
         //////////////////////////////////////////////////////////////////////////
 
     private:
-        int m_counter = 1;
+        //! Spawn point of a child of the spawner. The pose is not cached, the spawn point can move.
+        struct SpawnPointEntity
+        {
+            AZStd::string m_info;
+            AZ::EntityId m_entityId; //!< Invalid for the default spawn pose.
+        };
+
+        // AZ::TransformNotificationBus::Handler overrides
+        void OnChildAdded(AZ::EntityId child) override;
+        void OnChildRemoved(AZ::EntityId child) override;
+
         AZStd::unordered_map<AZStd::string, AZ::Data::Asset<AzFramework::Spawnable>> m_spawnables;
-        AZStd::unordered_map<AZStd::string, AzFramework::EntitySpawnTicket> m_tickets;
+        AZ::u32 m_instancePoolSize = 0; //!< Instances of each spawnable in the pool.
+        EntitySpawner m_entitySpawner;
 
         rclcpp::Service<gazebo_msgs::srv::GetWorldProperties>::SharedPtr m_getSpawnablesNamesService;
         rclcpp::Service<gazebo_msgs::srv::GetWorldProperties>::SharedPtr m_getSpawnPointsNamesService;
         rclcpp::Service<gazebo_msgs::srv::SpawnEntity>::SharedPtr m_spawnService;
         rclcpp::Service<gazebo_msgs::srv::GetModelState>::SharedPtr m_getSpawnPointInfoService;
+        rclcpp::Service<gazebo_msgs::srv::DeleteEntity>::SharedPtr m_deleteService;
+        rclcpp::Subscription<gazebo_msgs::msg::ModelStates>::SharedPtr m_spawnEntitiesSubscription;
+        rclcpp::Publisher<gazebo_msgs::msg::ModelStates>::SharedPtr m_spawnedEntitiesPublisher;
+        AZStd::vector<std::shared_ptr<rmw_request_id_t>> m_pendingSpawnRequests; //!< spawn_entity requests waiting for their entity.
 
         AZ::Transform m_defaultSpawnPose = { AZ::Vector3{ 0, 0, 0 }, AZ::Quaternion{ 0, 0, 0, 1 }, 1.0 };
 
         void GetAvailableSpawnableNames(const GetAvailableSpawnableNamesRequest request, GetAvailableSpawnableNamesResponse response);
-        void SpawnEntity(const SpawnEntityRequest request, SpawnEntityResponse response);
-        void PreSpawn(
-            AzFramework::EntitySpawnTicket::Id,
-            AzFramework::SpawnableEntityContainerView,
-            const AZ::Transform&,
-            const AZStd::string& spawnableName);
+        void SpawnEntity(const std::shared_ptr<rmw_request_id_t> requestHeader, const SpawnEntityRequest request);
+        void SpawnEntities(const gazebo_msgs::msg::ModelStates& message);
+        void DeleteEntity(const DeleteEntityRequest request, DeleteEntityResponse response);
 
         void GetSpawnPointsNames(const GetSpawnPointsNamesRequest request, GetSpawnPointsNamesResponse response);
         void GetSpawnPointInfo(const GetSpawnPointInfoRequest request, GetSpawnPointInfoResponse response);
 
-        AZStd::unordered_map<AZStd::string, SpawnPointInfo> GetSpawnPoints();
+        //! Spawn points defined by children of the spawner entity, cached until children of the spawner change.
+        const AZStd::unordered_map<AZStd::string, SpawnPointEntity>& GetSpawnPoints();
+
+        //! Finds a spawn point by name, with its current pose.
+        AZStd::optional<SpawnPointInfo> FindSpawnPoint(const AZStd::string& name);
+
+        AZStd::unordered_map<AZStd::string, SpawnPointEntity> m_spawnPoints;
+        bool m_spawnPointsValid = false;
     };
 } // namespace ROS2
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "SpawnableInstancePool.h"
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Physics/RigidBodyBus.h>
+#include <ROS2/Frame/ROS2FrameComponent.h>
+#include <ROS2/ROS2GemUtilities.h>
+
+namespace ROS2
+{
+    namespace Internal
+    {
+        AZ::Entity* FindEntity(AZ::EntityId entityId)
+        {
+            AZ::Entity* entity = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationRequests::FindEntity, entityId);
+            return entity;
+        }
+    } // namespace Internal
+
+    void SpawnableInstancePool::Fill(
+        const AZStd::string& spawnableName, const AZ::Data::Asset<AzFramework::Spawnable>& spawnable, size_t count)
+    {
+        auto spawner = AZ::Interface<AzFramework::SpawnableEntitiesDefinition>::Get();
+        AZ_Assert(spawner, "No spawnable entities interface");
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto instance = AZStd::make_shared<Instance>();
+            instance->m_ticket = AzFramework::EntitySpawnTicket(spawnable);
+            instance->m_spawnableName = spawnableName;
+            m_pending.push_back(instance);
+
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_preInsertionCallback = [instance]([[maybe_unused]] auto id, auto view)
+            {
+                OnInstancePreInsertion(instance, view);
+            };
+            optionalArgs.m_completionCallback = [this, instance]([[maybe_unused]] auto id, auto view)
+            {
+                OnInstanceSpawned(instance, view);
+            };
+            spawner->SpawnAllEntities(instance->m_ticket, AZStd::move(optionalArgs));
+        }
+    }
+
+    void SpawnableInstancePool::Clear()
+    {
+        // Destroying tickets despawns their entities
+        m_pending.clear();
+        m_available.clear();
+        m_inUse.clear();
+    }
+
+    void SpawnableInstancePool::OnInstancePreInsertion(
+        const AZStd::shared_ptr<Instance>& instance, AzFramework::SpawnableEntityContainerView view)
+    {
+        // Entities are added to the game entity context without activation, they become active once the instance is taken
+        instance->m_localTMs.reserve(view.size());
+        for (AZ::Entity* entity : view)
+        {
+            entity->SetRuntimeActiveByDefault(false);
+            const auto* transformComponent = entity->FindComponent<AzFramework::TransformComponent>();
+            instance->m_localTMs.push_back(transformComponent ? transformComponent->GetLocalTM() : AZ::Transform::CreateIdentity());
+        }
+    }
+
+    void SpawnableInstancePool::OnInstanceSpawned(
+        const AZStd::shared_ptr<Instance>& instance, AzFramework::SpawnableConstEntityContainerView view)
+    {
+        auto pending = AZStd::find(m_pending.begin(), m_pending.end(), instance);
+        if (pending == m_pending.end())
+        {
+            return; // The pool was cleared in the meantime
+        }
+        m_pending.erase(pending);
+
+        instance->m_entityIds.reserve(view.size());
+        for (const AZ::Entity* entity : view)
+        {
+            instance->m_entityIds.push_back(entity->GetId());
+        }
+        AZ_Assert(instance->m_entityIds.size() == instance->m_localTMs.size(), "Pre-insertion and completion views differ");
+        m_available[instance->m_spawnableName].push_back(instance);
+    }
+
+    const AZStd::vector<AZ::EntityId>* SpawnableInstancePool::Acquire(
+        const AZStd::string& spawnableName, const AZ::Transform& transform, const AZStd::string& instanceName)
+    {
+        auto available = m_available.find(spawnableName);
+        if (available == m_available.end() || available->second.empty())
+        {
+            return nullptr;
+        }
+        AZ_Error("SpawnableInstancePool", !m_inUse.contains(instanceName), "Instance %s is already in use", instanceName.c_str());
+
+        AZStd::shared_ptr<Instance> instance = AZStd::move(available->second.back());
+        available->second.pop_back();
+
+        bool renamed = false;
+        for (size_t i = 0; i < instance->m_entityIds.size(); ++i)
+        {
+            AZ::Entity* entity = Internal::FindEntity(instance->m_entityIds[i]);
+            if (!entity)
+            {
+                continue;
+            }
+
+            // Entities of a returned instance may have been moved by physics or by a client, the root is placed at the requested
+            // transform and other entities at their transforms relative to parents, as spawned
+            if (auto* transformComponent = entity->FindComponent<AzFramework::TransformComponent>())
+            {
+                if (i == 0)
+                {
+                    transformComponent->SetWorldTM(transform);
+                }
+                else
+                {
+                    transformComponent->SetLocalTM(instance->m_localTMs[i]);
+                }
+            }
+
+            // Update name for the first entity with ROS2Frame in hierarchy, before activation so that the frame takes the namespace
+            if (!renamed && Utils::GetGameOrEditorComponent<ROS2FrameComponent>(entity))
+            {
+                entity->SetName(instanceName);
+                renamed = true;
+            }
+
+            entity->Activate();
+        }
+
+        const auto& entityIds = instance->m_entityIds;
+        m_inUse[instanceName] = AZStd::move(instance);
+        return &entityIds;
+    }
+
+    bool SpawnableInstancePool::Release(const AZStd::string& instanceName)
+    {
+        auto inUse = m_inUse.find(instanceName);
+        if (inUse == m_inUse.end())
+        {
+            return false;
+        }
+        AZStd::shared_ptr<Instance> instance = AZStd::move(inUse->second);
+        m_inUse.erase(inUse);
+
+        for (auto it = instance->m_entityIds.rbegin(); it != instance->m_entityIds.rend(); ++it)
+        {
+            AZ::Entity* entity = Internal::FindEntity(*it);
+            if (!entity || entity->GetState() != AZ::Entity::State::Active)
+            {
+                continue;
+            }
+
+            // Rigid bodies keep no motion for the next use of the instance
+            Physics::RigidBodyRequestBus::Event(*it, &Physics::RigidBodyRequests::SetLinearVelocity, AZ::Vector3::CreateZero());
+            Physics::RigidBodyRequestBus::Event(*it, &Physics::RigidBodyRequests::SetAngularVelocity, AZ::Vector3::CreateZero());
+            entity->Deactivate();
+        }
+
+        m_available[instance->m_spawnableName].push_back(AZStd::move(instance));
+        return true;
+    }
+
+    size_t SpawnableInstancePool::GetAvailableCount(const AZStd::string& spawnableName) const
+    {
+        auto available = m_available.find(spawnableName);
+        return available != m_available.end() ? available->second.size() : 0;
+    }
+} // namespace ROS2
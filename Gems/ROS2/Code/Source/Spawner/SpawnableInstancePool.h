@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+
+namespace ROS2
+{
+    //! Inactive instances of spawnables, spawned ahead of time.
+    //! Instances are spawned inactive. Taking an instance from the pool only moves, renames and activates its entities, which is
+    //! much faster than spawning from the asset. Returned instances are deactivated with their physics state reset, and taking
+    //! them again restores the local transforms their entities were spawned with.
+    class SpawnableInstancePool
+    {
+    public:
+        //! Queues spawning of instances of a spawnable. Instances become available once spawned.
+        void Fill(const AZStd::string& spawnableName, const AZ::Data::Asset<AzFramework::Spawnable>& spawnable, size_t count);
+
+        //! Despawns all instances, including the ones in use.
+        void Clear();
+
+        //! Takes an available instance of a spawnable.
+        //! @param transform world transform of the root entity of the instance.
+        //! @param instanceName name of the instance, given to the first entity with a ROS2 frame.
+        //! @returns entities of the instance, root first, or null if no instance is available.
+        const AZStd::vector<AZ::EntityId>* Acquire(
+            const AZStd::string& spawnableName, const AZ::Transform& transform, const AZStd::string& instanceName);
+
+        //! Returns an instance to the pool.
+        //! @returns false if there is no instance in use with this name.
+        bool Release(const AZStd::string& instanceName);
+
+        //! Number of instances of a spawnable which can be acquired.
+        size_t GetAvailableCount(const AZStd::string& spawnableName) const;
+
+    private:
+        struct Instance
+        {
+            AzFramework::EntitySpawnTicket m_ticket;
+            AZStd::string m_spawnableName;
+            AZStd::vector<AZ::EntityId> m_entityIds; //!< In hierarchy order, root first.
+            AZStd::vector<AZ::Transform> m_localTMs; //!< Local transforms of entities as spawned, aligned with entity ids.
+        };
+
+        static void OnInstancePreInsertion(const AZStd::shared_ptr<Instance>& instance, AzFramework::SpawnableEntityContainerView view);
+
+        void OnInstanceSpawned(const AZStd::shared_ptr<Instance>& instance, AzFramework::SpawnableConstEntityContainerView view);
+
+        AZStd::unordered_map<AZStd::string, AZStd::vector<AZStd::shared_ptr<Instance>>> m_available;
+        AZStd::unordered_map<AZStd::string, AZStd::shared_ptr<Instance>> m_inUse;
+        AZStd::vector<AZStd::shared_ptr<Instance>> m_pending; //!< Spawn requested, not completed yet.
+    };
+} // namespace ROS2
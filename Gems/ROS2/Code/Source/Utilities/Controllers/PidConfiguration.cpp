@@ -51,6 +51,13 @@ namespace ROS2::Controllers
         }
     }
 
+    PidConfiguration::PidConfiguration(double p, double i, double d)
+        : m_p(p)
+        , m_i(i)
+        , m_d(d)
+    {
+    }
+
     void PidConfiguration::InitializePid()
     {
         m_pid.initPid(m_p, m_i, m_d, m_iMax, m_iMin, m_antiWindup);
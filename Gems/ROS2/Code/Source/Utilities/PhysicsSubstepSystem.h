@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+
+namespace ROS2
+{
+    //! Removes an element by moving the last element in its place.
+    //! Systems keep data of their components in contiguous arrays, which stay aligned if the same index is removed from all of them.
+    template<typename T>
+    void SwapRemove(AZStd::vector<T>& values, size_t index)
+    {
+        if (index != values.size() - 1)
+        {
+            values[index] = AZStd::move(values.back());
+        }
+        values.pop_back();
+    }
+
+    //! Physics scene event on which a system updates its components.
+    enum class PhysicsSubstepEvent
+    {
+        SimulationStart, //!< Before each substep is simulated, to apply commands.
+        SimulationFinish //!< After each substep is simulated, to measure its results.
+    };
+
+    //! Base of systems which update all their registered components in a single pass on every physics substep.
+    //! An active system is registered as AZ::Interface<System>. The default physics scene may not exist yet when the system
+    //! activates, so the system connects to the scene on the first registration of a component with ConnectToPhysicsScene.
+    //! A system which is not activated is never connected, its owner can advance it directly.
+    template<typename System>
+    class PhysicsSubstepSystem
+    {
+    public:
+        explicit PhysicsSubstepSystem(PhysicsSubstepEvent substepEvent)
+            : m_substepEvent(substepEvent)
+        {
+        }
+
+        virtual ~PhysicsSubstepSystem() = default;
+
+        void Activate()
+        {
+            if (AZ::Interface<System>::Get() == nullptr)
+            {
+                AZ::Interface<System>::Register(static_cast<System*>(this));
+            }
+
+            auto onSubstep = [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                OnPhysicsSubstep(fixedDeltaTime);
+            };
+            m_sceneSimStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(onSubstep);
+            m_sceneFinishSimHandler = AzPhysics::SceneEvents::OnSceneSimulationFinishHandler(onSubstep);
+            m_active = true;
+        }
+
+        void Deactivate()
+        {
+            m_active = false;
+            m_sceneSimStartHandler.Disconnect();
+            m_sceneFinishSimHandler.Disconnect();
+            if (AZ::Interface<System>::Get() == static_cast<System*>(this))
+            {
+                AZ::Interface<System>::Unregister(static_cast<System*>(this));
+            }
+        }
+
+    protected:
+        //! Connects an active system to the default physics scene. Does nothing if it is connected already.
+        void ConnectToPhysicsScene()
+        {
+            if (!m_active || m_sceneSimStartHandler.IsConnected() || m_sceneFinishSimHandler.IsConnected())
+            {
+                return;
+            }
+
+            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            AZ_Assert(sceneInterface, "No physics scene interface");
+            const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+            AZ_Assert(sceneHandle != AzPhysics::InvalidSceneHandle, "Invalid default physics scene handle");
+            if (m_substepEvent == PhysicsSubstepEvent::SimulationStart)
+            {
+                sceneInterface->RegisterSceneSimulationStartHandler(sceneHandle, m_sceneSimStartHandler);
+            }
+            else
+            {
+                sceneInterface->RegisterSceneSimulationFinishHandler(sceneHandle, m_sceneFinishSimHandler);
+            }
+        }
+
+        //! Updates all components of the system.
+        //! @param fixedDeltaTime fixed time step of the physics scene in seconds.
+        virtual void OnPhysicsSubstep(float fixedDeltaTime) = 0;
+
+    private:
+        PhysicsSubstepEvent m_substepEvent;
+        bool m_active = false;
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneSimStartHandler;
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler;
+    };
+} // namespace ROS2
@@ -26,15 +26,34 @@ namespace ROS2::VehicleDynamics
         }
     }
 
+    void DriveModel::Deactivate()
+    {
+        m_wheelHandles.Deactivate();
+    }
+
     void DriveModel::SetDisabled(bool isDisabled)
     {
         m_disabled = isDisabled;
     }
 
-    void DriveModel::ApplyInputState(const VehicleInputs& inputs, AZ::u64 deltaTimeNs)
+    bool DriveModel::IsDisabled() const
+    {
+        return m_disabled;
+    }
+
+    VehicleInputs DriveModel::LimitInputs(const VehicleInputs& inputs) const
+    {
+        return GetVehicleLimitPtr()->LimitState(inputs);
+    }
+
+    const VehicleConfiguration& DriveModel::GetVehicleConfiguration() const
+    {
+        return m_vehicleConfiguration;
+    }
+
+    const WheelHandleTable& DriveModel::GetWheelHandles() const
     {
-        const VehicleInputs filteredInputs = GetVehicleLimitPtr()->LimitState(inputs);
-        ApplyState(filteredInputs, deltaTimeNs);
+        return m_wheelHandles;
     }
 
     VehicleInputs DriveModel::GetMaximumPossibleInputs() const
@@ -9,12 +9,14 @@
 
 #include "VehicleConfiguration.h"
 #include "VehicleInputs.h"
+#include "WheelHandleTable.h"
 #include <AzCore/Serialization/SerializeContext.h>
 #include <VehicleDynamics/VehicleModelLimits.h>
 
 namespace ROS2::VehicleDynamics
 {
     //! Abstract class for turning vehicle inputs into behavior of wheels and steering elements
+    //! The model holds configuration and resolved joints of a vehicle, the VehicleDynamicsSystem advances all models in batches.
     class DriveModel
     {
     public:
@@ -31,26 +33,40 @@ namespace ROS2::VehicleDynamics
         //! @param vehicleConfig configuration containing axes and wheels information
         virtual void Activate(const VehicleConfiguration& vehicleConfig) = 0;
 
-        //! Applies inputs to the drive. This model will calculate and apply physical forces.
+        //! Deactivate the model, resolved wheel and steering joints are released.
+        void Deactivate();
+
+        //! Limit inputs to values that are possible for the model.
         //! @param inputs captured state of inputs to use.
-        //! @param deltaTimeNs nanoseconds passed since last call of this function.
-        void ApplyInputState(const VehicleInputs& inputs, AZ::u64 deltaTimeNs);
+        //! @returns filtered inputs.
+        VehicleInputs LimitInputs(const VehicleInputs& inputs) const;
 
         //! Allows to disable vehicle dynamics.
         //! @param isDisable true if drive model should be disabled.
         void SetDisabled(bool isDisable);
 
+        //! True if vehicle dynamics are disabled.
+        bool IsDisabled() const;
+
         //! Get vehicle maximum limits.
         VehicleInputs GetMaximumPossibleInputs() const;
 
+        //! Configuration given on activation.
+        const VehicleConfiguration& GetVehicleConfiguration() const;
+
+        //! Joints of wheels and steering elements of the vehicle.
+        const WheelHandleTable& GetWheelHandles() const;
+
     protected:
         //! Returns pointer to implementation specific Vehicle limits.
         virtual const VehicleModelLimits* GetVehicleLimitPtr() const = 0;
 
-        //! Apply input to implemented vehicle model.
-        virtual void ApplyState(const VehicleInputs& inputs, AZ::u64 deltaTimeNs) = 0;
-
         //! True if model is disabled.
         bool m_disabled{ false };
+
+        VehicleConfiguration m_vehicleConfiguration;
+
+        //! Joints of wheels and steering elements, resolved by the implementation on activation.
+        WheelHandleTable m_wheelHandles;
     };
 } // namespace ROS2::VehicleDynamics
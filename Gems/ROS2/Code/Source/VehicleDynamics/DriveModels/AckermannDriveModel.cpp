@@ -12,9 +12,7 @@
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
-#include <HingeJointComponent.h>
 #include <PhysX/Joint/PhysXJointRequestsBus.h>
-#include <VehicleDynamics/Utilities.h>
 
 namespace ROS2::VehicleDynamics
 {
@@ -44,97 +42,81 @@ namespace ROS2::VehicleDynamics
 
     void AckermannDriveModel::Activate(const VehicleConfiguration& vehicleConfig)
     {
-        m_driveWheelsData.clear();
-        m_steeringData.clear();
         m_vehicleConfiguration = vehicleConfig;
-        m_steeringPid.InitializePid();
-    }
-
-    void AckermannDriveModel::ApplyState(const VehicleInputs& inputs, AZ::u64 deltaTimeNs)
-    {
-        if (m_driveWheelsData.empty())
-        {
-            m_driveWheelsData = VehicleDynamics::Utilities::GetAllDriveWheelsData(m_vehicleConfiguration);
-        }
+        m_wheelHandles.Activate(m_vehicleConfiguration);
 
-        if (m_steeringData.empty())
+        const auto& steeringElements = m_wheelHandles.GetSteeringElements();
+        m_steeringGeometry.Build(m_vehicleConfiguration, steeringElements);
+        m_steeringPids.assign(steeringElements.size(), m_steeringPid);
+        for (auto& pid : m_steeringPids)
         {
-            m_steeringData = VehicleDynamics::Utilities::GetAllSteeringEntitiesData(m_vehicleConfiguration);
+            pid.InitializePid();
         }
-        const auto jointPositions = inputs.m_jointRequestedPosition;
-        const float steering = jointPositions.empty() ? 0 : jointPositions.front();
-        ApplySteering(steering, deltaTimeNs);
-        ApplySpeed(inputs.m_speed.GetX(), deltaTimeNs);
-    }
-
-    void AckermannDriveModel::ApplyWheelSteering(SteeringDynamicsData& wheelData, float steering, double deltaTimeNs)
-    {
-        const auto& steeringEntity = wheelData.m_steeringEntity;
-        const auto& hingeComponent = wheelData.m_hingeJoint;
-
-        auto id = AZ::EntityComponentIdPair(steeringEntity, hingeComponent);
-
-        PhysX::JointRequestBus::Event(
-            id,
-            [&](PhysX::JointRequests* joint)
-            {
-                double currentSteeringAngle = joint->GetPosition();
-                const double pidCommand = m_steeringPid.ComputeCommand(steering - currentSteeringAngle, deltaTimeNs);
-                joint->SetVelocity(pidCommand);
-            });
+        m_targetAngles.resize(steeringElements.size());
+        m_currentAngles.resize(steeringElements.size());
+        m_steeringVelocities.resize(steeringElements.size());
+
+        AZ_Warning(
+            "AckermannDriveModel",
+            !m_wheelHandles.GetSteeringElements().empty(),
+            "Steering will not be applied since no steering elements are defined in the model");
+        AZ_Warning(
+            "AckermannDriveModel",
+            !m_wheelHandles.GetDriveWheels().empty(),
+            "Speed will not be applied since no driving wheels are defined in the model");
     }
 
     void AckermannDriveModel::ApplySteering(float steering, AZ::u64 deltaTimeNs)
     {
-        if (m_disabled)
+        const auto& steeringElements = m_wheelHandles.GetSteeringElements();
+        if (m_disabled || steeringElements.empty())
         {
             return;
         }
-        if (m_steeringData.empty())
-        {
-            AZ_Warning("ApplySteering", false, "Cannot apply steering since no steering elements are defined in the model");
-            return;
-        }
+        AZ_Assert(m_steeringPids.size() == steeringElements.size(), "Steering controllers do not match steering elements");
 
-        auto innerSteering = AZ::Atan2(
-            (m_vehicleConfiguration.m_wheelbase * tan(steering)),
-            (m_vehicleConfiguration.m_wheelbase - 0.5 * m_vehicleConfiguration.m_track * tan(steering)));
-        auto outerSteering = AZ::Atan2(
-            (m_vehicleConfiguration.m_wheelbase * tan(steering)),
-            (m_vehicleConfiguration.m_wheelbase + 0.5 * m_vehicleConfiguration.m_track * tan(steering)));
+        m_steeringGeometry.ComputeAngles(steering, m_targetAngles);
 
-        ApplyWheelSteering(m_steeringData.front(), innerSteering, deltaTimeNs);
-        ApplyWheelSteering(m_steeringData.back(), outerSteering, deltaTimeNs);
-    }
-
-    void AckermannDriveModel::ApplySpeed(float speed, AZ::u64 deltaTimeNs)
-    {
-        if (m_disabled)
+        const size_t elementCount = steeringElements.size();
+        for (size_t i = 0; i < elementCount; ++i)
         {
-            return;
+            // An element without a joint has no error, so that its controller does not wind up
+            const SteeringDynamicsData& steeringData = steeringElements[i];
+            m_currentAngles[i] = m_targetAngles[i];
+            if (steeringData.m_hingeJoint != AZ::InvalidComponentId)
+            {
+                const auto id = AZ::EntityComponentIdPair(steeringData.m_steeringEntity, steeringData.m_hingeJoint);
+                PhysX::JointRequestBus::EventResult(m_currentAngles[i], id, &PhysX::JointRequests::GetPosition);
+            }
         }
-        const float acceleration = m_limits.GetLinearAcceleration();
-        const float maxSpeed = m_limits.GetLinearSpeedLimit();
-        m_speedCommand = Utilities::ComputeRampVelocity(speed, m_speedCommand, deltaTimeNs, acceleration, maxSpeed);
 
-        if (m_driveWheelsData.empty())
+        for (size_t i = 0; i < elementCount; ++i)
         {
-            AZ_Warning("ApplySpeed", false, "Cannot apply speed since no diving wheels are defined in the model");
-            return;
+            m_steeringVelocities[i] =
+                static_cast<float>(m_steeringPids[i].ComputeCommand(m_targetAngles[i] - m_currentAngles[i], deltaTimeNs));
         }
 
-        for (const auto& wheelData : m_driveWheelsData)
+        for (size_t i = 0; i < elementCount; ++i)
         {
-            const auto wheelEntity = wheelData.m_wheelEntity;
-            float wheelRadius = wheelData.m_wheelRadius;
-            const auto hingeComponent = wheelData.m_hingeJoint;
-            const auto id = AZ::EntityComponentIdPair(wheelEntity, hingeComponent);
-            AZ_Assert(wheelRadius != 0, "wheelRadius must be non-zero");
-            auto desiredAngularSpeedX = (m_speedCommand / wheelRadius);
-            PhysX::JointRequestBus::Event(id, &PhysX::JointRequests::SetVelocity, desiredAngularSpeedX);
+            const SteeringDynamicsData& steeringData = steeringElements[i];
+            if (steeringData.m_hingeJoint != AZ::InvalidComponentId)
+            {
+                const auto id = AZ::EntityComponentIdPair(steeringData.m_steeringEntity, steeringData.m_hingeJoint);
+                PhysX::JointRequestBus::Event(id, &PhysX::JointRequests::SetVelocity, m_steeringVelocities[i]);
+            }
         }
     }
 
+    const AZStd::vector<float>& AckermannDriveModel::GetTargetAngles() const
+    {
+        return m_targetAngles;
+    }
+
+    const AckermannModelLimits& AckermannDriveModel::GetLimits() const
+    {
+        return m_limits;
+    }
+
     const VehicleModelLimits* AckermannDriveModel::GetVehicleLimitPtr() const
     {
         return &m_limits;
@@ -9,7 +9,9 @@
 
 #include <AzCore/Serialization/SerializeContext.h>
 #include <ROS2/Utilities/Controllers/PidConfiguration.h>
+#include <AzCore/std/containers/vector.h>
 #include <VehicleDynamics/DriveModel.h>
+#include <VehicleDynamics/DriveModels/AckermannSteeringGeometry.h>
 #include <VehicleDynamics/ModelLimits/AckermannModelLimits.h>
 #include <VehicleDynamics/VehicleConfiguration.h>
 #include <VehicleDynamics/VehicleInputs.h>
@@ -28,21 +30,31 @@ namespace ROS2::VehicleDynamics
 
         static void Reflect(AZ::ReflectContext* context);
 
+        const AckermannModelLimits& GetLimits() const;
+
+        //! Turns all steering elements towards their Ackermann angles of a given steering.
+        //! Joint positions are read first, then PID commands are computed for all elements and applied as joint velocities.
+        //! @param steering steering angle of a virtual front wheel in radians, already limited.
+        //! @param deltaTimeNs fixed time step of the steering controller.
+        void ApplySteering(float steering, AZ::u64 deltaTimeNs);
+
+        //! Ackermann angles of steering elements, as computed on the last steering step.
+        const AZStd::vector<float>& GetTargetAngles() const;
+
     protected:
         // DriveModel overrides
-        void ApplyState(const VehicleInputs& inputs, AZ::u64 deltaTimeNs) override;
         const VehicleModelLimits* GetVehicleLimitPtr() const override;
 
     private:
-        void ApplySteering(float steering, AZ::u64 deltaTimeNs);
-        void ApplySpeed(float speed, AZ::u64 deltaTimeNs);
-        void ApplyWheelSteering(SteeringDynamicsData& wheelData, float steering, double deltaTimeNs);
-
-        VehicleConfiguration m_vehicleConfiguration;
-        AZStd::vector<WheelDynamicsData> m_driveWheelsData;
-        AZStd::vector<SteeringDynamicsData> m_steeringData;
         ROS2::Controllers::PidConfiguration m_steeringPid;
-        float m_speedCommand = 0.0f;
         AckermannModelLimits m_limits;
+
+        AckermannSteeringGeometry m_steeringGeometry;
+        //! One controller per steering element, configured as m_steeringPid.
+        AZStd::vector<ROS2::Controllers::PidConfiguration> m_steeringPids;
+        // Per steering element state of a steering step, kept to avoid allocations
+        AZStd::vector<float> m_targetAngles;
+        AZStd::vector<float> m_currentAngles;
+        AZStd::vector<float> m_steeringVelocities;
     };
 } // namespace ROS2::VehicleDynamics
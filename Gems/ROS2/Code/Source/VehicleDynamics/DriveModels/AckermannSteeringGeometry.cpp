@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "AckermannSteeringGeometry.h"
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/math.h>
+#include <VehicleDynamics/Utilities.h>
+
+namespace ROS2::VehicleDynamics
+{
+    namespace Internal
+    {
+        //! Position of the line the turning center lies on, in the same frame as Utilities::GetAxleLongitudinalPosition.
+        float GetTurningCenterLongitudinalPosition(const VehicleConfiguration& vehicleConfig)
+        {
+            float positionSum = 0.0f;
+            size_t fixedAxleCount = 0;
+            for (size_t axleIndex = 0; axleIndex < vehicleConfig.m_axles.size(); ++axleIndex)
+            {
+                if (!vehicleConfig.m_axles[axleIndex].m_isSteering)
+                {
+                    positionSum += Utilities::GetAxleLongitudinalPosition(vehicleConfig, axleIndex);
+                    ++fixedAxleCount;
+                }
+            }
+            if (fixedAxleCount > 0)
+            {
+                return positionSum / static_cast<float>(fixedAxleCount);
+            }
+            // A single steering axle turns around an implicit rear axle, all steering axles turn around the middle
+            return vehicleConfig.m_axles.size() < 2 ? 0.0f : 0.5f * vehicleConfig.m_wheelbase;
+        }
+    } // namespace Internal
+
+    void AckermannSteeringGeometry::Build(
+        const VehicleConfiguration& vehicleConfig, const AZStd::vector<SteeringDynamicsData>& steeringElements)
+    {
+        m_longitudinalOffsets.clear();
+        m_lateralOffsets.clear();
+        m_longitudinalOffsets.reserve(steeringElements.size());
+        m_lateralOffsets.reserve(steeringElements.size());
+
+        const float turningCenter = Internal::GetTurningCenterLongitudinalPosition(vehicleConfig);
+        const float halfTrack = 0.5f * vehicleConfig.m_track;
+        AZ::u32 frontSteeringAxle = aznumeric_cast<AZ::u32>(vehicleConfig.m_axles.size());
+        for (const SteeringDynamicsData& steeringData : steeringElements)
+        {
+            // Wheels of an axle are sorted left to right
+            const float axlePosition = Utilities::GetAxleLongitudinalPosition(vehicleConfig, steeringData.m_axleIndex);
+            m_longitudinalOffsets.push_back(axlePosition - turningCenter);
+            m_lateralOffsets.push_back(-steeringData.m_axlePosition * halfTrack);
+            frontSteeringAxle = AZStd::min(frontSteeringAxle, steeringData.m_axleIndex);
+        }
+
+        m_steeringDistance = steeringElements.empty()
+            ? vehicleConfig.m_wheelbase
+            : AZStd::abs(Utilities::GetAxleLongitudinalPosition(vehicleConfig, frontSteeringAxle) - turningCenter);
+        if (AZ::IsClose(m_steeringDistance, 0.0f))
+        {
+            AZ_Warning(
+                "AckermannSteeringGeometry", false, "Front steering axle lies on the turning center line, using the wheelbase instead");
+            m_steeringDistance = vehicleConfig.m_wheelbase;
+        }
+    }
+
+    void AckermannSteeringGeometry::ComputeAngles(float steering, AZStd::vector<float>& angles) const
+    {
+        const size_t wheelCount = m_longitudinalOffsets.size();
+        angles.resize(wheelCount);
+
+        // The turning radius is m_steeringDistance / tanSteering, each wheel points perpendicular to its own radius
+        const float tanSteering = AZStd::tan(steering);
+        for (size_t i = 0; i < wheelCount; ++i)
+        {
+            angles[i] = AZ::Atan2(m_longitudinalOffsets[i] * tanSteering, m_steeringDistance - m_lateralOffsets[i] * tanSteering);
+        }
+    }
+
+    size_t AckermannSteeringGeometry::GetWheelCount() const
+    {
+        return m_longitudinalOffsets.size();
+    }
+} // namespace ROS2::VehicleDynamics
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <VehicleDynamics/VehicleConfiguration.h>
+#include <VehicleDynamics/WheelDynamicsData.h>
+
+namespace ROS2::VehicleDynamics
+{
+    //! Ackermann angles of any number of steered wheels, on any number of axles.
+    //! Axles are spaced evenly over the wheelbase, front to rear. The turning center lies on the line through the middle of
+    //! the non-steering axles, or through the middle of the vehicle when all axles steer (four-wheel steering), so that
+    //! wheels behind that line turn the opposite way. The steering input is the angle of a virtual wheel in the middle
+    //! of the front steering axle, as in a bicycle model.
+    //! Wheel offsets are computed once, leaving one tangent and one arctangent per wheel to compute on each step.
+    class AckermannSteeringGeometry
+    {
+    public:
+        //! Computes wheel offsets for steering elements of a vehicle.
+        //! @param vehicleConfig configuration with axles, wheelbase and track of the vehicle.
+        //! @param steeringElements steering elements with their axle index and axle position set.
+        void Build(const VehicleConfiguration& vehicleConfig, const AZStd::vector<SteeringDynamicsData>& steeringElements);
+
+        //! Computes the angle of each steered wheel, in the order of steering elements given to Build.
+        //! @param steering steering angle of the virtual front wheel, in radians.
+        //! @param angles output with one angle per steered wheel.
+        void ComputeAngles(float steering, AZStd::vector<float>& angles) const;
+
+        size_t GetWheelCount() const;
+
+    private:
+        AZStd::vector<float> m_longitudinalOffsets; //!< Distance of the wheel ahead of the turning center line, in meters.
+        AZStd::vector<float> m_lateralOffsets; //!< Distance of the wheel to the left of the vehicle center line, in meters.
+        float m_steeringDistance = 0.0f; //!< Distance of the front steering axle ahead of the turning center line, in meters.
+    };
+} // namespace ROS2::VehicleDynamics
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "MecanumDriveModel.h"
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/math.h>
+#include <VehicleDynamics/Utilities.h>
+
+namespace ROS2::VehicleDynamics
+{
+    void MecanumDriveModel::Reflect(AZ::ReflectContext* context)
+    {
+        MecanumModelLimits::Reflect(context);
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<MecanumDriveModel, DriveModel>()
+                ->Version(1)
+                ->Field("RollerAngle", &MecanumDriveModel::m_rollerAngle)
+                ->Field("Limits", &MecanumDriveModel::m_limits);
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<MecanumDriveModel>("Mecanum Drive Model", "Configuration of a simplified vehicle dynamics drive model")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MecanumDriveModel::m_rollerAngle,
+                        "Roller angle",
+                        "Angle between rollers and the wheel axis (rad)")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.1f)
+                    ->Attribute(AZ::Edit::Attributes::Max, AZ::Constants::HalfPi)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &MecanumDriveModel::m_limits, "Vehicle Limits", "Limits");
+            }
+        }
+    }
+
+    AZ::Vector3 MecanumDriveModel::ComputeWheelInverseKinematics(
+        float longitudinalOffset, float lateralOffset, float wheelRadius, float rollerAngle)
+    {
+        if (wheelRadius == 0.0f)
+        {
+            return AZ::Vector3::CreateZero();
+        }
+
+        // In the X arrangement, rollers of wheels in the front left and rear right quarters lean the other way than the rest
+        const float product = longitudinalOffset * lateralOffset;
+        const float rollerDirection = AZ::IsClose(product, 0.0f) ? 0.0f : (product > 0.0f ? -1.0f : 1.0f);
+        const float lateralFactor = rollerDirection / AZStd::tan(rollerAngle);
+        const float angularFactor = longitudinalOffset * lateralFactor - lateralOffset;
+        return AZ::Vector3(1.0f, lateralFactor, angularFactor) / wheelRadius;
+    }
+
+    void MecanumDriveModel::Activate(const VehicleConfiguration& vehicleConfig)
+    {
+        m_vehicleConfiguration = vehicleConfig;
+        m_wheelHandles.Activate(m_vehicleConfiguration);
+        AZ_Warning(
+            "MecanumDriveModel", m_vehicleConfiguration.m_axles.size() > 1, "Mecanum model needs at least two axles to move sideways");
+
+        const float halfWheelbase = 0.5f * m_vehicleConfiguration.m_wheelbase;
+        const float halfTrack = 0.5f * m_vehicleConfiguration.m_track;
+        const auto& driveWheels = m_wheelHandles.GetDriveWheels();
+        AZ_Warning("MecanumDriveModel", !driveWheels.empty(), "Mecanum model does not have any drive wheels.");
+        m_wheelInverseKinematics.clear();
+        m_wheelInverseKinematics.reserve(driveWheels.size());
+        for (const WheelDynamicsData& wheelData : driveWheels)
+        {
+            // Wheels of an axle are sorted left to right
+            const float longitudinalOffset =
+                Utilities::GetAxleLongitudinalPosition(m_vehicleConfiguration, wheelData.m_axleIndex) - halfWheelbase;
+            const float lateralOffset = -wheelData.m_axlePosition * halfTrack;
+            m_wheelInverseKinematics.push_back(
+                ComputeWheelInverseKinematics(longitudinalOffset, lateralOffset, wheelData.m_wheelRadius, m_rollerAngle));
+        }
+    }
+
+    const MecanumModelLimits& MecanumDriveModel::GetLimits() const
+    {
+        return m_limits;
+    }
+
+    const AZStd::vector<AZ::Vector3>& MecanumDriveModel::GetWheelInverseKinematics() const
+    {
+        return m_wheelInverseKinematics;
+    }
+
+    const VehicleModelLimits* MecanumDriveModel::GetVehicleLimitPtr() const
+    {
+        return &m_limits;
+    }
+} // namespace ROS2::VehicleDynamics
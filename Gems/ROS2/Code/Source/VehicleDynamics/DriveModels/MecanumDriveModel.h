@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <VehicleDynamics/DriveModel.h>
+#include <VehicleDynamics/ModelLimits/MecanumModelLimits.h>
+#include <VehicleDynamics/VehicleConfiguration.h>
+#include <VehicleDynamics/VehicleInputs.h>
+#include <VehicleDynamics/WheelDynamicsData.h>
+
+namespace ROS2::VehicleDynamics
+{
+    //! A mecanum drive model, wheels turn with rates that give the requested forward, sideways and angular speed.
+    //! Rollers of the wheels are expected in the common X arrangement: seen from above, rollers of the front left and rear right
+    //! wheels are parallel, and so are rollers of the front right and rear left wheels. Wheels on the center lines of the vehicle
+    //! do not contribute to sideways motion.
+    //! The inverse kinematics matrix, with one row per drive wheel, is computed on activation.
+    class MecanumDriveModel : public DriveModel
+    {
+    public:
+        AZ_RTTI(MecanumDriveModel, "{B260C08E-3E6E-41EF-AB30-7F3A12576842}", DriveModel);
+
+        // DriveModel overrides
+        void Activate(const VehicleConfiguration& vehicleConfig) override;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        const MecanumModelLimits& GetLimits() const;
+
+        //! Rows of the inverse kinematics matrix, in the order of drive wheels of the wheel handle table.
+        const AZStd::vector<AZ::Vector3>& GetWheelInverseKinematics() const;
+
+        //! Computes a row of the inverse kinematics matrix for a mecanum wheel.
+        //! @param longitudinalOffset position of the wheel ahead of the vehicle center, in meters.
+        //! @param lateralOffset position of the wheel to the left of the vehicle center, in meters.
+        //! @param wheelRadius radius of the wheel, in meters.
+        //! @param rollerAngle angle between rollers and the wheel axis, in radians.
+        //! @returns factors of forward speed, sideways speed and angular speed of the vehicle, which sum up to the wheel rate.
+        static AZ::Vector3 ComputeWheelInverseKinematics(
+            float longitudinalOffset, float lateralOffset, float wheelRadius, float rollerAngle);
+
+    protected:
+        // DriveModel overrides
+        const VehicleModelLimits* GetVehicleLimitPtr() const override;
+
+    private:
+        MecanumModelLimits m_limits;
+        float m_rollerAngle = AZ::Constants::QuarterPi; //!< [rad] Angle between rollers and the wheel axis.
+        AZStd::vector<AZ::Vector3> m_wheelInverseKinematics;
+    };
+} // namespace ROS2::VehicleDynamics
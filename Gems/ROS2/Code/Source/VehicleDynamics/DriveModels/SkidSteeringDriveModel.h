@@ -18,7 +18,7 @@
 
 namespace ROS2::VehicleDynamics
 {
-    //! A simple Ackermann system implementation converting speed and steering inputs into wheel impulse and steering element torque
+    //! A skid steering model, wheels on both sides of an axle turn with rates that give the requested linear and angular speed
     class SkidSteeringDriveModel : public DriveModel
     {
     public:
@@ -29,16 +29,13 @@ namespace ROS2::VehicleDynamics
 
         static void Reflect(AZ::ReflectContext* context);
 
+        const SkidSteeringModelLimits& GetLimits() const;
+
     protected:
         // DriveModel overrides
-        void ApplyState(const VehicleInputs& inputs, AZ::u64 deltaTimeNs) override;
         const VehicleModelLimits* GetVehicleLimitPtr() const override;
 
     private:
         SkidSteeringModelLimits m_limits;
-        AZStd::unordered_map<AZ::EntityId, AZ::EntityComponentIdPair> m_wheelsData;
-        VehicleConfiguration m_config;
-        float m_currentLinearVelocity = 0.0f;
-        float m_currentAngularVelocity = 0.0f;
     };
 } // namespace ROS2::VehicleDynamics
@@ -51,11 +51,4 @@ namespace ROS2::VehicleDynamics
     {
         return &m_driveModel;
     };
-
-    void AckermannVehicleModelComponent::Activate()
-    {
-        VehicleModelComponent::Activate();
-        m_driveModel.Activate(m_vehicleConfiguration);
-    }
-
 } // namespace ROS2::VehicleDynamics
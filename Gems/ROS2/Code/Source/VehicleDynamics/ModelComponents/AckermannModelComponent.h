@@ -26,7 +26,6 @@ namespace ROS2::VehicleDynamics
         // Component overrides
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
-        void Activate() override;
 
     private:
         VehicleDynamics::AckermannDriveModel m_driveModel;
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "MecanumModelComponent.h"
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace ROS2::VehicleDynamics
+{
+    void MecanumModelComponent::Reflect(AZ::ReflectContext* context)
+    {
+        MecanumDriveModel::Reflect(context);
+
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<MecanumModelComponent, VehicleModelComponent>()->Version(1)->Field(
+                "DriveModel", &MecanumModelComponent::m_driveModel);
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<MecanumModelComponent>("Mecanum Vehicle Model", "Mecanum wheeled vehicle model component")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(AZ::Edit::Attributes::Category, "ROS2")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MecanumModelComponent::m_driveModel,
+                        "Drive model",
+                        "Settings of the selected drive model");
+            }
+        }
+    }
+
+    void MecanumModelComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("MecanumModelService"));
+    }
+
+    void MecanumModelComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("MecanumModelService"));
+    }
+
+    VehicleDynamics::DriveModel* MecanumModelComponent::GetDriveModel()
+    {
+        return &m_driveModel;
+    };
+
+} // namespace ROS2::VehicleDynamics
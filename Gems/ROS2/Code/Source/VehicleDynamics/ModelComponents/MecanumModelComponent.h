@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <VehicleDynamics/DriveModels/MecanumDriveModel.h>
+#include <VehicleDynamics/VehicleModelComponent.h>
+
+namespace ROS2::VehicleDynamics
+{
+    class MecanumModelComponent : public VehicleModelComponent
+    {
+    public:
+        AZ_COMPONENT(MecanumModelComponent, "{7F89ECB2-4432-4C92-A4EC-8A5736D1238F}", VehicleModelComponent);
+        MecanumModelComponent() = default;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        // Component overrides
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+    private:
+        VehicleDynamics::MecanumDriveModel m_driveModel;
+
+    protected:
+        // VehicleModelComponent overrides
+        VehicleDynamics::DriveModel* GetDriveModel() override;
+    };
+} // namespace ROS2::VehicleDynamics
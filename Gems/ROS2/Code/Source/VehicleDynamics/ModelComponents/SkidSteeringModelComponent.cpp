@@ -52,9 +52,4 @@ namespace ROS2::VehicleDynamics
         return &m_driveModel;
     };
 
-    void SkidSteeringModelComponent::Activate()
-    {
-        VehicleModelComponent::Activate();
-        m_driveModel.Activate(m_vehicleConfiguration);
-    }
 } // namespace ROS2::VehicleDynamics
@@ -26,9 +26,6 @@ namespace ROS2::VehicleDynamics
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
 
-        // Component overrides
-        void Activate() override;
-
     private:
         VehicleDynamics::SkidSteeringDriveModel m_driveModel;
 
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "MecanumModelLimits.h"
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace ROS2::VehicleDynamics
+{
+    void MecanumModelLimits::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<MecanumModelLimits>()
+                ->Version(1)
+                ->Field("LinearLimit", &MecanumModelLimits::m_linearLimit)
+                ->Field("LateralLimit", &MecanumModelLimits::m_lateralLimit)
+                ->Field("AngularLimit", &MecanumModelLimits::m_angularLimit)
+                ->Field("LinearAcceleration", &MecanumModelLimits::m_linearAcceleration)
+                ->Field("LateralAcceleration", &MecanumModelLimits::m_lateralAcceleration)
+                ->Field("AngularAcceleration", &MecanumModelLimits::m_angularAcceleration);
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<MecanumModelLimits>("Mecanum Model Limits", "Limitations of speed, acceleration and other values")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::Category, "ROS2")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MecanumModelLimits::m_linearLimit,
+                        "Linear speed Limit",
+                        "Max forward speed (meters/sec)")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Max, 100.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MecanumModelLimits::m_lateralLimit,
+                        "Lateral speed Limit",
+                        "Max sideways speed (meters/sec)")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Max, 100.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MecanumModelLimits::m_angularLimit,
+                        "Angular speed Limit",
+                        "Max angular speed (rad/s)")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Max, 10.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MecanumModelLimits::m_linearAcceleration,
+                        "Linear acceleration",
+                        "Forward acceleration in m/s²")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Max, 100.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MecanumModelLimits::m_lateralAcceleration,
+                        "Lateral acceleration",
+                        "Sideways acceleration in m/s²")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Max, 100.0f)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MecanumModelLimits::m_angularAcceleration,
+                        "Angular acceleration",
+                        "Acceleration in rad/s²")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Max, 100.0f);
+            }
+        }
+    }
+
+    VehicleInputs MecanumModelLimits::LimitState(const VehicleInputs& inputState) const
+    {
+        VehicleInputs ret = inputState;
+        ret.m_speed = AZ::Vector3{ LimitValue(ret.m_speed.GetX(), m_linearLimit), LimitValue(ret.m_speed.GetY(), m_lateralLimit), 0.f };
+        ret.m_angularRates = AZ::Vector3{ 0.f, 0.f, LimitValue(ret.m_angularRates.GetZ(), m_angularLimit) };
+        return ret;
+    }
+
+    VehicleInputs MecanumModelLimits::GetMaximumState() const
+    {
+        VehicleInputs ret;
+        ret.m_speed = { m_linearLimit, m_lateralLimit, 0 };
+        ret.m_angularRates = { 0, 0, m_angularLimit };
+        return ret;
+    }
+
+    float MecanumModelLimits::GetLinearAcceleration() const
+    {
+        return m_linearAcceleration;
+    }
+
+    float MecanumModelLimits::GetLateralAcceleration() const
+    {
+        return m_lateralAcceleration;
+    }
+
+    float MecanumModelLimits::GetAngularAcceleration() const
+    {
+        return m_angularAcceleration;
+    }
+
+    float MecanumModelLimits::GetLinearSpeedLimit() const
+    {
+        return m_linearLimit;
+    }
+
+    float MecanumModelLimits::GetLateralSpeedLimit() const
+    {
+        return m_lateralLimit;
+    }
+
+    float MecanumModelLimits::GetAngularSpeedLimit() const
+    {
+        return m_angularLimit;
+    }
+} // namespace ROS2::VehicleDynamics
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <VehicleDynamics/VehicleModelLimits.h>
+
+namespace ROS2::VehicleDynamics
+{
+    //! A structure holding limits of a mecanum wheeled robot, which moves forward, sideways and rotates independently.
+    class MecanumModelLimits : public VehicleModelLimits
+    {
+    public:
+        AZ_RTTI(MecanumModelLimits, "{1A1622C2-35E4-40EF-95A0-1A7ECBF978B7}", VehicleModelLimits);
+        MecanumModelLimits() = default;
+        static void Reflect(AZ::ReflectContext* context);
+
+        // VehicleModelLimits overrides
+        VehicleInputs LimitState(const VehicleInputs& inputState) const;
+        VehicleInputs GetMaximumState() const;
+
+        float GetLinearAcceleration() const;
+        float GetLateralAcceleration() const;
+        float GetAngularAcceleration() const;
+        float GetLinearSpeedLimit() const;
+        float GetLateralSpeedLimit() const;
+        float GetAngularSpeedLimit() const;
+
+    private:
+        float m_linearLimit = 1.5f; //!< [m/s] Maximum forward travel velocity.
+        float m_lateralLimit = 1.0f; //!< [m/s] Maximum sideways travel velocity.
+        float m_angularLimit = 2.0f; //!< [Rad/s] Maximum rotation speed.
+        float m_linearAcceleration = 1.5f; //!< [m*s^(-2)] Forward acceleration limit
+        float m_lateralAcceleration = 1.0f; //!< [m*s^(-2)] Sideways acceleration limit
+        float m_angularAcceleration = 2.0f; //!< [rad*s^(-2)] Angular acceleration limit
+    };
+} // namespace ROS2::VehicleDynamics
@@ -9,7 +9,6 @@
 
 #include "AxleConfiguration.h"
 #include "VehicleConfiguration.h"
-#include "WheelDynamicsData.h"
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
@@ -40,22 +39,11 @@ namespace ROS2::VehicleDynamics::Utilities
     //! @param wheelRadius radius in meters
     AxleConfiguration CreateRearDriveAxle(AZ::EntityId leftWheel, AZ::EntityId rightWheel, float wheelRadius);
 
-    //! Retrieve all steering entities for a given vehicle configuration.
-    //! @param vehicleConfig Vehicle configuration to process.
-    //! @returns This function will only return data for properly set up steering entities and raise warnings if something is not right.
-    //! Wheels with a WheelControllerComponent need a SteeringEntity set, and the axle must be a steering axle.
-    AZStd::vector<VehicleDynamics::SteeringDynamicsData> GetAllSteeringEntitiesData(const VehicleConfiguration& vehicleConfig);
-
-    //! Retrieve all drive entities for a given vehicle configuration.
-    //! @param vehicleConfig Vehicle configuration to process.
-    //! @returns This function will only return data for properly set up wheels and raise warnings if something is not right.
-    //! Wheels need a WheelControllerComponent, and the axle must be a drive axle.
-    AZStd::vector<VehicleDynamics::WheelDynamicsData> GetAllDriveWheelsData(const VehicleConfiguration& vehicleConfig);
-
-    //! Get Physx Hinge Joint Component AZ::EntityComponentIdPair from Entity
-    //! @param wheelEntityId id of entity that has Physx Hinge Joint Controller
-    //! @returns EntityComponentIdPair that contains id of Hinge component and @param wheelEntityId
-    AZ::EntityComponentIdPair GetWheelPhysxHinge(const AZ::EntityId wheelEntityId);
+    //! Position of an axle along the vehicle. Axles are spaced evenly over the wheelbase, front to rear.
+    //! @param vehicleConfig configuration with axles and wheelbase of the vehicle.
+    //! @param axleIndex index of the axle in the vehicle configuration.
+    //! @returns distance of the axle ahead of the rear axle in meters, the wheelbase for a single axle.
+    float GetAxleLongitudinalPosition(const VehicleConfiguration& vehicleConfig, size_t axleIndex);
 
     //! Computes ramped velocity.
     //! @param targetVelocity Last commanded velocity to send to robot (in eg m/s or rad/s)
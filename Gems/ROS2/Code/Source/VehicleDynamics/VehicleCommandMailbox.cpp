@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "VehicleCommandMailbox.h"
+#include <AzCore/std/time.h>
+
+namespace ROS2::VehicleDynamics
+{
+    int64_t VehicleCommandMailbox::GetReceiveTimeUs()
+    {
+        return static_cast<int64_t>(AZStd::GetTimeNowMicroSecond());
+    }
+
+    void VehicleCommandMailbox::WriteTwist(const AZ::Vector3& linear, const AZ::Vector3& angular)
+    {
+        WriteTwist(linear, angular, GetReceiveTimeUs());
+    }
+
+    void VehicleCommandMailbox::WriteAckermann(const AckermannCommandStruct& command)
+    {
+        WriteAckermann(command, GetReceiveTimeUs());
+    }
+
+    void VehicleCommandMailbox::WriteTwist(const AZ::Vector3& linear, const AZ::Vector3& angular, int64_t receiveTimeUs)
+    {
+        TwistCommand command;
+        linear.StoreToFloat3(command.m_linear);
+        angular.StoreToFloat3(command.m_angular);
+        command.m_receiveTimeUs = receiveTimeUs;
+        m_twist.Write(command);
+    }
+
+    void VehicleCommandMailbox::WriteAckermann(const AckermannCommandStruct& command, int64_t receiveTimeUs)
+    {
+        m_ackermann.Write(AckermannCommand{ command, receiveTimeUs });
+    }
+
+    bool VehicleCommandMailbox::ReadTwist(AZ::Vector3& linear, AZ::Vector3& angular, AZ::u32& readCount) const
+    {
+        TwistCommand twist;
+        const AZ::u32 written = m_twist.Read(twist);
+        if (written == readCount)
+        {
+            return false;
+        }
+        readCount = written;
+        linear = AZ::Vector3::CreateFromFloat3(twist.m_linear);
+        angular = AZ::Vector3::CreateFromFloat3(twist.m_angular);
+        return true;
+    }
+
+    bool VehicleCommandMailbox::ReadAckermann(AckermannCommandStruct& command, AZ::u32& readCount) const
+    {
+        AckermannCommand ackermann;
+        const AZ::u32 written = m_ackermann.Read(ackermann);
+        if (written == readCount)
+        {
+            return false;
+        }
+        readCount = written;
+        command = ackermann.m_command;
+        return true;
+    }
+
+    void VehicleCommandMailbox::DeliverTo(VehicleInputDeadline& inputs, int64_t substepStartUs, int64_t receiveClockOffsetUs)
+    {
+        TwistCommand twist;
+        if (const AZ::u32 written = m_twist.Read(twist); written != m_deliveredTwist)
+        {
+            if (const int64_t updateTimeUs = twist.m_receiveTimeUs + receiveClockOffsetUs; updateTimeUs <= substepStartUs)
+            {
+                m_deliveredTwist = written;
+                inputs.m_speed.UpdateValue(AZ::Vector3::CreateFromFloat3(twist.m_linear), updateTimeUs);
+                inputs.m_angularRates.UpdateValue(AZ::Vector3::CreateFromFloat3(twist.m_angular), updateTimeUs);
+            }
+        }
+
+        AckermannCommand ackermann;
+        if (const AZ::u32 written = m_ackermann.Read(ackermann); written != m_deliveredAckermann)
+        {
+            if (const int64_t updateTimeUs = ackermann.m_receiveTimeUs + receiveClockOffsetUs; updateTimeUs <= substepStartUs)
+            {
+                m_deliveredAckermann = written;
+                inputs.m_speed.UpdateValue(AZ::Vector3(ackermann.m_command.m_speed, 0.0f, 0.0f), updateTimeUs);
+                inputs.m_jointRequestedPosition.UpdateValue({ ackermann.m_command.m_steeringAngle }, updateTimeUs);
+            }
+        }
+    }
+} // namespace ROS2::VehicleDynamics
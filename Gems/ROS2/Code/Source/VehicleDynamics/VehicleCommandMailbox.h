@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "VehicleInputs.h"
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
+#include <ROS2/RobotControl/Ackermann/AckermannCommandStruct.h>
+#include <cstring>
+
+namespace ROS2::VehicleDynamics
+{
+    //! Latest value of a type, written by one thread and read by others without locks (seqlock).
+    //! The writer never waits. A reader retries while a write is in progress, which only takes a copy of the value.
+    //! @note There can be only one writer at a time.
+    template<typename T>
+    class LatestValueMailbox
+    {
+        static_assert(AZStd::is_trivially_copyable_v<T>, "Mailbox value is copied while it can be written");
+
+    public:
+        void Write(const T& value)
+        {
+            const AZ::u32 sequence = m_sequence.load(AZStd::memory_order_relaxed);
+            m_sequence.store(sequence + 1, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            memcpy(&m_value, &value, sizeof(T));
+            m_sequence.store(sequence + 2, AZStd::memory_order_release);
+        }
+
+        //! Reads the latest value.
+        //! @returns number of writes up to the value, 0 if nothing was written yet.
+        AZ::u32 Read(T& value) const
+        {
+            while (true)
+            {
+                const AZ::u32 sequence = m_sequence.load(AZStd::memory_order_acquire);
+                if (sequence & 1)
+                {
+                    continue;
+                }
+                memcpy(&value, &m_value, sizeof(T));
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                if (m_sequence.load(AZStd::memory_order_relaxed) == sequence)
+                {
+                    return sequence / 2;
+                }
+            }
+        }
+
+    private:
+        AZStd::atomic<AZ::u32> m_sequence{ 0 };
+        T m_value{};
+    };
+
+    //! Twist and Ackermann commands for an entity, written by a ROS 2 subscription on the thread of its callback.
+    //! Commands are delivered to vehicle inputs on physics substeps, with their receive time. A command is applied from the
+    //! first substep which starts after it was received, and the input deadline counts from the moment it arrived rather
+    //! than from the moment it was delivered. Only the latest command of each type is kept.
+    //! The subscription reads commands back on the main thread to notify control buses.
+    class VehicleCommandMailbox
+    {
+    public:
+        //! Current time of the receive clock, the monotonic system clock which can be read from any thread.
+        static int64_t GetReceiveTimeUs();
+
+        void WriteTwist(const AZ::Vector3& linear, const AZ::Vector3& angular);
+        void WriteAckermann(const AckermannCommandStruct& command);
+
+        //! Writes a twist which was received at a given time of the receive clock.
+        void WriteTwist(const AZ::Vector3& linear, const AZ::Vector3& angular, int64_t receiveTimeUs);
+        //! Writes an Ackermann command which was received at a given time of the receive clock.
+        void WriteAckermann(const AckermannCommandStruct& command, int64_t receiveTimeUs);
+
+        //! Reads the latest twist, if there was a write which the reader has not seen yet.
+        //! @param readCount number of writes seen by the reader, updated on read.
+        //! @returns true if a new twist was read.
+        bool ReadTwist(AZ::Vector3& linear, AZ::Vector3& angular, AZ::u32& readCount) const;
+
+        //! Reads the latest Ackermann command, if there was a write which the reader has not seen yet.
+        //! @param readCount number of writes seen by the reader, updated on read.
+        //! @returns true if a new command was read.
+        bool ReadAckermann(AckermannCommandStruct& command, AZ::u32& readCount) const;
+
+        //! Updates inputs with commands received since the last delivery and before the start of a physics substep.
+        //! A command received later stays in the mailbox for a following substep. Only speed and steering are delivered.
+        //! @param substepStartUs start of the substep, on the same clock as ITime elapsed time.
+        //! @param receiveClockOffsetUs offset to add to receive times to get times on the clock of ITime elapsed time.
+        void DeliverTo(VehicleInputDeadline& inputs, int64_t substepStartUs, int64_t receiveClockOffsetUs);
+
+    private:
+        struct TwistCommand
+        {
+            float m_linear[3];
+            float m_angular[3];
+            int64_t m_receiveTimeUs;
+        };
+
+        struct AckermannCommand
+        {
+            AckermannCommandStruct m_command;
+            int64_t m_receiveTimeUs;
+        };
+
+        LatestValueMailbox<TwistCommand> m_twist;
+        LatestValueMailbox<AckermannCommand> m_ackermann;
+
+        // Reader side of the vehicle
+        AZ::u32 m_deliveredTwist = 0;
+        AZ::u32 m_deliveredAckermann = 0;
+    };
+} // namespace ROS2::VehicleDynamics
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "VehicleDynamicsSystem.h"
+#include "DriveModels/AckermannDriveModel.h"
+#include "DriveModels/MecanumDriveModel.h"
+#include "DriveModels/SkidSteeringDriveModel.h"
+#include "Utilities.h"
+#include "VehicleModelComponent.h"
+#include <AzCore/Component/EntityUtils.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <PhysX/Joint/PhysXJointRequestsBus.h>
+
+namespace ROS2::VehicleDynamics
+{
+    size_t VehicleFleetState::AddVehicle(const VehicleLimits& limits)
+    {
+        m_targetLinearSpeeds.push_back(0.0f);
+        m_targetLateralSpeeds.push_back(0.0f);
+        m_targetAngularSpeeds.push_back(0.0f);
+        m_linearSpeeds.push_back(0.0f);
+        m_lateralSpeeds.push_back(0.0f);
+        m_angularSpeeds.push_back(0.0f);
+        m_limits.push_back(limits);
+        m_disabled.push_back(0);
+        return m_limits.size() - 1;
+    }
+
+    void VehicleFleetState::AddWheel(size_t vehicleIndex, const WheelDynamicsData* wheelData, float leverArm, float wheelRadius)
+    {
+        const float inverseRadius = wheelRadius != 0.0f ? 1.0f / wheelRadius : 0.0f;
+        AddWheel(vehicleIndex, wheelData, AZ::Vector3(inverseRadius, 0.0f, leverArm * inverseRadius));
+    }
+
+    void VehicleFleetState::AddWheel(size_t vehicleIndex, const WheelDynamicsData* wheelData, const AZ::Vector3& inverseKinematics)
+    {
+        AZ_Assert(vehicleIndex < m_limits.size(), "Invalid vehicle index %zu", vehicleIndex);
+        m_wheelVehicles.push_back(aznumeric_cast<AZ::u32>(vehicleIndex));
+        m_wheelLinearFactors.push_back(inverseKinematics.GetX());
+        m_wheelLateralFactors.push_back(inverseKinematics.GetY());
+        m_wheelAngularFactors.push_back(inverseKinematics.GetZ());
+        m_wheelRates.push_back(0.0f);
+        m_wheelData.push_back(wheelData);
+    }
+
+    void VehicleFleetState::RemoveWheel(size_t wheelIndex)
+    {
+        SwapRemove(m_wheelVehicles, wheelIndex);
+        SwapRemove(m_wheelLinearFactors, wheelIndex);
+        SwapRemove(m_wheelLateralFactors, wheelIndex);
+        SwapRemove(m_wheelAngularFactors, wheelIndex);
+        SwapRemove(m_wheelRates, wheelIndex);
+        SwapRemove(m_wheelData, wheelIndex);
+    }
+
+    void VehicleFleetState::RemoveVehicle(size_t vehicleIndex)
+    {
+        AZ_Assert(vehicleIndex < m_limits.size(), "Invalid vehicle index %zu", vehicleIndex);
+        for (size_t wheelIndex = 0; wheelIndex < m_wheelVehicles.size();)
+        {
+            if (m_wheelVehicles[wheelIndex] == vehicleIndex)
+            {
+                RemoveWheel(wheelIndex);
+            }
+            else
+            {
+                ++wheelIndex;
+            }
+        }
+
+        const size_t lastIndex = m_limits.size() - 1;
+        SwapRemove(m_targetLinearSpeeds, vehicleIndex);
+        SwapRemove(m_targetLateralSpeeds, vehicleIndex);
+        SwapRemove(m_targetAngularSpeeds, vehicleIndex);
+        SwapRemove(m_linearSpeeds, vehicleIndex);
+        SwapRemove(m_lateralSpeeds, vehicleIndex);
+        SwapRemove(m_angularSpeeds, vehicleIndex);
+        SwapRemove(m_limits, vehicleIndex);
+        SwapRemove(m_disabled, vehicleIndex);
+        for (auto& wheelVehicle : m_wheelVehicles)
+        {
+            if (wheelVehicle == lastIndex)
+            {
+                wheelVehicle = aznumeric_cast<AZ::u32>(vehicleIndex);
+            }
+        }
+    }
+
+    size_t VehicleFleetState::GetVehicleCount() const
+    {
+        return m_limits.size();
+    }
+
+    size_t VehicleFleetState::GetWheelCount() const
+    {
+        return m_wheelVehicles.size();
+    }
+
+    void VehicleFleetState::SetTarget(size_t vehicleIndex, float linearSpeed, float lateralSpeed, float angularSpeed, bool disabled)
+    {
+        m_targetLinearSpeeds[vehicleIndex] = linearSpeed;
+        m_targetLateralSpeeds[vehicleIndex] = lateralSpeed;
+        m_targetAngularSpeeds[vehicleIndex] = angularSpeed;
+        m_disabled[vehicleIndex] = disabled ? 1 : 0;
+    }
+
+    void VehicleFleetState::ComputeWheelRates(AZ::u64 deltaTimeNs)
+    {
+        const size_t vehicleCount = m_limits.size();
+        for (size_t i = 0; i < vehicleCount; ++i)
+        {
+            if (m_disabled[i])
+            {
+                continue;
+            }
+            const VehicleLimits& limits = m_limits[i];
+            m_linearSpeeds[i] = Utilities::ComputeRampVelocity(
+                m_targetLinearSpeeds[i], m_linearSpeeds[i], deltaTimeNs, limits.m_linearAcceleration, limits.m_linearSpeedLimit);
+            m_lateralSpeeds[i] = Utilities::ComputeRampVelocity(
+                m_targetLateralSpeeds[i], m_lateralSpeeds[i], deltaTimeNs, limits.m_lateralAcceleration, limits.m_lateralSpeedLimit);
+            m_angularSpeeds[i] = Utilities::ComputeRampVelocity(
+                m_targetAngularSpeeds[i], m_angularSpeeds[i], deltaTimeNs, limits.m_angularAcceleration, limits.m_angularSpeedLimit);
+        }
+
+        const size_t wheelCount = m_wheelVehicles.size();
+        for (size_t i = 0; i < wheelCount; ++i)
+        {
+            const AZ::u32 vehicle = m_wheelVehicles[i];
+            m_wheelRates[i] = m_linearSpeeds[vehicle] * m_wheelLinearFactors[i] + m_lateralSpeeds[vehicle] * m_wheelLateralFactors[i] +
+                m_angularSpeeds[vehicle] * m_wheelAngularFactors[i];
+        }
+    }
+
+    void VehicleFleetState::ApplyWheelRates() const
+    {
+        const size_t wheelCount = m_wheelVehicles.size();
+        for (size_t i = 0; i < wheelCount; ++i)
+        {
+            const WheelDynamicsData* wheelData = m_wheelData[i];
+            if (m_disabled[m_wheelVehicles[i]] || !wheelData || wheelData->m_hingeJoint == AZ::InvalidComponentId)
+            {
+                continue;
+            }
+            const auto id = AZ::EntityComponentIdPair(wheelData->m_wheelEntity, wheelData->m_hingeJoint);
+            PhysX::JointRequestBus::Event(id, &PhysX::JointRequests::SetVelocity, m_wheelRates[i]);
+        }
+    }
+
+    float VehicleFleetState::GetLinearSpeed(size_t vehicleIndex) const
+    {
+        return m_linearSpeeds[vehicleIndex];
+    }
+
+    float VehicleFleetState::GetLateralSpeed(size_t vehicleIndex) const
+    {
+        return m_lateralSpeeds[vehicleIndex];
+    }
+
+    float VehicleFleetState::GetAngularSpeed(size_t vehicleIndex) const
+    {
+        return m_angularSpeeds[vehicleIndex];
+    }
+
+    float VehicleFleetState::GetWheelRate(size_t wheelIndex) const
+    {
+        return m_wheelRates[wheelIndex];
+    }
+
+    VehicleDynamicsSystem::VehicleDynamicsSystem()
+        : PhysicsSubstepSystem(PhysicsSubstepEvent::SimulationStart)
+    {
+    }
+
+    void VehicleDynamicsSystem::RegisterVehicle(AZ::EntityId entityId, DriveModel* driveModel, VehicleInputDeadline* inputs)
+    {
+        AZ_Assert(driveModel && inputs, "Vehicle requires a drive model and inputs");
+        if (m_indices.contains(entityId))
+        {
+            AZ_Error("VehicleDynamicsSystem", false, "Entity %s already has a vehicle registered", entityId.ToString().c_str());
+            return;
+        }
+
+        VehicleFleetState::VehicleLimits limits;
+        bool hasLeverArms = false;
+        const AZStd::vector<AZ::Vector3>* wheelInverseKinematics = nullptr;
+        auto* ackermannModel = azrtti_cast<AckermannDriveModel*>(driveModel);
+        if (ackermannModel)
+        {
+            limits.m_linearAcceleration = ackermannModel->GetLimits().GetLinearAcceleration();
+            limits.m_linearSpeedLimit = ackermannModel->GetLimits().GetLinearSpeedLimit();
+        }
+        else if (auto* skidSteeringModel = azrtti_cast<SkidSteeringDriveModel*>(driveModel))
+        {
+            const SkidSteeringModelLimits& skidSteeringLimits = skidSteeringModel->GetLimits();
+            limits.m_linearAcceleration = skidSteeringLimits.GetLinearAcceleration();
+            limits.m_angularAcceleration = skidSteeringLimits.GetAngularAcceleration();
+            limits.m_linearSpeedLimit = skidSteeringLimits.GetLinearSpeedLimit();
+            limits.m_angularSpeedLimit = skidSteeringLimits.GetAngularSpeedLimit();
+            hasLeverArms = true;
+        }
+        else if (auto* mecanumModel = azrtti_cast<MecanumDriveModel*>(driveModel))
+        {
+            const MecanumModelLimits& mecanumLimits = mecanumModel->GetLimits();
+            limits.m_linearAcceleration = mecanumLimits.GetLinearAcceleration();
+            limits.m_lateralAcceleration = mecanumLimits.GetLateralAcceleration();
+            limits.m_angularAcceleration = mecanumLimits.GetAngularAcceleration();
+            limits.m_linearSpeedLimit = mecanumLimits.GetLinearSpeedLimit();
+            limits.m_lateralSpeedLimit = mecanumLimits.GetLateralSpeedLimit();
+            limits.m_angularSpeedLimit = mecanumLimits.GetAngularSpeedLimit();
+            wheelInverseKinematics = &mecanumModel->GetWheelInverseKinematics();
+        }
+        else
+        {
+            AZ_Error("VehicleDynamicsSystem", false, "Unsupported drive model %s", driveModel->RTTI_GetTypeName());
+            return;
+        }
+
+        const size_t index = m_fleetState.AddVehicle(limits);
+        const float halfWheelbase = 0.5f * driveModel->GetVehicleConfiguration().m_wheelbase;
+        const auto& driveWheels = driveModel->GetWheelHandles().GetDriveWheels();
+        for (size_t wheelIndex = 0; wheelIndex < driveWheels.size(); ++wheelIndex)
+        {
+            const WheelDynamicsData& wheelData = driveWheels[wheelIndex];
+            if (wheelInverseKinematics)
+            {
+                m_fleetState.AddWheel(index, &wheelData, (*wheelInverseKinematics)[wheelIndex]);
+                continue;
+            }
+            const float leverArm = hasLeverArms ? wheelData.m_axlePosition * halfWheelbase : 0.0f;
+            m_fleetState.AddWheel(index, &wheelData, leverArm, wheelData.m_wheelRadius);
+        }
+
+        m_indices[entityId] = index;
+        m_entityIds.push_back(entityId);
+        m_driveModels.push_back(driveModel);
+        m_inputs.push_back(inputs);
+        m_ackermannModels.push_back(ackermannModel);
+        m_commandMailboxes.push_back(GetOrCreateCommandMailbox(entityId));
+
+        ConnectToPhysicsScene();
+    }
+
+    void VehicleDynamicsSystem::UnregisterVehicle(AZ::EntityId entityId)
+    {
+        auto it = m_indices.find(entityId);
+        if (it == m_indices.end())
+        {
+            return;
+        }
+
+        // The fleet state moves the last vehicle in place of the removed one, per vehicle data follows
+        const size_t index = it->second;
+        m_indices.erase(it);
+        m_fleetState.RemoveVehicle(index);
+        SwapRemove(m_entityIds, index);
+        SwapRemove(m_driveModels, index);
+        SwapRemove(m_inputs, index);
+        SwapRemove(m_ackermannModels, index);
+        SwapRemove(m_commandMailboxes, index);
+        if (index < m_entityIds.size())
+        {
+            m_indices[m_entityIds[index]] = index;
+        }
+
+        if (auto mailbox = m_mailboxesByEntity.find(entityId); mailbox != m_mailboxesByEntity.end() && mailbox->second.expired())
+        {
+            m_mailboxesByEntity.erase(mailbox);
+        }
+    }
+
+    AZStd::shared_ptr<VehicleCommandMailbox> VehicleDynamicsSystem::AcquireCommandMailbox(const AZ::Entity* entity)
+    {
+        AZ_Assert(entity, "Null entity");
+        if (!AZ::EntityUtils::FindFirstDerivedComponent<VehicleModelComponent>(entity))
+        {
+            return nullptr;
+        }
+        return GetOrCreateCommandMailbox(entity->GetId());
+    }
+
+    AZStd::shared_ptr<VehicleCommandMailbox> VehicleDynamicsSystem::GetOrCreateCommandMailbox(AZ::EntityId entityId)
+    {
+        auto& entry = m_mailboxesByEntity[entityId];
+        AZStd::shared_ptr<VehicleCommandMailbox> mailbox = entry.lock();
+        if (!mailbox)
+        {
+            mailbox = AZStd::make_shared<VehicleCommandMailbox>();
+            entry = mailbox;
+        }
+        return mailbox;
+    }
+
+    void VehicleDynamicsSystem::OnPhysicsSubstep(float fixedDeltaTime)
+    {
+        if (m_entityIds.empty())
+        {
+            return;
+        }
+
+        const AZ::u64 deltaTimeNs = aznumeric_cast<AZ::u64>(fixedDeltaTime * 1'000'000'000);
+        const int64_t deltaTimeUs = static_cast<int64_t>(deltaTimeNs / 1000);
+        const int64_t nowUs = static_cast<int64_t>(AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeUs());
+        if (nowUs != m_frameTimeUs)
+        {
+            // The first substep of a frame starts where the previous frame ended, up to the remainder kept by the physics scene.
+            // Time dropped by the physics scene is skipped, so that commands are not held back.
+            m_nextSubstepStartUs =
+                m_frameTimeUs < 0 ? nowUs - deltaTimeUs : AZStd::max(m_nextSubstepStartUs, m_frameTimeUs - deltaTimeUs);
+            m_frameTimeUs = nowUs;
+        }
+        const int64_t substepStartUs = AZStd::min(m_nextSubstepStartUs, nowUs - deltaTimeUs);
+        m_nextSubstepStartUs = substepStartUs + deltaTimeUs;
+
+        Step(deltaTimeNs, substepStartUs, nowUs - VehicleCommandMailbox::GetReceiveTimeUs());
+    }
+
+    void VehicleDynamicsSystem::Step(AZ::u64 deltaTimeNs, int64_t substepStartUs, int64_t receiveClockOffsetUs)
+    {
+        const size_t vehicleCount = m_entityIds.size();
+        for (size_t i = 0; i < vehicleCount; ++i)
+        {
+            m_commandMailboxes[i]->DeliverTo(*m_inputs[i], substepStartUs, receiveClockOffsetUs);
+            const DriveModel* driveModel = m_driveModels[i];
+            const VehicleInputs inputs = driveModel->LimitInputs(m_inputs[i]->GetValueCheckingDeadline(substepStartUs));
+            m_fleetState.SetTarget(
+                i, inputs.m_speed.GetX(), inputs.m_speed.GetY(), inputs.m_angularRates.GetZ(), driveModel->IsDisabled());
+            if (m_ackermannModels[i])
+            {
+                const float steering = inputs.m_jointRequestedPosition.empty() ? 0.0f : inputs.m_jointRequestedPosition.front();
+                m_ackermannModels[i]->ApplySteering(steering, deltaTimeNs);
+            }
+        }
+
+        m_fleetState.ComputeWheelRates(deltaTimeNs);
+        m_fleetState.ApplyWheelRates();
+    }
+
+    const VehicleFleetState& VehicleDynamicsSystem::GetFleetState() const
+    {
+        return m_fleetState;
+    }
+} // namespace ROS2::VehicleDynamics
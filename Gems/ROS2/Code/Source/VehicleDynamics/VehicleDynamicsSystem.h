@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "DriveModel.h"
+#include "VehicleCommandMailbox.h"
+#include "VehicleInputs.h"
+#include "WheelDynamicsData.h"
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
+#include <Utilities/PhysicsSubstepSystem.h>
+
+namespace ROS2::VehicleDynamics
+{
+    class AckermannDriveModel;
+
+    //! Speed state of a fleet of vehicles and their drive wheels, stored as structure of arrays.
+    //! Speed ramps of all vehicles are advanced in one pass, then rates of all drive wheels are computed in one pass.
+    //! A wheel rate is the dot product of its row of the inverse kinematics matrix with forward, sideways and angular speed
+    //! of the vehicle. For skid steering and Ackermann wheels the row is (1, 0, lever arm) / wheel radius, where the lever arm
+    //! of skid steering wheels is their position along the axle and Ackermann drive wheels have no lever arm.
+    class VehicleFleetState
+    {
+    public:
+        struct VehicleLimits
+        {
+            float m_linearAcceleration = 0.0f; //!< [m*s^(-2)]
+            float m_lateralAcceleration = 0.0f; //!< [m*s^(-2)]
+            float m_angularAcceleration = 0.0f; //!< [rad*s^(-2)]
+            float m_linearSpeedLimit = 0.0f; //!< [m/s]
+            float m_lateralSpeedLimit = 0.0f; //!< [m/s] Zero for vehicles which cannot move sideways.
+            float m_angularSpeedLimit = 0.0f; //!< [rad/s]
+        };
+
+        //! Adds a vehicle, initially at rest.
+        //! @returns index of the vehicle.
+        size_t AddVehicle(const VehicleLimits& limits);
+
+        //! Adds a drive wheel of a vehicle.
+        //! @param wheelData resolved joint of the wheel, which has to outlive the vehicle. Can be null if rates are not applied.
+        void AddWheel(size_t vehicleIndex, const WheelDynamicsData* wheelData, float leverArm, float wheelRadius);
+
+        //! Adds a drive wheel of a vehicle with any kinematics.
+        //! @param wheelData resolved joint of the wheel, which has to outlive the vehicle. Can be null if rates are not applied.
+        //! @param inverseKinematics factors of forward, sideways and angular speed of the vehicle which sum up to the wheel rate.
+        void AddWheel(size_t vehicleIndex, const WheelDynamicsData* wheelData, const AZ::Vector3& inverseKinematics);
+
+        //! Removes a vehicle with its wheels. The last vehicle takes its index.
+        void RemoveVehicle(size_t vehicleIndex);
+
+        size_t GetVehicleCount() const;
+        size_t GetWheelCount() const;
+
+        //! Sets the target of a vehicle for the next update.
+        //! A disabled vehicle keeps its speed state and its wheel rates are not applied.
+        void SetTarget(size_t vehicleIndex, float linearSpeed, float lateralSpeed, float angularSpeed, bool disabled);
+
+        //! Advances speed ramps of all vehicles and computes rates of all wheels.
+        void ComputeWheelRates(AZ::u64 deltaTimeNs);
+
+        //! Sets computed rates on the wheel joints.
+        void ApplyWheelRates() const;
+
+        float GetLinearSpeed(size_t vehicleIndex) const;
+        float GetLateralSpeed(size_t vehicleIndex) const;
+        float GetAngularSpeed(size_t vehicleIndex) const;
+        float GetWheelRate(size_t wheelIndex) const;
+
+    private:
+        void RemoveWheel(size_t wheelIndex);
+
+        // Per vehicle
+        AZStd::vector<float> m_targetLinearSpeeds;
+        AZStd::vector<float> m_targetLateralSpeeds;
+        AZStd::vector<float> m_targetAngularSpeeds;
+        AZStd::vector<float> m_linearSpeeds;
+        AZStd::vector<float> m_lateralSpeeds;
+        AZStd::vector<float> m_angularSpeeds;
+        AZStd::vector<VehicleLimits> m_limits;
+        AZStd::vector<AZ::u8> m_disabled;
+
+        // Per wheel
+        AZStd::vector<AZ::u32> m_wheelVehicles;
+        // Columns of the inverse kinematics matrix
+        AZStd::vector<float> m_wheelLinearFactors;
+        AZStd::vector<float> m_wheelLateralFactors;
+        AZStd::vector<float> m_wheelAngularFactors;
+        AZStd::vector<float> m_wheelRates;
+        AZStd::vector<const WheelDynamicsData*> m_wheelData;
+    };
+
+    //! Advances drive models of all vehicles on every physics substep with the fixed physics delta.
+    //! Inputs of all vehicles are read in one pass, then the fleet state computes and applies all wheel rates.
+    //! Commands received by ROS 2 subscriptions reach the vehicles through per entity mailboxes, delivered on every physics substep.
+    class VehicleDynamicsSystem : public PhysicsSubstepSystem<VehicleDynamicsSystem>
+    {
+    public:
+        AZ_RTTI(VehicleDynamicsSystem, "{3C8A5B0E-5E57-4E0B-8E1F-2E9A0F6B7D14}");
+
+        VehicleDynamicsSystem();
+        ~VehicleDynamicsSystem() override = default;
+
+        //! Registers a vehicle. There can be only one vehicle per entity.
+        //! @param driveModel activated drive model of the vehicle, supported are Ackermann, skid steering and mecanum models.
+        //! @param inputs inputs of the vehicle, read on every physics substep.
+        void RegisterVehicle(AZ::EntityId entityId, DriveModel* driveModel, VehicleInputDeadline* inputs);
+        void UnregisterVehicle(AZ::EntityId entityId);
+
+        //! Mailbox for commands to the vehicle of an entity, shared by the vehicle and command sources.
+        //! @param entity entity with a vehicle model component, it does not need to be active yet.
+        //! @returns mailbox, or null if the entity has no vehicle model component.
+        AZStd::shared_ptr<VehicleCommandMailbox> AcquireCommandMailbox(const AZ::Entity* entity);
+
+        //! Advances all vehicles by one physics substep, done on every substep of the default physics scene.
+        //! Commands received before the substep starts are delivered from mailboxes and inputs are read, then wheel rates
+        //! and steering are applied.
+        //! @param deltaTimeNs fixed time step of the physics scene.
+        //! @param substepStartUs simulated time at the start of the substep, on the same clock as ITime elapsed time.
+        //! @param receiveClockOffsetUs offset from the receive clock of mailboxes to the clock of ITime elapsed time.
+        void Step(AZ::u64 deltaTimeNs, int64_t substepStartUs, int64_t receiveClockOffsetUs);
+
+        //! Speed state of the registered vehicles, indexed in order of registration until a vehicle is unregistered.
+        const VehicleFleetState& GetFleetState() const;
+
+    private:
+        AZStd::shared_ptr<VehicleCommandMailbox> GetOrCreateCommandMailbox(AZ::EntityId entityId);
+        void OnPhysicsSubstep(float fixedDeltaTime) override;
+
+        // Per vehicle, indexed as vehicles of the fleet state
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<DriveModel*> m_driveModels;
+        AZStd::vector<VehicleInputDeadline*> m_inputs;
+        AZStd::vector<AckermannDriveModel*> m_ackermannModels; //!< Null for vehicles without steering elements.
+        AZStd::vector<AZStd::shared_ptr<VehicleCommandMailbox>> m_commandMailboxes;
+        AZStd::unordered_map<AZ::EntityId, size_t> m_indices;
+
+        //! Mailboxes are kept alive by their users, the vehicle and its command sources.
+        AZStd::unordered_map<AZ::EntityId, AZStd::weak_ptr<VehicleCommandMailbox>> m_mailboxesByEntity;
+
+        VehicleFleetState m_fleetState;
+
+        //! Substeps of a frame simulate the time since the previous frame, these track their start times.
+        int64_t m_frameTimeUs = -1;
+        int64_t m_nextSubstepStartUs = 0;
+    };
+
+    using VehicleDynamicsSystemInterface = AZ::Interface<VehicleDynamicsSystem>;
+} // namespace ROS2::VehicleDynamics
@@ -18,14 +18,22 @@ namespace ROS2::VehicleDynamics
     }
 
     template<>
-    AZStd::vector<float>& InputZeroedOnTimeout<AZStd::vector<float>>::Zero(AZStd::vector<float>& input)
+    JointInputs& InputZeroedOnTimeout<JointInputs>::Zero(JointInputs& input)
     {
         AZStd::fill(input.begin(), input.end(), 0);
         return input;
     }
 
-    VehicleInputs VehicleInputDeadline::GetValueCheckingDeadline()
+    const VehicleInputs& VehicleInputDeadline::GetValueCheckingDeadline()
     {
-        return VehicleInputs{ m_speed.GetValue(), m_angularRates.GetValue(), m_jointRequestedPosition.GetValue() };
+        return GetValueCheckingDeadline(static_cast<int64_t>(AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeUs()));
+    }
+
+    const VehicleInputs& VehicleInputDeadline::GetValueCheckingDeadline(int64_t nowUs)
+    {
+        m_latestInputs.m_speed = m_speed.GetValue(nowUs);
+        m_latestInputs.m_angularRates = m_angularRates.GetValue(nowUs);
+        m_latestInputs.m_jointRequestedPosition = m_jointRequestedPosition.GetValue(nowUs);
+        return m_latestInputs;
     }
 } // namespace ROS2::VehicleDynamics
@@ -9,10 +9,16 @@
 
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Time/ITime.h>
-#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/containers/fixed_vector.h>
 
 namespace ROS2::VehicleDynamics
 {
+    //! Maximum number of joint inputs of a vehicle, such as steering angles.
+    constexpr size_t MaxJointInputs = 4;
+
+    //! Joint inputs, stored inline so that updating and copying vehicle inputs does not allocate.
+    using JointInputs = AZStd::fixed_vector<float, MaxJointInputs>;
+
     //! Inputs with an expiration date - effectively is zero after a certain time since update
 
     template<typename T>
@@ -26,15 +32,29 @@ namespace ROS2::VehicleDynamics
 
         void UpdateValue(T updatedInput)
         {
-            m_input = updatedInput;
-            m_lastUpdateUs = GetTimeSinceStartupUs();
+            UpdateValue(AZStd::move(updatedInput), GetTimeSinceStartupUs());
+        }
+
+        //! Update with a value which was received earlier than now.
+        //! @param updateTimeUs time of the update, on the same clock as ITime elapsed time.
+        void UpdateValue(T updatedInput, int64_t updateTimeUs)
+        {
+            m_input = AZStd::move(updatedInput);
+            m_lastUpdateUs = updateTimeUs;
+        }
+
+        const T& GetValue()
+        {
+            return GetValue(GetTimeSinceStartupUs());
         }
 
-        T& GetValue()
+        //! Get the value, zeroed if it was not updated within the timeout.
+        //! @param nowUs current time, on the same clock as ITime elapsed time.
+        const T& GetValue(int64_t nowUs)
         {
-            if (auto timeSinceStartUs = GetTimeSinceStartupUs(); timeSinceStartUs - m_lastUpdateUs > m_timeoutUs)
+            if (nowUs - m_lastUpdateUs > m_timeoutUs)
             {
-                m_input = Zero(m_input);
+                Zero(m_input);
             }
             return m_input;
         }
@@ -56,16 +76,24 @@ namespace ROS2::VehicleDynamics
     {
         AZ::Vector3 m_speed; //!< Linear speed control measured in m/s
         AZ::Vector3 m_angularRates; //!< Angular speed control of vehicle
-        AZStd::vector<float> m_jointRequestedPosition; //!< Steering angle in radians. Negative is right, positive is left,
+        JointInputs m_jointRequestedPosition; //!< Steering angle in radians. Negative is right, positive is left,
     };
 
     struct VehicleInputDeadline
     {
         InputZeroedOnTimeout<AZ::Vector3> m_speed; //!< Linear speed control measured in m/s
         InputZeroedOnTimeout<AZ::Vector3> m_angularRates; //!< Linear speed control measured in m/s
-        InputZeroedOnTimeout<AZStd::vector<float>>
-            m_jointRequestedPosition; //!< Steering angle in radians. Negative is right, positive is left,
-        VehicleInputs GetValueCheckingDeadline();
+        InputZeroedOnTimeout<JointInputs> m_jointRequestedPosition; //!< Steering angle in radians. Negative is right, positive is left,
+
+        //! Get inputs, with values zeroed if not updated within their timeouts.
+        //! @returns reference to inputs, valid until the next call.
+        const VehicleInputs& GetValueCheckingDeadline();
+
+        //! @param nowUs current time, on the same clock as ITime elapsed time.
+        const VehicleInputs& GetValueCheckingDeadline(int64_t nowUs);
+
+    private:
+        VehicleInputs m_latestInputs;
     };
 
 } // namespace ROS2::VehicleDynamics
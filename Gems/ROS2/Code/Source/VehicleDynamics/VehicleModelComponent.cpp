@@ -8,8 +8,8 @@
 
 #include "VehicleModelComponent.h"
 #include "DriveModels/AckermannDriveModel.h"
-#include "Utilities.h"
 #include "VehicleConfiguration.h"
+#include "VehicleDynamicsSystem.h"
 #include "VehicleModelLimits.h"
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -23,12 +23,19 @@ namespace ROS2::VehicleDynamics
     {
         VehicleInputControlRequestBus::Handler::BusConnect(GetEntityId());
         m_manualControlEventHandler.Activate(GetEntityId());
-        AZ::TickBus::Handler::BusConnect();
+        GetDriveModel()->Activate(m_vehicleConfiguration);
+        auto* vehicleDynamicsSystem = VehicleDynamicsSystemInterface::Get();
+        AZ_Assert(vehicleDynamicsSystem, "No vehicle dynamics system");
+        vehicleDynamicsSystem->RegisterVehicle(GetEntityId(), GetDriveModel(), &m_inputsState);
     }
 
     void VehicleModelComponent::Deactivate()
     {
-        AZ::TickBus::Handler::BusDisconnect();
+        if (auto* vehicleDynamicsSystem = VehicleDynamicsSystemInterface::Get())
+        {
+            vehicleDynamicsSystem->UnregisterVehicle(GetEntityId());
+        }
+        GetDriveModel()->Deactivate();
         m_manualControlEventHandler.Deactivate();
         VehicleInputControlRequestBus::Handler::BusDisconnect();
     }
@@ -56,6 +63,11 @@ namespace ROS2::VehicleDynamics
         }
     }
 
+    void VehicleModelComponent::SetVehicleConfiguration(const VehicleConfiguration& vehicleConfiguration)
+    {
+        m_vehicleConfiguration = vehicleConfiguration;
+    }
+
     void VehicleModelComponent::SetTargetLinearSpeed(float speedMpsX)
     {
         m_inputsState.m_speed.UpdateValue({ speedMpsX, 0, 0 });
@@ -111,10 +123,4 @@ namespace ROS2::VehicleDynamics
         const auto& maxState = GetDriveModel()->GetMaximumPossibleInputs();
         m_inputsState.m_angularRates.UpdateValue(maxState.m_angularRates * rateFractionZ);
     };
-
-    void VehicleModelComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
-    {
-        const uint64_t deltaTimeNs = deltaTime * 1'000'000'000;
-        GetDriveModel()->ApplyInputState(m_inputsState.GetValueCheckingDeadline(), deltaTimeNs);
-    }
 } // namespace ROS2::VehicleDynamics
@@ -12,7 +12,6 @@
 #include "VehicleConfiguration.h"
 #include "VehicleInputs.h"
 #include <AzCore/Component/Component.h>
-#include <AzCore/Component/TickBus.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <ROS2/VehicleDynamics/VehicleInputControlBus.h>
 #include <VehicleDynamics/VehicleModelLimits.h>
@@ -20,10 +19,11 @@
 namespace ROS2::VehicleDynamics
 {
     //! A central vehicle (and robot) dynamics component, which can be extended with additional modules.
+    //! The vehicle is registered in the VehicleDynamicsSystem, which advances its drive model on every physics substep
+    //! with the fixed physics delta, using the latest inputs, so vehicle behavior does not depend on the frame rate.
     class VehicleModelComponent
         : public AZ::Component
         , private VehicleInputControlRequestBus::Handler
-        , private AZ::TickBus::Handler
     {
     public:
         AZ_RTTI(VehicleModelComponent, "{7093AE7A-9F64-4C77-8189-02C6B7802C1A}", AZ::Component);
@@ -35,9 +35,10 @@ namespace ROS2::VehicleDynamics
 
         static void Reflect(AZ::ReflectContext* context);
 
-    private:
-        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        //! Sets axles and dimensions of the vehicle. Used by the robot importer, the configuration is read on activation.
+        void SetVehicleConfiguration(const VehicleConfiguration& vehicleConfiguration);
 
+    private:
         // VehicleInputControlRequestBus::Handler overrides
         void SetTargetLinearSpeed(float speedMpsX) override;
         void SetTargetLinearSpeedV3(const AZ::Vector3& speedMps) override;
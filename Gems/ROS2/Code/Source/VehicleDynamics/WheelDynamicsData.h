@@ -18,6 +18,8 @@ namespace ROS2::VehicleDynamics
         AZ::EntityId m_wheelEntity; //!< An entity which is expected to have a WheelControllerComponent.
         AZ::ComponentId m_hingeJoint{ AZ::InvalidComponentId }; //!< Steering joint
         float m_wheelRadius{ 0.25f }; //!< Radius of the wheel in meters.
+        float m_axlePosition{ 0.0f }; //!< Position of the wheel along its axle, from -1 for the first wheel to 1 for the last one.
+        AZ::u32 m_axleIndex{ 0 }; //!< Index of the axle of the wheel in the vehicle configuration, front to rear.
     };
 
     //! Data structure to pass steering dynamics data for a single steering entity.
@@ -26,5 +28,7 @@ namespace ROS2::VehicleDynamics
         AZ::EntityId m_steeringEntity; //!< Steering entity needs to be connected (directly or indirectly) by a Joint with a wheelEntity.
         AZ::ComponentId m_hingeJoint{ AZ::InvalidComponentId }; //!< Steering joint
         float m_steeringScale{ 1.0f }; //!< Scale for direction for the steering element to turn the attached wheel sideways.
+        AZ::u32 m_axleIndex{ 0 }; //!< Index of the axle of the steered wheel in the vehicle configuration, front to rear.
+        float m_axlePosition{ 0.0f }; //!< Position of the steered wheel along its axle, from -1 for the first wheel to 1 for the last one.
     };
 } // namespace ROS2::VehicleDynamics
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "WheelHandleTable.h"
+#include "WheelControllerComponent.h"
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <HingeJointComponent.h>
+
+namespace ROS2::VehicleDynamics
+{
+    namespace Internal
+    {
+        AZ::Entity* FindEntity(const AZ::EntityId& entityId)
+        {
+            AZ::Entity* entity = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationRequests::FindEntity, entityId);
+            return entity;
+        }
+    } // namespace Internal
+
+    void WheelHandleTable::Activate(const VehicleConfiguration& vehicleConfig)
+    {
+        Deactivate();
+
+        for (size_t axleIndex = 0; axleIndex < vehicleConfig.m_axles.size(); ++axleIndex)
+        {
+            const AxleConfiguration& axle = vehicleConfig.m_axles[axleIndex];
+            const size_t wheelCount = axle.m_axleWheels.size();
+            for (size_t wheelIndex = 0; wheelIndex < wheelCount; ++wheelIndex)
+            {
+                const AZ::EntityId& wheel = axle.m_axleWheels[wheelIndex];
+                if (!wheel.IsValid())
+                {
+                    AZ_Warning("WheelHandleTable", false, "Wheel entity in axle %s is invalid, ignoring", axle.m_axleTag.c_str());
+                    continue;
+                }
+
+                const float axlePosition = wheelCount > 1 ? -1.0f + 2.0f * wheelIndex / (wheelCount - 1) : 0.0f;
+                if (axle.m_isDrive)
+                {
+                    AZ_Warning("WheelHandleTable", axle.m_wheelRadius != 0.0f, "Axle %s has zero wheel radius", axle.m_axleTag.c_str());
+                    WheelDynamicsData wheelData;
+                    wheelData.m_wheelEntity = wheel;
+                    wheelData.m_wheelRadius = axle.m_wheelRadius;
+                    wheelData.m_axlePosition = axlePosition;
+                    wheelData.m_axleIndex = aznumeric_cast<AZ::u32>(axleIndex);
+                    m_driveWheels.push_back(wheelData);
+                }
+
+                if (axle.m_isSteering)
+                {
+                    SteeringDynamicsData steeringData;
+                    steeringData.m_axleIndex = aznumeric_cast<AZ::u32>(axleIndex);
+                    steeringData.m_axlePosition = axlePosition;
+                    m_steeringElements.push_back(steeringData);
+                    m_steeringWheels.push_back(wheel);
+                }
+            }
+        }
+
+        // If an entity is already active, OnEntityActivated is called on connection
+        for (const auto& wheelData : m_driveWheels)
+        {
+            AZ::EntityBus::MultiHandler::BusConnect(wheelData.m_wheelEntity);
+        }
+        for (const auto& wheel : m_steeringWheels)
+        {
+            AZ::EntityBus::MultiHandler::BusConnect(wheel);
+        }
+    }
+
+    void WheelHandleTable::Deactivate()
+    {
+        AZ::EntityBus::MultiHandler::BusDisconnect();
+        m_driveWheels.clear();
+        m_steeringElements.clear();
+        m_steeringWheels.clear();
+    }
+
+    const AZStd::vector<WheelDynamicsData>& WheelHandleTable::GetDriveWheels() const
+    {
+        return m_driveWheels;
+    }
+
+    const AZStd::vector<SteeringDynamicsData>& WheelHandleTable::GetSteeringElements() const
+    {
+        return m_steeringElements;
+    }
+
+    void WheelHandleTable::OnEntityActivated(const AZ::EntityId& entityId)
+    {
+        AZ::Entity* entity = Internal::FindEntity(entityId);
+        AZ_Assert(entity, "Activated entity %s not found", entityId.ToString().c_str());
+
+        for (auto& wheelData : m_driveWheels)
+        {
+            if (wheelData.m_wheelEntity != entityId || wheelData.m_hingeJoint != AZ::InvalidComponentId)
+            {
+                continue;
+            }
+            auto* hingeComponent = entity->FindComponent<PhysX::HingeJointComponent>();
+            AZ_Warning(
+                "WheelHandleTable",
+                hingeComponent,
+                "Wheel entity %s is missing a HingeJointComponent component, ignoring",
+                entityId.ToString().c_str());
+            if (hingeComponent)
+            {
+                wheelData.m_hingeJoint = hingeComponent->GetId();
+            }
+        }
+
+        for (size_t i = 0; i < m_steeringElements.size(); ++i)
+        {
+            auto& steeringData = m_steeringElements[i];
+            if (m_steeringWheels[i] == entityId && !steeringData.m_steeringEntity.IsValid())
+            {
+                auto* controllerComponent = entity->FindComponent<WheelControllerComponent>();
+                if (!controllerComponent)
+                {
+                    AZ_Warning(
+                        "WheelHandleTable", false, "Missing a WheelController in wheel entity %s, ignoring", entityId.ToString().c_str());
+                    continue;
+                }
+                if (!controllerComponent->m_steeringEntity.IsValid())
+                {
+                    AZ_Warning(
+                        "WheelHandleTable",
+                        false,
+                        "Steering entity specified for WheelController in entity %s is invalid, ignoring",
+                        entityId.ToString().c_str());
+                    continue;
+                }
+                steeringData.m_steeringEntity = controllerComponent->m_steeringEntity;
+                steeringData.m_steeringScale = controllerComponent->m_steeringScale;
+                if (steeringData.m_steeringEntity != entityId)
+                {
+                    // The steering entity is resolved when it activates, which may be right away
+                    AZ::EntityBus::MultiHandler::BusConnect(steeringData.m_steeringEntity);
+                    continue;
+                }
+            }
+
+            if (steeringData.m_steeringEntity == entityId && steeringData.m_hingeJoint == AZ::InvalidComponentId)
+            {
+                auto* hingeComponent = entity->FindComponent<PhysX::HingeJointComponent>();
+                AZ_Warning(
+                    "WheelHandleTable",
+                    hingeComponent,
+                    "Steering entity %s does not have a HingeJointComponent, ignoring",
+                    entityId.ToString().c_str());
+                if (hingeComponent)
+                {
+                    steeringData.m_hingeJoint = hingeComponent->GetId();
+                }
+            }
+        }
+
+        // Entities are resolved once, a missing component is not expected to appear later
+        AZ::EntityBus::MultiHandler::BusDisconnect(entityId);
+    }
+} // namespace ROS2::VehicleDynamics
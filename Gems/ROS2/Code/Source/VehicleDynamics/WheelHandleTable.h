@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "VehicleConfiguration.h"
+#include "WheelDynamicsData.h"
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace ROS2::VehicleDynamics
+{
+    //! Resolved PhysX hinge joints of all drive wheels and steering elements of a vehicle.
+    //! Entities are resolved once, when they activate; wheels that activate after the vehicle are picked up
+    //! through EntityBus::OnEntityActivated. Drive models read the table on every tick without entity lookups.
+    //! Entries keep the order of the vehicle configuration. An entry whose joint is not resolved (yet) has
+    //! an invalid hinge joint id and should be skipped.
+    class WheelHandleTable : private AZ::EntityBus::MultiHandler
+    {
+    public:
+        //! Start resolving entities of the vehicle. Any previous state is discarded.
+        //! @param vehicleConfig configuration containing axes and wheels information.
+        void Activate(const VehicleConfiguration& vehicleConfig);
+        void Deactivate();
+
+        //! Wheels of drive axles, a wheel entity needs a HingeJointComponent.
+        const AZStd::vector<WheelDynamicsData>& GetDriveWheels() const;
+
+        //! Steering elements of steering axles, a wheel entity needs a WheelControllerComponent with a steering entity,
+        //! and the steering entity needs a HingeJointComponent.
+        const AZStd::vector<SteeringDynamicsData>& GetSteeringElements() const;
+
+    private:
+        // AZ::EntityBus::MultiHandler overrides
+        void OnEntityActivated(const AZ::EntityId& entityId) override;
+
+        AZStd::vector<WheelDynamicsData> m_driveWheels;
+        AZStd::vector<SteeringDynamicsData> m_steeringElements;
+        //! Wheel entity of each steering element, the steering entity is read from its WheelControllerComponent.
+        AZStd::vector<AZ::EntityId> m_steeringWheels;
+    };
+} // namespace ROS2::VehicleDynamics
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+#include <Manipulation/CompiledJointTrajectory.h>
+#include <rclcpp/duration.hpp>
+
+namespace UnitTest
+{
+    namespace
+    {
+        //! Joint state table of joints "a", "b" and "c", with given current positions and velocities.
+        ROS2::JointStateTable CreateJointStates(const AZStd::vector<float>& positions, const AZStd::vector<float>& velocities)
+        {
+            ROS2::JointStateTable jointStates;
+            const char* names[] = { "a", "b", "c" };
+            for (size_t i = 0; i < AZStd::size(names); ++i)
+            {
+                jointStates.m_jointHandles.emplace_back();
+                jointStates.m_jointNames.emplace_back(names[i]);
+                jointStates.m_positions.push_back(positions[i]);
+                jointStates.m_velocities.push_back(velocities[i]);
+                jointStates.m_joints.push_back(nullptr);
+                jointStates.m_jointIndices[jointStates.m_jointNames.back()] = i;
+            }
+            return jointStates;
+        }
+
+        trajectory_msgs::msg::JointTrajectoryPoint CreatePoint(
+            double time,
+            const std::vector<double>& positions,
+            const std::vector<double>& velocities = {},
+            const std::vector<double>& accelerations = {})
+        {
+            trajectory_msgs::msg::JointTrajectoryPoint point;
+            point.time_from_start = rclcpp::Duration::from_seconds(time);
+            point.positions = positions;
+            point.velocities = velocities;
+            point.accelerations = accelerations;
+            return point;
+        }
+
+        struct TrajectorySample
+        {
+            float m_position = 0.0f;
+            float m_velocity = 0.0f;
+        };
+
+        //! Samples the first joint of a trajectory.
+        TrajectorySample SampleFirstJoint(ROS2::CompiledJointTrajectory& compiled, double time)
+        {
+            AZStd::vector<float> positions;
+            AZStd::vector<float> velocities;
+            compiled.Sample(time, positions, velocities);
+            return { positions.front(), velocities.front() };
+        }
+    } // namespace
+
+    class CompiledJointTrajectoryTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            AZ::NameDictionary::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::NameDictionary::Destroy();
+            LeakDetectionFixture::TearDown();
+        }
+    };
+
+    TEST_F(CompiledJointTrajectoryTest, LinearSegmentsPassThroughKnots)
+    {
+        const ROS2::JointStateTable jointStates = CreateJointStates({ -0.1f, 0.0f, 0.2f }, { 0.0f, 0.0f, 0.0f });
+        trajectory_msgs::msg::JointTrajectory trajectory;
+        trajectory.joint_names = { "c", "a" };
+        trajectory.points = { CreatePoint(1.0, { 1.0, 0.0 }), CreatePoint(3.0, { 0.0, 2.0 }) };
+
+        ROS2::CompiledJointTrajectory compiled;
+        ASSERT_TRUE(compiled.Compile(trajectory, jointStates).IsSuccess());
+        EXPECT_EQ(compiled.GetJointCount(), 2u);
+        EXPECT_EQ(compiled.GetJointStateIndices(), AZStd::vector<size_t>({ 2, 0 }));
+        EXPECT_DOUBLE_EQ(compiled.GetDuration(), 3.0);
+
+        // The segment to the first point starts from the current state of the joints
+        const struct
+        {
+            double m_time;
+            float m_positions[2];
+            float m_velocities[2];
+        } expectedSamples[] = {
+            { 0.0, { 0.2f, -0.1f }, { 0.8f, 0.1f } },
+            { 0.5, { 0.6f, -0.05f }, { 0.8f, 0.1f } },
+            { 1.0, { 1.0f, 0.0f }, { -0.5f, 1.0f } },
+            { 2.0, { 0.5f, 1.0f }, { -0.5f, 1.0f } },
+        };
+        AZStd::vector<float> positions;
+        AZStd::vector<float> velocities;
+        for (const auto& expected : expectedSamples)
+        {
+            compiled.Sample(expected.m_time, positions, velocities);
+            ASSERT_EQ(positions.size(), 2u);
+            ASSERT_EQ(velocities.size(), 2u);
+            for (size_t joint = 0; joint < 2; ++joint)
+            {
+                EXPECT_NEAR(positions[joint], expected.m_positions[joint], 1e-5f) << "time " << expected.m_time;
+                EXPECT_NEAR(velocities[joint], expected.m_velocities[joint], 1e-5f) << "time " << expected.m_time;
+            }
+        }
+    }
+
+    TEST_F(CompiledJointTrajectoryTest, CubicSegmentsMatchKnotVelocities)
+    {
+        const ROS2::JointStateTable jointStates = CreateJointStates({ 0.5f, 0.0f, 0.0f }, { -0.25f, 0.0f, 0.0f });
+        trajectory_msgs::msg::JointTrajectory trajectory;
+        trajectory.joint_names = { "a" };
+        trajectory.points = { CreatePoint(1.0, { 1.0 }, { 0.5 }), CreatePoint(2.5, { -1.0 }, { 0.0 }) };
+
+        ROS2::CompiledJointTrajectory compiled;
+        ASSERT_TRUE(compiled.Compile(trajectory, jointStates).IsSuccess());
+
+        const TrajectorySample start = SampleFirstJoint(compiled, 0.0);
+        EXPECT_NEAR(start.m_position, 0.5f, 1e-5f);
+        EXPECT_NEAR(start.m_velocity, -0.25f, 1e-5f);
+
+        const TrajectorySample beforeKnot = SampleFirstJoint(compiled, 1.0 - 1e-6);
+        const TrajectorySample knot = SampleFirstJoint(compiled, 1.0);
+        EXPECT_NEAR(beforeKnot.m_position, 1.0f, 1e-4f);
+        EXPECT_NEAR(beforeKnot.m_velocity, 0.5f, 1e-4f);
+        EXPECT_NEAR(knot.m_position, 1.0f, 1e-5f);
+        EXPECT_NEAR(knot.m_velocity, 0.5f, 1e-5f);
+
+        const TrajectorySample end = SampleFirstJoint(compiled, 2.5 - 1e-6);
+        EXPECT_NEAR(end.m_position, -1.0f, 1e-4f);
+        EXPECT_NEAR(end.m_velocity, 0.0f, 1e-4f);
+    }
+
+    TEST_F(CompiledJointTrajectoryTest, QuinticSegmentsMatchKnotAccelerations)
+    {
+        const ROS2::JointStateTable jointStates = CreateJointStates({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f });
+        trajectory_msgs::msg::JointTrajectory trajectory;
+        trajectory.joint_names = { "b" };
+        trajectory.points = { CreatePoint(1.0, { 1.0 }, { 0.5 }, { -1.0 }), CreatePoint(2.0, { 0.5 }, { 0.0 }, { 0.0 }) };
+
+        ROS2::CompiledJointTrajectory compiled;
+        ASSERT_TRUE(compiled.Compile(trajectory, jointStates).IsSuccess());
+
+        // Accelerations are taken from finite differences of sampled velocities, times do not decrease between samples
+        constexpr double Step = 1e-4;
+        const auto sampleAcceleration = [&compiled](double time)
+        {
+            const float velocity = SampleFirstJoint(compiled, time).m_velocity;
+            return (SampleFirstJoint(compiled, time + Step).m_velocity - velocity) / static_cast<float>(Step);
+        };
+
+        EXPECT_NEAR(sampleAcceleration(0.0), 0.0f, 1e-2f);
+        EXPECT_NEAR(sampleAcceleration(1.0 - Step), -1.0f, 1e-2f);
+        const TrajectorySample knot = SampleFirstJoint(compiled, 1.0);
+        EXPECT_NEAR(knot.m_position, 1.0f, 1e-5f);
+        EXPECT_NEAR(knot.m_velocity, 0.5f, 1e-5f);
+        EXPECT_NEAR(sampleAcceleration(1.0), -1.0f, 1e-2f);
+        EXPECT_NEAR(sampleAcceleration(2.0 - 2 * Step), 0.0f, 1e-2f);
+    }
+
+    TEST_F(CompiledJointTrajectoryTest, SamplingOutsideTimeRangeIsClamped)
+    {
+        const ROS2::JointStateTable jointStates = CreateJointStates({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f });
+        trajectory_msgs::msg::JointTrajectory trajectory;
+        trajectory.joint_names = { "a" };
+        trajectory.points = { CreatePoint(1.0, { 1.0 }, { 1.0 }), CreatePoint(2.0, { 3.0 }, { 1.0 }) };
+
+        ROS2::CompiledJointTrajectory compiled;
+        ASSERT_TRUE(compiled.Compile(trajectory, jointStates).IsSuccess());
+
+        const TrajectorySample beforeStart = SampleFirstJoint(compiled, -1.0);
+        EXPECT_NEAR(beforeStart.m_position, 0.0f, 1e-5f);
+        EXPECT_NEAR(beforeStart.m_velocity, 0.0f, 1e-5f);
+
+        // Past the end the last position is held, and the joint is commanded to stop
+        const TrajectorySample afterEnd = SampleFirstJoint(compiled, 5.0);
+        EXPECT_NEAR(afterEnd.m_position, 3.0f, 1e-5f);
+        EXPECT_EQ(afterEnd.m_velocity, 0.0f);
+    }
+
+    TEST_F(CompiledJointTrajectoryTest, SinglePointAtTimeZeroIsHeld)
+    {
+        const ROS2::JointStateTable jointStates = CreateJointStates({ 0.7f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f });
+        trajectory_msgs::msg::JointTrajectory trajectory;
+        trajectory.joint_names = { "a" };
+        trajectory.points = { CreatePoint(0.0, { -0.3 }) };
+
+        ROS2::CompiledJointTrajectory compiled;
+        ASSERT_TRUE(compiled.Compile(trajectory, jointStates).IsSuccess());
+        EXPECT_DOUBLE_EQ(compiled.GetDuration(), 0.0);
+
+        for (const double time : { 0.0, 0.5, 10.0 })
+        {
+            const TrajectorySample sample = SampleFirstJoint(compiled, time);
+            EXPECT_NEAR(sample.m_position, -0.3f, 1e-5f) << "time " << time;
+            EXPECT_EQ(sample.m_velocity, 0.0f) << "time " << time;
+        }
+    }
+
+    TEST_F(CompiledJointTrajectoryTest, SinglePointStartsFromCurrentState)
+    {
+        const ROS2::JointStateTable jointStates = CreateJointStates({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f });
+        trajectory_msgs::msg::JointTrajectory trajectory;
+        trajectory.joint_names = { "a" };
+        trajectory.points = { CreatePoint(2.0, { 1.0 }, { 0.0 }) };
+
+        ROS2::CompiledJointTrajectory compiled;
+        ASSERT_TRUE(compiled.Compile(trajectory, jointStates).IsSuccess());
+        EXPECT_DOUBLE_EQ(compiled.GetDuration(), 2.0);
+
+        // A cubic rest to rest segment passes the midpoint at half of the distance with 1.5 times the mean velocity
+        const TrajectorySample middle = SampleFirstJoint(compiled, 1.0);
+        EXPECT_NEAR(middle.m_position, 0.5f, 1e-5f);
+        EXPECT_NEAR(middle.m_velocity, 0.75f, 1e-5f);
+        const TrajectorySample end = SampleFirstJoint(compiled, 2.0);
+        EXPECT_NEAR(end.m_position, 1.0f, 1e-5f);
+    }
+
+    TEST_F(CompiledJointTrajectoryTest, InvalidTrajectoriesAreRejected)
+    {
+        const ROS2::JointStateTable jointStates = CreateJointStates({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f });
+        ROS2::CompiledJointTrajectory compiled;
+
+        trajectory_msgs::msg::JointTrajectory unknownJoint;
+        unknownJoint.joint_names = { "d" };
+        unknownJoint.points = { CreatePoint(1.0, { 1.0 }) };
+        EXPECT_FALSE(compiled.Compile(unknownJoint, jointStates).IsSuccess());
+
+        trajectory_msgs::msg::JointTrajectory noPoints;
+        noPoints.joint_names = { "a" };
+        EXPECT_FALSE(compiled.Compile(noPoints, jointStates).IsSuccess());
+
+        trajectory_msgs::msg::JointTrajectory sizeMismatch;
+        sizeMismatch.joint_names = { "a", "b" };
+        sizeMismatch.points = { CreatePoint(1.0, { 1.0 }) };
+        EXPECT_FALSE(compiled.Compile(sizeMismatch, jointStates).IsSuccess());
+
+        trajectory_msgs::msg::JointTrajectory notIncreasing;
+        notIncreasing.joint_names = { "a" };
+        notIncreasing.points = { CreatePoint(1.0, { 1.0 }), CreatePoint(1.0, { 2.0 }) };
+        EXPECT_FALSE(compiled.Compile(notIncreasing, jointStates).IsSuccess());
+    }
+} // namespace UnitTest
@@ -89,4 +89,70 @@ namespace UnitTest
             EXPECT_NEAR(result.GetZ(), goldResult.GetZ(), 1.0f);
         }
     }
+
+    TEST_F(GNSSTest, GeodeticReferenceENUToWGS84)
+    {
+        const AZStd::vector<AZStd::tuple<ROS2::GNSS::Vector3d, ROS2::GNSS::Vector3d, ROS2::GNSS::Vector3d>> inputGoldSet = {
+            { { 12.5, -3.25, 1.5 }, { 50.0, -120.0, -100.0 }, { 49.999970780435, -119.999825649575, -98.499986944720 } },
+            { { 1000.0, 2000.0, 10.0 }, { 10.0, 20.0, 300.0 }, { 10.018080893091, 20.009120872662, 310.393954402767 } },
+            { { 0.001, 0.002, 0.0 }, { 52.2297, 21.0122, 110.0 }, { 52.229700017974, 21.012200014635, 110.000000000931 } },
+        };
+        for (const auto& [input, refWGS84, goldResult] : inputGoldSet)
+        {
+            const ROS2::GNSS::GeodeticReference reference(refWGS84);
+            const ROS2::GNSS::Vector3d result = reference.ENUToWGS84(input);
+            EXPECT_NEAR(result.m_x, goldResult.m_x, 1e-9);
+            EXPECT_NEAR(result.m_y, goldResult.m_y, 1e-9);
+            EXPECT_NEAR(result.m_z, goldResult.m_z, 1e-4);
+        }
+    }
+
+    TEST_F(GNSSTest, GeodeticReferenceRoundTrip)
+    {
+        const ROS2::GNSS::GeodeticReference reference({ 50.0, -120.0, -100.0 });
+        const ROS2::GNSS::Vector3d input = { 12.5, -3.25, 1.5 };
+        const ROS2::GNSS::Vector3d result = reference.ECEFToENU(reference.ENUToECEF(input));
+        EXPECT_NEAR(result.m_x, input.m_x, 1e-6);
+        EXPECT_NEAR(result.m_y, input.m_y, 1e-6);
+        EXPECT_NEAR(result.m_z, input.m_z, 1e-6);
+    }
+
+    TEST_F(GNSSTest, GeodeticReferenceBatchENUToWGS84)
+    {
+        const ROS2::GNSS::GeodeticReference reference({ 52.2297, 21.0122, 110.0 });
+        const AZStd::vector<AZ::Vector3> inputs = { { 0.001f, 0.002f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+        const AZStd::vector<ROS2::GNSS::Vector3d> goldResults = { { 52.229700017974, 21.012200014635, 110.000000000931 },
+                                                                   { 52.2297, 21.0122, 110.0 } };
+        AZStd::vector<ROS2::GNSS::Vector3d> results(inputs.size());
+        reference.ENUToWGS84(
+            AZStd::span<const AZ::Vector3>(inputs.data(), inputs.size()), AZStd::span<ROS2::GNSS::Vector3d>(results.data(), results.size()));
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            EXPECT_NEAR(results[i].m_x, goldResults[i].m_x, 1e-9);
+            EXPECT_NEAR(results[i].m_y, goldResults[i].m_y, 1e-9);
+            EXPECT_NEAR(results[i].m_z, goldResults[i].m_z, 1e-4);
+        }
+    }
+
+    TEST_F(GNSSTest, GeodeticReferenceBatchMatchesSingle)
+    {
+        const ROS2::GNSS::GeodeticReference reference({ 52.2297, 21.0122, 110.0 });
+        AZStd::vector<AZ::Vector3> inputs;
+        for (int i = 0; i < 100; ++i)
+        {
+            inputs.emplace_back(static_cast<float>(i) * 10.0f, static_cast<float>(i) * -7.5f, static_cast<float>(i) * 0.25f);
+        }
+        AZStd::vector<ROS2::GNSS::Vector3d> results(inputs.size());
+        reference.ENUToWGS84(
+            AZStd::span<const AZ::Vector3>(inputs.data(), inputs.size()), AZStd::span<ROS2::GNSS::Vector3d>(results.data(), results.size()));
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            const ROS2::GNSS::Vector3d single = reference.ENUToWGS84({ inputs[i].GetX(), inputs[i].GetY(), inputs[i].GetZ() });
+            EXPECT_DOUBLE_EQ(results[i].m_x, single.m_x);
+            EXPECT_DOUBLE_EQ(results[i].m_y, single.m_y);
+            EXPECT_DOUBLE_EQ(results[i].m_z, single.m_z);
+        }
+    }
 } // namespace UnitTest
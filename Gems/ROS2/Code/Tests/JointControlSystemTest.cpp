@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+#include <Manipulation/JointControlSystem.h>
+#include <ROS2/Utilities/Controllers/PidConfiguration.h>
+
+namespace UnitTest
+{
+    namespace
+    {
+        constexpr AZ::u64 PhysicsSubstepNs = 1'000'000'000ull / 60;
+        constexpr float FeedForwardTimeReference = 0.5f;
+    } // namespace
+
+    class JointControlSystemTest : public LeakDetectionFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            AZ::NameDictionary::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::NameDictionary::Destroy();
+            LeakDetectionFixture::TearDown();
+        }
+    };
+
+    TEST_F(JointControlSystemTest, FeedForwardCorrectsErrorWithinTimeReference)
+    {
+        ROS2::JointPositionController controller(
+            ROS2::JointController::FeedForward, ROS2::Controllers::PidConfiguration(), FeedForwardTimeReference);
+        controller.SetSetpoint(1.0f, 0.2f);
+
+        EXPECT_NEAR(controller.ComputeCommand(0.6f, PhysicsSubstepNs), 0.2f + 0.4f / FeedForwardTimeReference, 1e-5f);
+        EXPECT_NEAR(controller.GetError(), 0.4f, 1e-6f);
+        EXPECT_NEAR(controller.ComputeCommand(1.0f, PhysicsSubstepNs), 0.2f, 1e-5f);
+    }
+
+    //! A manipulator without a goal keeps its joints still where they were, as the keep still controller did.
+    TEST_F(JointControlSystemTest, FeedForwardKeepsStillAtFirstMeasuredPosition)
+    {
+        ROS2::JointPositionController controller(
+            ROS2::JointController::FeedForward, ROS2::Controllers::PidConfiguration(), FeedForwardTimeReference);
+
+        EXPECT_EQ(controller.ComputeCommand(0.3f, PhysicsSubstepNs), 0.0f);
+        EXPECT_FLOAT_EQ(controller.GetSetpoint(), 0.3f);
+        EXPECT_NEAR(controller.ComputeCommand(0.25f, PhysicsSubstepNs), 0.05f / FeedForwardTimeReference, 1e-5f);
+    }
+
+    TEST_F(JointControlSystemTest, HoldPositionCapturesNextMeasurement)
+    {
+        ROS2::JointPositionController controller(
+            ROS2::JointController::FeedForward, ROS2::Controllers::PidConfiguration(), FeedForwardTimeReference);
+        controller.SetSetpoint(1.0f, 0.5f);
+        controller.ComputeCommand(0.9f, PhysicsSubstepNs);
+
+        // The arm stops where it is when a goal ends, the desired velocity of the trajectory does not carry over
+        controller.HoldPosition();
+        EXPECT_EQ(controller.ComputeCommand(0.95f, PhysicsSubstepNs), 0.0f);
+        EXPECT_FLOAT_EQ(controller.GetSetpoint(), 0.95f);
+        EXPECT_NEAR(controller.ComputeCommand(1.0f, PhysicsSubstepNs), -0.05f / FeedForwardTimeReference, 1e-5f);
+    }
+
+    TEST_F(JointControlSystemTest, PidFollowsPositionErrorOnly)
+    {
+        const ROS2::Controllers::PidConfiguration pidConfiguration(2.0, 0.5, 0.1);
+        ROS2::Controllers::PidConfiguration reference = pidConfiguration;
+        reference.InitializePid();
+        ROS2::JointPositionController controller(ROS2::JointController::Pid, pidConfiguration, FeedForwardTimeReference);
+
+        // The desired velocity is not added to the PID output
+        controller.SetSetpoint(1.0f, 3.0f);
+        for (const float position : { 0.0f, 0.1f, 0.3f, 0.6f, 0.8f, 0.9f, 1.05f, 1.0f })
+        {
+            const float expected = static_cast<float>(reference.ComputeCommand(1.0f - position, PhysicsSubstepNs));
+            EXPECT_NEAR(controller.ComputeCommand(position, PhysicsSubstepNs), expected, 1e-5f) << "position " << position;
+            EXPECT_NEAR(controller.GetError(), 1.0f - position, 1e-6f);
+        }
+    }
+
+    //! PID configurations follow joint names, whatever the order of joints in the joint state table.
+    TEST_F(JointControlSystemTest, PidConfigurationsAreMatchedByJointName)
+    {
+        ROS2::JointStateTable jointStates;
+        for (const char* jointName : { "wrist", "shoulder", "elbow" })
+        {
+            jointStates.m_jointIndices[AZ::Name(jointName)] = jointStates.m_jointHandles.size();
+            jointStates.m_jointHandles.emplace_back();
+            jointStates.m_jointNames.emplace_back(jointName);
+            jointStates.m_joints.push_back(nullptr);
+            jointStates.m_positions.push_back(0.0f);
+            jointStates.m_velocities.push_back(0.0f);
+        }
+        const AZStd::unordered_map<AZStd::string, ROS2::Controllers::PidConfiguration> pidConfigurations = {
+            { "shoulder", ROS2::Controllers::PidConfiguration(1.0, 0.0, 0.0) },
+            { "elbow", ROS2::Controllers::PidConfiguration(2.0, 0.0, 0.0) },
+            { "wrist", ROS2::Controllers::PidConfiguration(3.0, 0.0, 0.0) },
+        };
+
+        const auto descriptions =
+            ROS2::DescribeControlledJoints(jointStates, ROS2::JointController::Pid, FeedForwardTimeReference, pidConfigurations);
+        ASSERT_EQ(descriptions.size(), 3u);
+        const double expectedGains[] = { 3.0, 1.0, 2.0 };
+        for (size_t i = 0; i < descriptions.size(); ++i)
+        {
+            EXPECT_EQ(descriptions[i].m_jointStates, &jointStates);
+            EXPECT_EQ(descriptions[i].m_jointStateIndex, i);
+            EXPECT_EQ(descriptions[i].m_controller, ROS2::JointController::Pid);
+
+            // A proportional controller outputs its gain for a unit error
+            ROS2::Controllers::PidConfiguration pid = descriptions[i].m_pid;
+            pid.InitializePid();
+            EXPECT_NEAR(pid.ComputeCommand(1.0, PhysicsSubstepNs), expectedGains[i], 1e-9) << "joint " << i;
+        }
+    }
+} // namespace UnitTest
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+#include <Odometry/OdometrySystem.h>
+
+namespace UnitTest
+{
+    namespace
+    {
+        constexpr float PhysicsSubstep = 1.0f / 60.0f;
+
+        //! Body driving on a circle around the vertical axis, starting at the origin heading along X.
+        struct CircularMotion
+        {
+            float m_speed = 1.5f; //!< [m/s]
+            float m_yawRate = 0.5f; //!< [rad/s]
+
+            AZ::Quaternion GetOrientation(float time) const
+            {
+                return AZ::Quaternion::CreateRotationZ(m_yawRate * time);
+            }
+
+            AZ::Vector3 GetPosition(float time) const
+            {
+                const float radius = m_speed / m_yawRate;
+                const float yaw = m_yawRate * time;
+                return AZ::Vector3(radius * AZStd::sin(yaw), radius * (1.0f - AZStd::cos(yaw)), 0.0f);
+            }
+
+            AZ::Vector3 GetLinearVelocity(float time) const
+            {
+                return GetOrientation(time).TransformVector(AZ::Vector3::CreateAxisX(m_speed));
+            }
+
+            AZ::Vector3 GetAngularVelocity() const
+            {
+                return AZ::Vector3::CreateAxisZ(m_yawRate);
+            }
+        };
+    } // namespace
+
+    class OdometryTest : public LeakDetectionFixture
+    {
+    };
+
+    //! The odometry system has to report what the odometry sensor component reported before: the twist is the body velocity
+    //! transformed by the inverse of the body transform, the pose is the pose of the body, which started at the odometry origin.
+    TEST_F(OdometryTest, MatchesPerComponentComputation)
+    {
+        const CircularMotion motion;
+        ROS2::OdometrySystem::Odometry odometry;
+        const int substeps = 10 * 60;
+        for (int step = 0; step < substeps; ++step)
+        {
+            const float time = step * PhysicsSubstep;
+            const AZ::Quaternion orientation = motion.GetOrientation(time);
+            const AZ::Vector3 linearVelocity = motion.GetLinearVelocity(time);
+            const AZ::Vector3 angularVelocity = motion.GetAngularVelocity();
+            ROS2::OdometrySystem::Integrate(
+                odometry,
+                orientation,
+                linearVelocity,
+                angularVelocity,
+                AZ::Vector3::CreateZero(),
+                AZ::Vector3::CreateZero(),
+                PhysicsSubstep);
+
+            // Per component computation of the twist
+            const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(orientation, motion.GetPosition(time));
+            const AZ::Vector3 expectedLinear = transform.GetInverse().TransformVector(linearVelocity);
+            const AZ::Vector3 expectedAngular = transform.GetInverse().TransformVector(angularVelocity);
+            EXPECT_TRUE(odometry.m_linearVelocity.IsClose(expectedLinear, 1e-4f)) << "step " << step;
+            EXPECT_TRUE(odometry.m_angularVelocity.IsClose(expectedAngular, 1e-4f)) << "step " << step;
+        }
+
+        // The orientation is integrated with the exact angular velocity, the position follows the arc with the error of
+        // a first order integration over the whole run.
+        const float endTime = substeps * PhysicsSubstep;
+        EXPECT_TRUE(odometry.m_orientation.IsClose(motion.GetOrientation(endTime), 1e-3f));
+        EXPECT_TRUE(odometry.m_position.IsClose(motion.GetPosition(endTime), 0.05f));
+        EXPECT_NEAR(odometry.m_position.GetZ(), 0.0f, 1e-4f);
+    }
+
+    TEST_F(OdometryTest, NoiseIsAddedInRobotFrame)
+    {
+        ROS2::OdometrySystem::Odometry odometry;
+        const AZ::Quaternion orientation = AZ::Quaternion::CreateRotationZ(AZ::Constants::HalfPi);
+        const AZ::Vector3 linearNoise(0.1f, 0.0f, 0.0f);
+        const AZ::Vector3 angularNoise(0.0f, 0.0f, 0.2f);
+        ROS2::OdometrySystem::Integrate(
+            odometry, orientation, AZ::Vector3::CreateAxisY(1.0f), AZ::Vector3::CreateZero(), linearNoise, angularNoise, 0.5f);
+
+        EXPECT_TRUE(odometry.m_linearVelocity.IsClose(AZ::Vector3(1.1f, 0.0f, 0.0f), 1e-5f));
+        EXPECT_TRUE(odometry.m_angularVelocity.IsClose(angularNoise, 1e-5f));
+        EXPECT_TRUE(odometry.m_position.IsClose(AZ::Vector3(0.55f, 0.0f, 0.0f), 1e-5f));
+        EXPECT_TRUE(odometry.m_orientation.IsClose(AZ::Quaternion::CreateRotationZ(0.1f), 1e-5f));
+    }
+} // namespace UnitTest
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/string/string.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <RobotImporter/Utils/SourceAssetsStorage.h>
+
+namespace UnitTest
+{
+    class SourceAssetsStorageTest : public LeakDetectionFixture
+    {
+    public:
+        AZStd::string WriteTestFile(const char* name, const AZStd::string& content)
+        {
+            const AZStd::string path = m_tempDirectory.Resolve(name).String();
+            EXPECT_TRUE(AZ::Utils::WriteFile(content, path).IsSuccess());
+            return path;
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(SourceAssetsStorageTest, FileHashCoversWholeContent)
+    {
+        // Binary STL files of different meshes often share the 80 byte header and more
+        const AZStd::string header(4096, 'h');
+        const AZStd::string first = WriteTestFile("first.stl", header + "first mesh");
+        const AZStd::string second = WriteTestFile("second.stl", header + "second mesh");
+        const AZStd::string copy = WriteTestFile("copy.stl", header + "first mesh");
+
+        const AZ::u64 firstHash = ROS2::Utils::GetFileHash(first);
+        EXPECT_NE(firstHash, 0);
+        EXPECT_NE(firstHash, ROS2::Utils::GetFileHash(second));
+        EXPECT_EQ(firstHash, ROS2::Utils::GetFileHash(copy));
+    }
+
+    TEST_F(SourceAssetsStorageTest, FileHashOfLargeFileDependsOnLastChunk)
+    {
+        const AZStd::string content(1024 * 1024, 'a');
+        const AZStd::string first = WriteTestFile("first.dae", content + "a");
+        const AZStd::string second = WriteTestFile("second.dae", content + "b");
+        EXPECT_NE(ROS2::Utils::GetFileHash(first), ROS2::Utils::GetFileHash(second));
+    }
+
+    TEST_F(SourceAssetsStorageTest, FileHashOfMissingFileIsZero)
+    {
+        EXPECT_EQ(ROS2::Utils::GetFileHash(m_tempDirectory.Resolve("missing.obj").String()), 0);
+    }
+} // namespace UnitTest
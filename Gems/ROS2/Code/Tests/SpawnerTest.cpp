@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/std/smart_ptr/make_unique.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
+#include <AzTest/AzTest.h>
+
+#include <Spawner/EntitySpawner.h>
+#include <Spawner/SpawnableInstancePool.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    namespace
+    {
+        //! Application with the spawnable system. Spawned entities are added to the game entity context, which activates the ones
+        //! active by default.
+        class SpawnerEnvironment
+        {
+        public:
+            SpawnerEnvironment()
+            {
+                AZ::ComponentApplication::Descriptor descriptor;
+                AZ::ComponentApplication::StartupParameters startupParameters;
+                startupParameters.m_loadSettingsRegistry = false;
+                m_application.Start(descriptor, startupParameters);
+
+                // The user settings file is shared by all tests, which can run in parallel
+                AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+                m_manager = azrtti_cast<AzFramework::SpawnableEntitiesManager*>(AzFramework::SpawnableEntitiesInterface::Get());
+                AZ_Assert(m_manager, "No spawnable entities manager");
+            }
+
+            ~SpawnerEnvironment()
+            {
+                m_spawnables.clear();
+                m_application.Stop();
+            }
+
+            //! Creates a spawnable of a root entity with children. Each child is offset along X from the root.
+            AZ::Data::Asset<AzFramework::Spawnable> CreateSpawnable(size_t childCount)
+            {
+                auto* spawnable = aznew AzFramework::Spawnable(
+                    AZ::Data::AssetId(AZ::Uuid::CreateRandom()), AZ::Data::AssetData::AssetStatus::Ready);
+                AzFramework::Spawnable::EntityList& entities = spawnable->GetEntities();
+
+                auto root = AZStd::make_unique<AZ::Entity>("root");
+                root->CreateComponent<AzFramework::TransformComponent>();
+                const AZ::EntityId rootId = root->GetId();
+                entities.push_back(AZStd::move(root));
+                for (size_t i = 0; i < childCount; ++i)
+                {
+                    auto child = AZStd::make_unique<AZ::Entity>(AZStd::string::format("child_%zu", i));
+                    auto* transform = child->CreateComponent<AzFramework::TransformComponent>();
+                    transform->SetParentRelative(rootId);
+                    transform->SetLocalTM(AZ::Transform::CreateTranslation(AZ::Vector3::CreateAxisX(static_cast<float>(i + 1))));
+                    entities.push_back(AZStd::move(child));
+                }
+
+                return m_spawnables.emplace_back(spawnable, AZ::Data::AssetLoadBehavior::Default);
+            }
+
+            //! Runs all queued spawn and despawn requests, as the spawnable system does on tick.
+            void ProcessQueue()
+            {
+                constexpr auto priorities = AzFramework::SpawnableEntitiesManager::CommandQueuePriority::High |
+                    AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular;
+                while (m_manager->ProcessQueue(priorities) ==
+                       AzFramework::SpawnableEntitiesManager::CommandQueueStatus::HasCommandsLeft)
+                {
+                }
+            }
+
+        private:
+            AzFramework::Application m_application;
+            AzFramework::SpawnableEntitiesManager* m_manager = nullptr;
+            AZStd::vector<AZ::Data::Asset<AzFramework::Spawnable>> m_spawnables;
+        };
+
+        AZ::Transform GetWorldTM(AZ::EntityId entityId)
+        {
+            AZ::Transform transform = AZ::Transform::CreateIdentity();
+            AZ::TransformBus::EventResult(transform, entityId, &AZ::TransformBus::Events::GetWorldTM);
+            return transform;
+        }
+
+        AZ::Transform GetLocalTM(AZ::EntityId entityId)
+        {
+            AZ::Transform transform = AZ::Transform::CreateIdentity();
+            AZ::TransformBus::EventResult(transform, entityId, &AZ::TransformBus::Events::GetLocalTM);
+            return transform;
+        }
+
+        bool IsActive(AZ::EntityId entityId)
+        {
+            AZ::Entity* entity = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationRequests::FindEntity, entityId);
+            return entity && entity->GetState() == AZ::Entity::State::Active;
+        }
+
+        //! Counts active entities with a name, among all entities of the application.
+        size_t CountActiveEntities(const AZStd::string& name)
+        {
+            size_t count = 0;
+            AZ::ComponentApplicationBus::Broadcast(
+                &AZ::ComponentApplicationRequests::EnumerateEntities,
+                [&count, &name](AZ::Entity* entity)
+                {
+                    if (entity->GetName() == name && entity->GetState() == AZ::Entity::State::Active)
+                    {
+                        ++count;
+                    }
+                });
+            return count;
+        }
+
+        //! Fleet of robots placed in a row along Y.
+        AZStd::vector<ROS2::SpawnEntityDescription> MakeFleet(
+            const AZ::Data::Asset<AzFramework::Spawnable>& spawnable, size_t robotCount)
+        {
+            AZStd::vector<ROS2::SpawnEntityDescription> fleet;
+            fleet.reserve(robotCount);
+            for (size_t i = 0; i < robotCount; ++i)
+            {
+                fleet.push_back({ "robot", spawnable, AZ::Transform::CreateTranslation(AZ::Vector3::CreateAxisY(2.0f * i)) });
+            }
+            return fleet;
+        }
+    } // namespace
+
+    class SpawnerTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_environment = AZStd::make_unique<SpawnerEnvironment>();
+        }
+
+        void TearDown() override
+        {
+            m_environment.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        AZStd::unique_ptr<SpawnerEnvironment> m_environment;
+    };
+
+    TEST_F(SpawnerTest, BatchCompletesOnceAllInstancesExist)
+    {
+        const auto spawnable = m_environment->CreateSpawnable(2);
+        const auto fleet = MakeFleet(spawnable, 3);
+
+        ROS2::EntitySpawner spawner;
+        int callbackCount = 0;
+        AZStd::vector<ROS2::SpawnedInstance> spawned;
+        spawner.SpawnBatch(
+            fleet,
+            [&callbackCount, &spawned](const AZStd::vector<ROS2::SpawnedInstance>& instances)
+            {
+                ++callbackCount;
+                spawned = instances;
+            });
+        EXPECT_EQ(callbackCount, 0);
+        m_environment->ProcessQueue();
+
+        ASSERT_EQ(callbackCount, 1);
+        ASSERT_EQ(spawned.size(), fleet.size());
+        for (size_t i = 0; i < spawned.size(); ++i)
+        {
+            EXPECT_EQ(spawned[i].m_name, AZStd::string::format("robot_%zu", i + 1));
+            ASSERT_EQ(spawned[i].m_entityIds.size(), 3u);
+            EXPECT_TRUE(GetWorldTM(spawned[i].m_entityIds.front()).IsClose(fleet[i].m_transform));
+        }
+
+        EXPECT_TRUE(spawner.Delete("robot_2"));
+        EXPECT_FALSE(spawner.Delete("robot_2"));
+        spawner.Clear();
+        m_environment->ProcessQueue();
+    }
+
+    TEST_F(SpawnerTest, PrefilledInstancesStayInactiveUntilAcquired)
+    {
+        ROS2::SpawnableInstancePool pool;
+        pool.Fill("robot", m_environment->CreateSpawnable(1), 2);
+        m_environment->ProcessQueue();
+
+        EXPECT_EQ(pool.GetAvailableCount("robot"), 2u);
+        EXPECT_EQ(CountActiveEntities("root"), 0u);
+
+        const auto* entityIds = pool.Acquire("robot", AZ::Transform::CreateIdentity(), "robot_1");
+        ASSERT_NE(entityIds, nullptr);
+        EXPECT_EQ(pool.GetAvailableCount("robot"), 1u);
+        EXPECT_EQ(CountActiveEntities("root"), 1u);
+        for (const AZ::EntityId& entityId : *entityIds)
+        {
+            EXPECT_TRUE(IsActive(entityId));
+        }
+        pool.Clear();
+        m_environment->ProcessQueue();
+    }
+
+    TEST_F(SpawnerTest, ReacquiredInstanceRestoresSpawnedLocalTransforms)
+    {
+        ROS2::SpawnableInstancePool pool;
+        pool.Fill("robot", m_environment->CreateSpawnable(2), 1);
+        m_environment->ProcessQueue();
+
+        const AZ::Transform firstPose = AZ::Transform::CreateTranslation(AZ::Vector3(1.0f, 2.0f, 0.0f));
+        const auto* firstEntityIds = pool.Acquire("robot", firstPose, "robot_1");
+        ASSERT_NE(firstEntityIds, nullptr);
+        const AZStd::vector<AZ::EntityId> entityIds = *firstEntityIds;
+        ASSERT_EQ(entityIds.size(), 3u);
+        EXPECT_TRUE(GetWorldTM(entityIds[0]).IsClose(firstPose));
+
+        // The robot is driven around and its parts are moved, as physics moves simulated links
+        const AZ::Transform movedLink = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(1.0f), AZ::Vector3(0.0f, 3.0f, 1.0f));
+        AZ::TransformBus::Event(entityIds[0], &AZ::TransformBus::Events::SetWorldTM, AZ::Transform::CreateTranslation(AZ::Vector3(9.0f)));
+        AZ::TransformBus::Event(entityIds[1], &AZ::TransformBus::Events::SetLocalTM, movedLink);
+        AZ::TransformBus::Event(entityIds[2], &AZ::TransformBus::Events::SetLocalTM, movedLink);
+
+        ASSERT_TRUE(pool.Release("robot_1"));
+        EXPECT_FALSE(pool.Release("robot_1"));
+        for (const AZ::EntityId& entityId : entityIds)
+        {
+            EXPECT_FALSE(IsActive(entityId));
+        }
+
+        const AZ::Transform secondPose = AZ::Transform::CreateTranslation(AZ::Vector3(-4.0f, 0.0f, 0.0f));
+        const auto* secondEntityIds = pool.Acquire("robot", secondPose, "robot_2");
+        ASSERT_NE(secondEntityIds, nullptr);
+        EXPECT_EQ(*secondEntityIds, entityIds);
+        EXPECT_TRUE(GetWorldTM(entityIds[0]).IsClose(secondPose));
+        for (size_t child = 1; child < entityIds.size(); ++child)
+        {
+            const AZ::Transform spawnedLocal = AZ::Transform::CreateTranslation(AZ::Vector3::CreateAxisX(static_cast<float>(child)));
+            EXPECT_TRUE(GetLocalTM(entityIds[child]).IsClose(spawnedLocal)) << "child " << child;
+            EXPECT_TRUE(GetWorldTM(entityIds[child]).IsClose(secondPose * spawnedLocal)) << "child " << child;
+        }
+        pool.Clear();
+        m_environment->ProcessQueue();
+    }
+
+    TEST_F(SpawnerTest, BatchTakesPooledInstancesFirst)
+    {
+        const auto spawnable = m_environment->CreateSpawnable(1);
+        ROS2::EntitySpawner spawner;
+        spawner.GetInstancePool().Fill("robot", spawnable, 2);
+        m_environment->ProcessQueue();
+
+        int callbackCount = 0;
+        spawner.SpawnBatch(
+            MakeFleet(spawnable, 3),
+            [&callbackCount]([[maybe_unused]] const AZStd::vector<ROS2::SpawnedInstance>& instances)
+            {
+                ++callbackCount;
+            });
+
+        // Pooled instances are taken at once, the third instance is spawned from the asset
+        EXPECT_EQ(spawner.GetInstancePool().GetAvailableCount("robot"), 0u);
+        EXPECT_EQ(callbackCount, 0);
+        m_environment->ProcessQueue();
+        EXPECT_EQ(callbackCount, 1);
+
+        EXPECT_TRUE(spawner.Delete("robot_1"));
+        EXPECT_TRUE(spawner.Delete("robot_3"));
+        EXPECT_EQ(spawner.GetInstancePool().GetAvailableCount("robot"), 1u);
+        spawner.Clear();
+        m_environment->ProcessQueue();
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Time to fleet ready: from queuing a batch of robots until all of them exist, for fleets of 1, 10 and 100 robots.
+    static void BM_SpawnFleet(benchmark::State& state)
+    {
+        SpawnerEnvironment environment;
+        const auto fleet = MakeFleet(environment.CreateSpawnable(8), aznumeric_cast<size_t>(state.range(0)));
+
+        ROS2::EntitySpawner spawner;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            bool fleetReady = false;
+            spawner.SpawnBatch(
+                fleet,
+                [&fleetReady]([[maybe_unused]] const AZStd::vector<ROS2::SpawnedInstance>& instances)
+                {
+                    fleetReady = true;
+                });
+            environment.ProcessQueue();
+            benchmark::DoNotOptimize(fleetReady);
+
+            state.PauseTiming();
+            spawner.Clear();
+            environment.ProcessQueue();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_SpawnFleet)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+    //! Time to fleet ready when all robots are taken from the instance pool, to compare with spawning from the asset.
+    static void BM_RespawnFleetFromPool(benchmark::State& state)
+    {
+        SpawnerEnvironment environment;
+        const size_t robotCount = aznumeric_cast<size_t>(state.range(0));
+        const auto spawnable = environment.CreateSpawnable(8);
+        const auto fleet = MakeFleet(spawnable, robotCount);
+
+        ROS2::EntitySpawner spawner;
+        spawner.GetInstancePool().Fill("robot", spawnable, robotCount);
+        environment.ProcessQueue();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<AZStd::string> names;
+            spawner.SpawnBatch(
+                fleet,
+                [&names](const AZStd::vector<ROS2::SpawnedInstance>& instances)
+                {
+                    for (const auto& instance : instances)
+                    {
+                        names.push_back(instance.m_name);
+                    }
+                });
+            environment.ProcessQueue();
+            benchmark::DoNotOptimize(names.data());
+
+            state.PauseTiming();
+            for (const auto& name : names)
+            {
+                spawner.Delete(name);
+            }
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        spawner.Clear();
+        environment.ProcessQueue();
+    }
+    BENCHMARK(BM_RespawnFleetFromPool)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+#endif
+} // namespace UnitTest
@@ -6,15 +6,52 @@
  *
  */
 
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzCore/std/string/string.h>
 #include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
 #include <RobotImporter/URDF/UrdfParser.h>
+#include <RobotImporter/URDF/VehicleModelMaker.h>
 #include <RobotImporter/Utils/RobotImporterUtils.h>
+#include <RobotImporter/xacro/XacroEvaluator.h>
 #include <RobotImporter/xacro/XacroUtils.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 namespace UnitTest
 {
+    namespace
+    {
+        //! Makes a robot description with links connected by revolute joints, link i > 0 is a child of link (i - 1) / branching.
+        //! A branching of 1 makes a chain of links, a larger one makes a wide tree.
+        AZStd::string MakeSyntheticURDF(size_t linkCount, size_t branching)
+        {
+            AZStd::string xmlStr = "<?xml version=\"1.0\"?>\n<robot name=\"synthetic\">\n";
+            for (size_t i = 0; i < linkCount; ++i)
+            {
+                xmlStr += AZStd::string::format("<link name=\"link%zu\"/>\n", i);
+            }
+            for (size_t i = 1; i < linkCount; ++i)
+            {
+                xmlStr += AZStd::string::format(
+                    "<joint name=\"joint%zu\" type=\"revolute\">\n"
+                    "  <parent link=\"link%zu\"/>\n"
+                    "  <child link=\"link%zu\"/>\n"
+                    "  <origin rpy=\"0.1 0.0 0.2\" xyz=\"0.5 0.0 0.1\"/>\n"
+                    "  <limit lower=\"-1.0\" upper=\"1.0\" effort=\"10.0\" velocity=\"1.0\"/>\n"
+                    "</joint>\n",
+                    i,
+                    (i - 1) / branching,
+                    i);
+            }
+            xmlStr += "</robot>\n";
+            return xmlStr;
+        }
+    } // namespace
 
     class UrdfParserTest : public LeakDetectionFixture
     {
@@ -304,6 +341,22 @@ namespace UnitTest
         EXPECT_EQ(joint12->limits->velocity, 10.0);
     }
 
+    TEST_F(UrdfParserTest, ParseUrdfFromFile)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string xmlStr = GetUrdfWithTwoLinksAndJoint();
+        const AZStd::string path = tempDirectory.Resolve("robot.urdf").String();
+        ASSERT_TRUE(AZ::Utils::WriteFile(xmlStr, path).IsSuccess());
+
+        const auto urdf = ROS2::UrdfParser::ParseFromFile(path);
+        ASSERT_TRUE(urdf);
+        EXPECT_EQ(urdf->getName(), "test_two_links_one_joint");
+        EXPECT_TRUE(urdf->getJoint("joint12"));
+
+        const AZStd::string log = ROS2::UrdfParser::GetUrdfParsingLog();
+        EXPECT_NE(log.find(AZStd::string::format("Parsed %zu bytes in", xmlStr.size())), AZStd::string::npos);
+    }
+
     TEST_F(UrdfParserTest, WheelHeuristicNameValid)
     {
         const AZStd::string wheel_name("wheel_left_link");
@@ -354,6 +407,60 @@ namespace UnitTest
         EXPECT_EQ(ROS2::Utils::IsWheelURDFHeuristics(wheel_candidate), false);
     }
 
+    TEST_F(UrdfParserTest, MecanumWheelHeuristicNameValid)
+    {
+        const AZStd::string wheel_name("mecanum_wheel_front_left_link");
+        const auto xmlStr = GetURDFWithWheel(wheel_name, "continuous");
+        const auto urdf = ROS2::UrdfParser::Parse(xmlStr);
+        auto wheel_candidate = urdf->getLink(wheel_name.c_str());
+        ASSERT_TRUE(wheel_candidate);
+        EXPECT_EQ(ROS2::Utils::IsMecanumWheelURDFHeuristics(wheel_candidate), true);
+    }
+
+    TEST_F(UrdfParserTest, MecanumWheelHeuristicNameNotValid)
+    {
+        const AZStd::string wheel_name("wheel_left_link");
+        const auto xmlStr = GetURDFWithWheel(wheel_name, "continuous");
+        const auto urdf = ROS2::UrdfParser::Parse(xmlStr);
+        auto wheel_candidate = urdf->getLink(wheel_name.c_str());
+        ASSERT_TRUE(wheel_candidate);
+        EXPECT_EQ(ROS2::Utils::IsMecanumWheelURDFHeuristics(wheel_candidate), false);
+    }
+
+    TEST_F(UrdfParserTest, MecanumWheelsMakeAxlesFrontToRear)
+    {
+        // Four wheels in any order, the front right one slightly offset along the robot
+        const AZStd::vector<ROS2::VehicleModelMaker::Wheel> wheels{
+            { AZ::EntityId(1), AZ::Vector3(-0.3f, 0.25f, 0.05f), 0.1f },
+            { AZ::EntityId(2), AZ::Vector3(0.31f, -0.25f, 0.05f), 0.1f },
+            { AZ::EntityId(3), AZ::Vector3(0.3f, 0.25f, 0.05f), 0.1f },
+            { AZ::EntityId(4), AZ::Vector3(-0.3f, -0.25f, 0.05f), 0.1f },
+        };
+        const auto configuration = ROS2::VehicleModelMaker::MakeVehicleConfiguration(wheels);
+
+        ASSERT_EQ(configuration.m_axles.size(), 2u);
+        const auto& front = configuration.m_axles[0];
+        const auto& rear = configuration.m_axles[1];
+        EXPECT_EQ(front.m_axleWheels, AZStd::vector<AZ::EntityId>({ AZ::EntityId(3), AZ::EntityId(2) }));
+        EXPECT_EQ(rear.m_axleWheels, AZStd::vector<AZ::EntityId>({ AZ::EntityId(1), AZ::EntityId(4) }));
+        EXPECT_TRUE(front.m_isDrive && rear.m_isDrive);
+        EXPECT_FALSE(front.m_isSteering || rear.m_isSteering);
+        EXPECT_FLOAT_EQ(front.m_wheelRadius, 0.1f);
+        EXPECT_NEAR(configuration.m_wheelbase, 0.61f, 1e-6f);
+        EXPECT_NEAR(configuration.m_track, 0.5f, 1e-6f);
+    }
+
+    TEST_F(UrdfParserTest, SingleAxleOfMecanumWheels)
+    {
+        const AZStd::vector<ROS2::VehicleModelMaker::Wheel> wheels{
+            { AZ::EntityId(1), AZ::Vector3(0.0f, -0.2f, 0.0f), 0.1f },
+            { AZ::EntityId(2), AZ::Vector3(0.0f, 0.2f, 0.0f), 0.1f },
+        };
+        const auto configuration = ROS2::VehicleModelMaker::MakeVehicleConfiguration(wheels);
+        ASSERT_EQ(configuration.m_axles.size(), 1u);
+        EXPECT_EQ(configuration.m_axles[0].m_axleWheels, AZStd::vector<AZ::EntityId>({ AZ::EntityId(2), AZ::EntityId(1) }));
+    }
+
     TEST_F(UrdfParserTest, TestLinkListing)
     {
         const auto xmlStr = GetURDFWithTranforms();
@@ -406,6 +513,88 @@ namespace UnitTest
         EXPECT_NEAR(expected_translation_link3.GetZ(), transform_from_urdf_link3.GetTranslation().GetZ(), 1e-5);
     }
 
+    TEST_F(UrdfParserTest, TestFlattenLinks)
+    {
+        const auto xmlStr = GetURDFWithTranforms();
+        const auto urdf = ROS2::UrdfParser::Parse(xmlStr);
+        const auto table = ROS2::Utils::FlattenLinks(urdf->root_link_);
+        ASSERT_EQ(table.size(), 4);
+        EXPECT_EQ(table.front().m_link, urdf->root_link_);
+        EXPECT_EQ(table.front().m_parentIndex, ROS2::Utils::InvalidLinkIndex);
+        for (size_t i = 1; i < table.size(); ++i)
+        {
+            const auto& entry = table[i];
+            ASSERT_LT(entry.m_parentIndex, i);
+            EXPECT_EQ(table[entry.m_parentIndex].m_link, entry.m_link->getParent());
+            const AZ::Transform expectedTransform = ROS2::Utils::GetWorldTransformURDF(entry.m_link);
+            EXPECT_TRUE(entry.m_worldTransform.IsClose(expectedTransform, 1e-5f));
+        }
+    }
+
+    TEST_F(UrdfParserTest, TestLinkTransformCache)
+    {
+        const auto xmlStr = GetURDFWithTranforms();
+        const auto urdf = ROS2::UrdfParser::Parse(xmlStr);
+        const ROS2::Utils::LinkTransformCache transformCache(urdf->root_link_);
+        ASSERT_EQ(transformCache.GetLinks().size(), 4);
+        for (const auto& [name, link] : ROS2::Utils::GetAllLinks(urdf->getRoot()->child_links))
+        {
+            EXPECT_TRUE(transformCache.GetWorldTransform(name).IsClose(ROS2::Utils::GetWorldTransformURDF(link), 1e-5f));
+            EXPECT_TRUE(transformCache.GetWorldTransform(link).IsClose(ROS2::Utils::GetWorldTransformURDF(link), 1e-5f));
+        }
+        EXPECT_TRUE(transformCache.GetWorldTransform("base_link").IsClose(AZ::Transform::Identity()));
+        EXPECT_TRUE(transformCache.GetWorldTransform("no_such_link").IsClose(AZ::Transform::Identity()));
+        EXPECT_EQ(transformCache.GetLinkIndex("no_such_link"), ROS2::Utils::InvalidLinkIndex);
+    }
+
+    TEST_F(UrdfParserTest, TestLinkTransformCacheOfLongChain)
+    {
+        const auto urdf = ROS2::UrdfParser::Parse(MakeSyntheticURDF(200, 1));
+        ASSERT_TRUE(urdf);
+        const ROS2::Utils::LinkTransformCache transformCache(urdf->root_link_);
+        ASSERT_EQ(transformCache.GetLinks().size(), 200);
+        const auto lastLink = urdf->links_.at("link199");
+        EXPECT_TRUE(transformCache.GetWorldTransform("link199").IsClose(ROS2::Utils::GetWorldTransformURDF(lastLink), 1e-3f));
+    }
+
+    TEST_F(UrdfParserTest, TestFixedJointBodies)
+    {
+        const auto urdf = ROS2::UrdfParser::Parse(GetURDFWithTranforms());
+        const auto table = ROS2::Utils::FlattenLinks(urdf->root_link_);
+        const auto bodies = ROS2::Utils::GetFixedJointBodies(table);
+        ASSERT_EQ(bodies.size(), table.size());
+        for (size_t i = 0; i < table.size(); ++i)
+        {
+            // Only link1 is attached by a fixed joint, to the root link
+            const bool isMerged = table[i].m_link->name == "link1";
+            EXPECT_EQ(bodies[i], isMerged ? 0 : i);
+        }
+    }
+
+    TEST_F(UrdfParserTest, TestCombineInertials)
+    {
+        const auto urdf = ROS2::UrdfParser::Parse(GetUrdfWithTwoLinksAndJoint());
+        const ROS2::Utils::LinkTransformCache transformCache(urdf->root_link_);
+        const auto link1 = urdf->getLink("link1");
+        const auto link2 = urdf->getLink("link2");
+        const auto combined = ROS2::Utils::CombineInertials(
+            { { link1->inertial, AZ::Transform::CreateIdentity() }, { link2->inertial, transformCache.GetWorldTransform(link2) } });
+        ASSERT_TRUE(combined);
+        EXPECT_NEAR(combined->mass, 2.0, 1e-5);
+        EXPECT_NEAR(combined->origin.position.x, 0.5, 1e-5);
+        EXPECT_NEAR(combined->origin.position.y, 0.25, 1e-5);
+        EXPECT_NEAR(combined->origin.position.z, 0.0, 1e-5);
+        // Unit tensors of both links moved by (0.5, 0.25, 0) from the center of mass
+        EXPECT_NEAR(combined->ixx, 2.125, 1e-5);
+        EXPECT_NEAR(combined->iyy, 2.5, 1e-5);
+        EXPECT_NEAR(combined->izz, 2.625, 1e-5);
+        EXPECT_NEAR(combined->ixy, -0.25, 1e-5);
+        EXPECT_NEAR(combined->ixz, 0.0, 1e-5);
+        EXPECT_NEAR(combined->iyz, 0.0, 1e-5);
+
+        EXPECT_FALSE(ROS2::Utils::CombineInertials({ { nullptr, AZ::Transform::CreateIdentity() } }));
+    }
+
     TEST_F(UrdfParserTest, TestPathResolvementGlobal)
     {
         AZStd::string dae = "file:///home/foo/ros_ws/install/foo_robot/meshes/bar.dae";
@@ -456,4 +645,226 @@ namespace UnitTest
         EXPECT_EQ(params["laser_enabled"], "false");
     }
 
+    TEST_F(UrdfParserTest, XacroExpandInProcess)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string wheelPath = tempDirectory.Resolve("wheel.xacro").String();
+        const AZStd::string robotPath = tempDirectory.Resolve("robot.xacro").String();
+        const AZStd::string wheel = "<robot xmlns:xacro=\"http://ros.org/wiki/xacro\">\n"
+                                    "  <xacro:macro name=\"wheel\" params=\"prefix radius:=0.1 *origin\">\n"
+                                    "    <link name=\"${prefix}_wheel\">\n"
+                                    "      <visual>\n"
+                                    "        <geometry><cylinder radius=\"${radius}\" length=\"${radius / 2}\"/></geometry>\n"
+                                    "      </visual>\n"
+                                    "    </link>\n"
+                                    "    <joint name=\"${prefix}_joint\" type=\"continuous\">\n"
+                                    "      <parent link=\"base_link\"/>\n"
+                                    "      <child link=\"${prefix}_wheel\"/>\n"
+                                    "      <xacro:insert_block name=\"origin\"/>\n"
+                                    "    </joint>\n"
+                                    "  </xacro:macro>\n"
+                                    "</robot>";
+        const AZStd::string robot = "<robot name=\"test\" xmlns:xacro=\"http://ros.org/wiki/xacro\">\n"
+                                    "  <xacro:arg name=\"laser_enabled\" default=\"false\"/>\n"
+                                    "  <xacro:include filename=\"wheel.xacro\"/>\n"
+                                    "  <xacro:property name=\"base_width\" value=\"0.5\"/>\n"
+                                    "  <link name=\"base_link\"/>\n"
+                                    "  <xacro:wheel prefix=\"left\">\n"
+                                    "    <origin xyz=\"0 ${base_width / 2} 0\" rpy=\"${-pi / 2} 0 0\"/>\n"
+                                    "  </xacro:wheel>\n"
+                                    "  <xacro:wheel prefix=\"right\" radius=\"${0.1 * 2}\">\n"
+                                    "    <origin xyz=\"0 ${-base_width / 2} 0\" rpy=\"0 0 0\"/>\n"
+                                    "  </xacro:wheel>\n"
+                                    "  <xacro:if value=\"$(arg laser_enabled)\"><link name=\"laser\"/></xacro:if>\n"
+                                    "  <xacro:unless value=\"${base_width > 1}\"><link name=\"small_base\"/></xacro:unless>\n"
+                                    "</robot>";
+        ASSERT_TRUE(AZ::Utils::WriteFile(wheel, wheelPath).IsSuccess());
+        ASSERT_TRUE(AZ::Utils::WriteFile(robot, robotPath).IsSuccess());
+
+        ROS2::Utils::xacro::ExpansionInputs inputs;
+        const auto expansion = ROS2::Utils::xacro::ExpandXacro(robotPath, { { "laser_enabled", "true" } }, inputs);
+        ASSERT_TRUE(expansion.IsSuccess()) << expansion.GetError().c_str();
+        EXPECT_EQ(inputs.m_readFiles.size(), 2);
+        const AZStd::string& urdfText = expansion.GetValue();
+        EXPECT_NE(urdfText.find("xyz=\"0 0.25 0\""), AZStd::string::npos);
+        EXPECT_NE(urdfText.find("xyz=\"0 -0.25 0\""), AZStd::string::npos);
+        EXPECT_NE(urdfText.find("rpy=\"-1.5707963267948966 0 0\""), AZStd::string::npos);
+        EXPECT_NE(urdfText.find("radius=\"0.2\" length=\"0.1\""), AZStd::string::npos);
+        EXPECT_EQ(urdfText.find("xacro"), AZStd::string::npos);
+
+        const auto urdf = ROS2::UrdfParser::Parse(urdfText);
+        ASSERT_TRUE(urdf);
+        EXPECT_EQ(urdf->links_.size(), 5);
+        EXPECT_TRUE(urdf->getLink("laser"));
+        EXPECT_TRUE(urdf->getLink("small_base"));
+        ASSERT_TRUE(urdf->getJoint("left_joint"));
+        EXPECT_EQ(urdf->getJoint("left_joint")->parent_to_joint_origin_transform.position.y, 0.25);
+    }
+
+    TEST_F(UrdfParserTest, XacroExpandFailsOnUnsupportedConstructs)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string robotPath = tempDirectory.Resolve("robot.xacro").String();
+        const AZStd::string robot = "<robot name=\"test\" xmlns:xacro=\"http://ros.org/wiki/xacro\">\n"
+                                    "  <xacro:element xacro:name=\"link\" name=\"base_link\"/>\n"
+                                    "</robot>";
+        ASSERT_TRUE(AZ::Utils::WriteFile(robot, robotPath).IsSuccess());
+
+        ROS2::Utils::xacro::ExpansionInputs inputs;
+        const auto expansion = ROS2::Utils::xacro::ExpandXacro(robotPath, {}, inputs);
+        ASSERT_FALSE(expansion.IsSuccess());
+        EXPECT_NE(expansion.GetError().find("xacro:element"), AZStd::string::npos);
+    }
+
+    TEST_F(UrdfParserTest, XacroExpandFailsOnSelfInclude)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string robotPath = tempDirectory.Resolve("robot.xacro").String();
+        const AZStd::string robot = "<robot name=\"test\" xmlns:xacro=\"http://ros.org/wiki/xacro\">\n"
+                                    "  <xacro:include filename=\"robot.xacro\"/>\n"
+                                    "  <link name=\"base_link\"/>\n"
+                                    "</robot>";
+        ASSERT_TRUE(AZ::Utils::WriteFile(robot, robotPath).IsSuccess());
+
+        ROS2::Utils::xacro::ExpansionInputs inputs;
+        const auto expansion = ROS2::Utils::xacro::ExpandXacro(robotPath, {}, inputs);
+        ASSERT_FALSE(expansion.IsSuccess());
+        EXPECT_NE(expansion.GetError().find("include cycle"), AZStd::string::npos);
+        EXPECT_NE(expansion.GetError().find("robot.xacro"), AZStd::string::npos);
+    }
+
+    TEST_F(UrdfParserTest, XacroExpandFailsOnIncludeCycle)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string robotPath = tempDirectory.Resolve("robot.xacro").String();
+        const AZStd::string partPath = tempDirectory.Resolve("part.xacro").String();
+        const AZStd::string robot = "<robot name=\"test\" xmlns:xacro=\"http://ros.org/wiki/xacro\">\n"
+                                    "  <xacro:include filename=\"part.xacro\"/>\n"
+                                    "  <xacro:include filename=\"part.xacro\"/>\n"
+                                    "</robot>";
+        const AZStd::string part = "<robot xmlns:xacro=\"http://ros.org/wiki/xacro\">\n"
+                                   "  <xacro:include filename=\"robot.xacro\"/>\n"
+                                   "</robot>";
+        ASSERT_TRUE(AZ::Utils::WriteFile(robot, robotPath).IsSuccess());
+        ASSERT_TRUE(AZ::Utils::WriteFile(part, partPath).IsSuccess());
+
+        ROS2::Utils::xacro::ExpansionInputs inputs;
+        const auto expansion = ROS2::Utils::xacro::ExpandXacro(robotPath, {}, inputs);
+        ASSERT_FALSE(expansion.IsSuccess());
+        const AZStd::string& error = expansion.GetError();
+        EXPECT_NE(error.find("include cycle"), AZStd::string::npos);
+        EXPECT_NE(error.find("part.xacro ->"), AZStd::string::npos);
+    }
+
+    TEST_F(UrdfParserTest, XacroIncludesSameFileTwice)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string robotPath = tempDirectory.Resolve("robot.xacro").String();
+        const AZStd::string partPath = tempDirectory.Resolve("part.xacro").String();
+        const AZStd::string robot = "<robot name=\"test\" xmlns:xacro=\"http://ros.org/wiki/xacro\">\n"
+                                    "  <xacro:include filename=\"part.xacro\"/>\n"
+                                    "  <xacro:include filename=\"part.xacro\"/>\n"
+                                    "  <link name=\"base_link\"/>\n"
+                                    "</robot>";
+        const AZStd::string part = "<robot xmlns:xacro=\"http://ros.org/wiki/xacro\">\n"
+                                   "  <xacro:property name=\"width\" value=\"0.5\"/>\n"
+                                   "</robot>";
+        ASSERT_TRUE(AZ::Utils::WriteFile(robot, robotPath).IsSuccess());
+        ASSERT_TRUE(AZ::Utils::WriteFile(part, partPath).IsSuccess());
+
+        ROS2::Utils::xacro::ExpansionInputs inputs;
+        const auto expansion = ROS2::Utils::xacro::ExpandXacro(robotPath, {}, inputs);
+        EXPECT_TRUE(expansion.IsSuccess()) << (expansion.IsSuccess() ? "" : expansion.GetError().c_str());
+    }
+
+    TEST_F(UrdfParserTest, XacroExpansionCacheTracksReadFiles)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string robotPath = tempDirectory.Resolve("robot.xacro").String();
+        const AZStd::string includedPath = tempDirectory.Resolve("included.xacro").String();
+        ASSERT_TRUE(AZ::Utils::WriteFile(AZStd::string("<robot/>"), robotPath).IsSuccess());
+        ASSERT_TRUE(AZ::Utils::WriteFile(AZStd::string("<robot/>"), includedPath).IsSuccess());
+
+        ROS2::Utils::xacro::ExpansionCache cache;
+        const ROS2::Utils::xacro::Params params{ { "a", "1" }, { "b", "2" } };
+        ROS2::Utils::xacro::ExpansionInputs inputs;
+        inputs.m_readFiles = { robotPath, includedPath };
+        cache.Store(robotPath, params, "expanded", inputs);
+        EXPECT_EQ(cache.Find(robotPath, params), AZStd::optional<AZStd::string>("expanded"));
+        EXPECT_FALSE(cache.Find(robotPath, { { "a", "1" } }));
+
+        ASSERT_TRUE(AZ::Utils::WriteFile(AZStd::string("<robot name=\"changed\"/>"), includedPath).IsSuccess());
+        EXPECT_FALSE(cache.Find(robotPath, params));
+    }
+
+    TEST_F(UrdfParserTest, XacroExpansionCacheTracksEnvironmentAndPackages)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string robotPath = tempDirectory.Resolve("robot.xacro").String();
+        const AZStd::string robot = "<robot name=\"test\" xmlns:xacro=\"http://ros.org/wiki/xacro\">\n"
+                                    "  <link name=\"$(optenv ROS2_XACRO_TEST_UNSET_VARIABLE base_link)\"/>\n"
+                                    "</robot>";
+        ASSERT_TRUE(AZ::Utils::WriteFile(robot, robotPath).IsSuccess());
+
+        ROS2::Utils::xacro::ExpansionInputs inputs;
+        const auto expansion = ROS2::Utils::xacro::ExpandXacro(robotPath, {}, inputs);
+        ASSERT_TRUE(expansion.IsSuccess()) << expansion.GetError().c_str();
+        ASSERT_TRUE(inputs.m_environment.contains("ROS2_XACRO_TEST_UNSET_VARIABLE"));
+        EXPECT_FALSE(inputs.m_environment["ROS2_XACRO_TEST_UNSET_VARIABLE"]);
+
+        ROS2::Utils::xacro::ExpansionCache cache;
+        cache.Store(robotPath, {}, expansion.GetValue(), inputs);
+        EXPECT_EQ(cache.Find(robotPath, {}), AZStd::optional<AZStd::string>(expansion.GetValue()));
+
+        // Expansions are not reused once a variable they read has another value or a package they found is elsewhere
+        auto changedEnvironment = inputs;
+        changedEnvironment.m_environment["ROS2_XACRO_TEST_UNSET_VARIABLE"] = "other_link";
+        cache.Store(robotPath, {}, expansion.GetValue(), changedEnvironment);
+        EXPECT_FALSE(cache.Find(robotPath, {}));
+
+        auto movedPackage = inputs;
+        movedPackage.m_packages["ros2_xacro_test_package"] = tempDirectory.Resolve("ros2_xacro_test_package").String();
+        cache.Store(robotPath, {}, expansion.GetValue(), movedPackage);
+        EXPECT_FALSE(cache.Find(robotPath, {}));
+
+        ASSERT_TRUE(AZ::IO::SystemFile::CreateDir(tempDirectory.Resolve("ros2_xacro_test_package").c_str()));
+        const AZStd::string packageManifestPath = tempDirectory.Resolve("ros2_xacro_test_package/package.xml").String();
+        ASSERT_TRUE(AZ::Utils::WriteFile(AZStd::string("<package/>"), packageManifestPath).IsSuccess());
+        EXPECT_EQ(cache.Find(robotPath, {}), AZStd::optional<AZStd::string>(expansion.GetValue()));
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Finds world transforms of all links by walking from each link to the root, for a chain (branching 1) and a wide tree.
+    static void BM_WorldTransformsWalkToRoot(benchmark::State& state)
+    {
+        const auto urdf = ROS2::UrdfParser::Parse(
+            MakeSyntheticURDF(aznumeric_cast<size_t>(state.range(0)), aznumeric_cast<size_t>(state.range(1))));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const auto& [name, link] : urdf->links_)
+            {
+                benchmark::DoNotOptimize(ROS2::Utils::GetWorldTransformURDF(link));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_WorldTransformsWalkToRoot)->Args({ 1000, 1 })->Args({ 1000, 32 });
+
+    //! Finds world transforms of all links with the cache, including the time to build the cache.
+    static void BM_WorldTransformsCache(benchmark::State& state)
+    {
+        const auto urdf = ROS2::UrdfParser::Parse(
+            MakeSyntheticURDF(aznumeric_cast<size_t>(state.range(0)), aznumeric_cast<size_t>(state.range(1))));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const ROS2::Utils::LinkTransformCache transformCache(urdf->root_link_);
+            for (const auto& [name, link] : urdf->links_)
+            {
+                benchmark::DoNotOptimize(transformCache.GetWorldTransform(link));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_WorldTransformsCache)->Args({ 1000, 1 })->Args({ 1000, 32 });
+#endif
 } // namespace UnitTest
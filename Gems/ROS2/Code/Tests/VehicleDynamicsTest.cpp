@@ -0,0 +1,618 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Debug/AllocationRecords.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_unique.h>
+#include <AzTest/AzTest.h>
+
+#include <ROS2/RobotControl/Ackermann/AckermannCommandStruct.h>
+#include <ROS2/VehicleDynamics/VehicleInputControlBus.h>
+#include <VehicleDynamics/DriveModels/AckermannDriveModel.h>
+#include <VehicleDynamics/DriveModels/AckermannSteeringGeometry.h>
+#include <VehicleDynamics/DriveModels/MecanumDriveModel.h>
+#include <VehicleDynamics/ModelComponents/AckermannModelComponent.h>
+#include <VehicleDynamics/Utilities.h>
+#include <VehicleDynamics/VehicleCommandMailbox.h>
+#include <VehicleDynamics/VehicleDynamicsSystem.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    namespace
+    {
+        //! Time is counted in integer ticks, so that frames at 20 and 120 fps, 60 Hz physics substeps and publications
+        //! at whole milliseconds align exactly.
+        constexpr int TicksPerSecond = 12000;
+        constexpr int PhysicsSubstepTicks = TicksPerSecond / 60;
+        constexpr int SimulationTicks = 8 * TicksPerSecond;
+        //! Commands are published at 10 Hz, starting 13 ms after the start, so publications are never on a frame boundary.
+        constexpr int PublishingPeriodTicks = TicksPerSecond / 10;
+        constexpr int FirstPublicationTicks = 13 * TicksPerSecond / 1000;
+
+        constexpr float Wheelbase = 2.0f;
+        constexpr float Track = 1.5f;
+        constexpr float WheelRadius = 0.3f;
+
+        int64_t TicksToUs(int ticks)
+        {
+            return static_cast<int64_t>(ticks) * 1'000'000 / TicksPerSecond;
+        }
+
+        struct VehiclePose
+        {
+            double m_x = 0.0;
+            double m_y = 0.0;
+            double m_yaw = 0.0;
+        };
+
+        //! Ackermann command as published by a ROS 2 node.
+        ROS2::AckermannCommandStruct GetCommand(int tick)
+        {
+            const float time = static_cast<float>(tick) / TicksPerSecond;
+            ROS2::AckermannCommandStruct command;
+            command.m_speed = time < 6.0f ? 2.0f : 0.0f;
+            command.m_steeringAngle = time < 1.0f ? 0.0f : (time < 4.0f ? 0.3f : -0.2f);
+            return command;
+        }
+
+        //! Vehicle with steering front wheels and drive rear wheels. Wheel entities do not exist, so wheel rates and steering
+        //! are computed but not applied to joints, and steering elements are always at their target angles.
+        ROS2::VehicleDynamics::VehicleConfiguration BuildAckermannVehicle()
+        {
+            ROS2::VehicleDynamics::VehicleConfiguration vehicleConfig;
+            vehicleConfig.m_wheelbase = Wheelbase;
+            vehicleConfig.m_track = Track;
+            vehicleConfig.m_axles.push_back(ROS2::VehicleDynamics::Utilities::Create2WheelAxle(
+                AZ::EntityId(101), AZ::EntityId(102), "Front", WheelRadius, true, false));
+            vehicleConfig.m_axles.push_back(ROS2::VehicleDynamics::Utilities::Create2WheelAxle(
+                AZ::EntityId(103), AZ::EntityId(104), "Rear", WheelRadius, false, true));
+            return vehicleConfig;
+        }
+
+        //! Ackermann vehicle model component with a given vehicle configuration, as it would be loaded with its entity.
+        class TestAckermannVehicleModelComponent : public ROS2::VehicleDynamics::AckermannVehicleModelComponent
+        {
+        public:
+            explicit TestAckermannVehicleModelComponent(const ROS2::VehicleDynamics::VehicleConfiguration& vehicleConfig)
+            {
+                m_vehicleConfiguration = vehicleConfig;
+            }
+        };
+
+        //! Runs an Ackermann vehicle in the vehicle dynamics system, stepped as the physics scene steps it.
+        //! Commands are written to the mailbox of the vehicle with their publication time as the receive time, before the
+        //! frame which follows the publication. Each frame runs the physics substeps accumulated since the previous frame.
+        //! The vehicle drives a kinematic bicycle model, with the speed of its drive wheels and the mean angle of its
+        //! steering wheels.
+        //! @returns pose after every physics substep.
+        AZStd::vector<VehiclePose> SimulateAtFrameRate(int framesPerSecond)
+        {
+            const int frameTicks = TicksPerSecond / framesPerSecond;
+            const AZ::u64 substepNs = 1'000'000'000ull * PhysicsSubstepTicks / TicksPerSecond;
+            const double substep = static_cast<double>(PhysicsSubstepTicks) / TicksPerSecond;
+
+            AZ::Entity vehicleEntity;
+            vehicleEntity.CreateComponent<ROS2::VehicleDynamics::AckermannVehicleModelComponent>();
+            ROS2::VehicleDynamics::AckermannDriveModel driveModel;
+            driveModel.Activate(BuildAckermannVehicle());
+            ROS2::VehicleDynamics::VehicleInputDeadline inputs;
+            ROS2::VehicleDynamics::VehicleDynamicsSystem system;
+            system.RegisterVehicle(vehicleEntity.GetId(), &driveModel, &inputs);
+            const auto mailbox = system.AcquireCommandMailbox(&vehicleEntity);
+
+            AZStd::vector<VehiclePose> trajectory;
+            VehiclePose pose;
+            int nextPublicationTick = FirstPublicationTicks;
+            int accumulatedTicks = 0;
+            for (int frameTick = frameTicks; frameTick <= SimulationTicks; frameTick += frameTicks)
+            {
+                for (; nextPublicationTick <= frameTick; nextPublicationTick += PublishingPeriodTicks)
+                {
+                    mailbox->WriteAckermann(GetCommand(nextPublicationTick), TicksToUs(nextPublicationTick));
+                }
+
+                accumulatedTicks += frameTicks;
+                while (accumulatedTicks >= PhysicsSubstepTicks)
+                {
+                    system.Step(substepNs, TicksToUs(frameTick - accumulatedTicks), 0);
+
+                    const auto& steeringAngles = driveModel.GetTargetAngles();
+                    const double steering = 0.5 * (steeringAngles[0] + steeringAngles[1]);
+                    const double speed = system.GetFleetState().GetWheelRate(0) * WheelRadius;
+                    pose.m_x += speed * AZStd::cos(pose.m_yaw) * substep;
+                    pose.m_y += speed * AZStd::sin(pose.m_yaw) * substep;
+                    pose.m_yaw += speed * AZStd::tan(steering) / Wheelbase * substep;
+                    trajectory.push_back(pose);
+                    accumulatedTicks -= PhysicsSubstepTicks;
+                }
+            }
+
+            system.UnregisterVehicle(vehicleEntity.GetId());
+            driveModel.Deactivate();
+            return trajectory;
+        }
+
+        //! Fills the fleet with skid steering vehicles of four wheels, without joints to apply rates to.
+        void AddSkidSteeringVehicles(ROS2::VehicleDynamics::VehicleFleetState& fleetState, size_t vehicleCount)
+        {
+            ROS2::VehicleDynamics::VehicleFleetState::VehicleLimits limits;
+            limits.m_linearAcceleration = 1.0f;
+            limits.m_angularAcceleration = 2.0f;
+            limits.m_linearSpeedLimit = 3.0f;
+            limits.m_angularSpeedLimit = 1.0f;
+            constexpr float LeverArms[4] = { -0.5f, 0.5f, -0.5f, 0.5f };
+            for (size_t i = 0; i < vehicleCount; ++i)
+            {
+                const size_t vehicleIndex = fleetState.AddVehicle(limits);
+                for (const float leverArm : LeverArms)
+                {
+                    fleetState.AddWheel(vehicleIndex, nullptr, leverArm, 0.25f);
+                }
+            }
+        }
+
+        //! Vehicle with two axles of two wheels, steering on the front axle and on the rear one if requested.
+        //! Steering elements are the left and right front wheels, followed by the rear ones.
+        ROS2::VehicleDynamics::AckermannSteeringGeometry BuildSteeringGeometry(float wheelbase, float track, bool rearSteering)
+        {
+            ROS2::VehicleDynamics::VehicleConfiguration vehicleConfig;
+            vehicleConfig.m_wheelbase = wheelbase;
+            vehicleConfig.m_track = track;
+            vehicleConfig.m_axles.push_back(
+                ROS2::VehicleDynamics::Utilities::Create2WheelAxle(AZ::EntityId(), AZ::EntityId(), "Front", 0.3f, true, false));
+            vehicleConfig.m_axles.push_back(
+                ROS2::VehicleDynamics::Utilities::Create2WheelAxle(AZ::EntityId(), AZ::EntityId(), "Rear", 0.3f, rearSteering, true));
+
+            AZStd::vector<ROS2::VehicleDynamics::SteeringDynamicsData> steeringElements;
+            for (AZ::u32 axleIndex = 0; axleIndex < (rearSteering ? 2u : 1u); ++axleIndex)
+            {
+                for (const float axlePosition : { -1.0f, 1.0f })
+                {
+                    ROS2::VehicleDynamics::SteeringDynamicsData steeringData;
+                    steeringData.m_axleIndex = axleIndex;
+                    steeringData.m_axlePosition = axlePosition;
+                    steeringElements.push_back(steeringData);
+                }
+            }
+
+            ROS2::VehicleDynamics::AckermannSteeringGeometry geometry;
+            geometry.Build(vehicleConfig, steeringElements);
+            return geometry;
+        }
+    } // namespace
+
+    class VehicleDynamicsTest : public LeakDetectionFixture
+    {
+    };
+
+    struct SteeringGeometryParams
+    {
+        float m_wheelbase;
+        float m_track;
+        float m_steering;
+    };
+
+    class AckermannSteeringGeometryTest
+        : public LeakDetectionFixture
+        , public ::testing::WithParamInterface<SteeringGeometryParams>
+    {
+    };
+
+    TEST_P(AckermannSteeringGeometryTest, FrontSteeringMatchesInnerAndOuterAngles)
+    {
+        const auto& params = GetParam();
+        const auto geometry = BuildSteeringGeometry(params.m_wheelbase, params.m_track, false);
+        ASSERT_EQ(geometry.GetWheelCount(), 2);
+
+        // Turning left, the left wheel is the inner one
+        const float tanSteering = AZStd::tan(params.m_steering);
+        const float innerAngle = AZ::Atan2(params.m_wheelbase * tanSteering, params.m_wheelbase - 0.5f * params.m_track * tanSteering);
+        const float outerAngle = AZ::Atan2(params.m_wheelbase * tanSteering, params.m_wheelbase + 0.5f * params.m_track * tanSteering);
+        AZStd::vector<float> angles;
+        geometry.ComputeAngles(params.m_steering, angles);
+        ASSERT_EQ(angles.size(), 2);
+        EXPECT_NEAR(angles[0], innerAngle, 1e-5f);
+        EXPECT_NEAR(angles[1], outerAngle, 1e-5f);
+        EXPECT_GT(AZStd::abs(angles[0]), AZStd::abs(angles[1]));
+
+        // Turning right mirrors the angles
+        AZStd::vector<float> mirroredAngles;
+        geometry.ComputeAngles(-params.m_steering, mirroredAngles);
+        EXPECT_NEAR(mirroredAngles[0], -angles[1], 1e-5f);
+        EXPECT_NEAR(mirroredAngles[1], -angles[0], 1e-5f);
+    }
+
+    TEST_P(AckermannSteeringGeometryTest, FourWheelSteeringTurnsRearWheelsOpposite)
+    {
+        const auto& params = GetParam();
+        const auto geometry = BuildSteeringGeometry(params.m_wheelbase, params.m_track, true);
+        ASSERT_EQ(geometry.GetWheelCount(), 4);
+
+        // The turning center is in the middle of the vehicle, front wheels turn as on a vehicle of half the wheelbase
+        const auto halfWheelbaseGeometry = BuildSteeringGeometry(0.5f * params.m_wheelbase, params.m_track, false);
+        AZStd::vector<float> angles;
+        AZStd::vector<float> frontAngles;
+        geometry.ComputeAngles(params.m_steering, angles);
+        halfWheelbaseGeometry.ComputeAngles(params.m_steering, frontAngles);
+        ASSERT_EQ(angles.size(), 4);
+        EXPECT_NEAR(angles[0], frontAngles[0], 1e-5f);
+        EXPECT_NEAR(angles[1], frontAngles[1], 1e-5f);
+        EXPECT_NEAR(angles[2], -frontAngles[0], 1e-5f);
+        EXPECT_NEAR(angles[3], -frontAngles[1], 1e-5f);
+    }
+
+    INSTANTIATE_TEST_CASE_P(
+        VehicleDynamicsTest,
+        AckermannSteeringGeometryTest,
+        ::testing::Values(
+            SteeringGeometryParams{ 2.0f, 1.5f, 0.3f },
+            SteeringGeometryParams{ 2.0f, 1.5f, 0.01f },
+            SteeringGeometryParams{ 0.5f, 0.4f, 0.6f },
+            SteeringGeometryParams{ 4.5f, 2.0f, 0.15f }));
+
+    //! Commands arrive between frames and are applied from the first physics substep which starts after they were received,
+    //! so the vehicle follows the same trajectory at frame rates below and above the physics rate.
+    TEST_F(VehicleDynamicsTest, AckermannTrajectoryIndependentOfFrameRate)
+    {
+        const auto trajectoryAt20Fps = SimulateAtFrameRate(20);
+        const auto trajectoryAt120Fps = SimulateAtFrameRate(120);
+
+        ASSERT_EQ(trajectoryAt20Fps.size(), SimulationTicks / PhysicsSubstepTicks);
+        ASSERT_EQ(trajectoryAt20Fps.size(), trajectoryAt120Fps.size());
+        for (size_t i = 0; i < trajectoryAt20Fps.size(); ++i)
+        {
+            EXPECT_NEAR(trajectoryAt20Fps[i].m_x, trajectoryAt120Fps[i].m_x, 1e-9) << "substep " << i;
+            EXPECT_NEAR(trajectoryAt20Fps[i].m_y, trajectoryAt120Fps[i].m_y, 1e-9) << "substep " << i;
+            EXPECT_NEAR(trajectoryAt20Fps[i].m_yaw, trajectoryAt120Fps[i].m_yaw, 1e-9) << "substep " << i;
+        }
+
+        // The vehicle has moved, turned both ways and stopped, so the comparison is not trivial
+        EXPECT_GT(trajectoryAt20Fps.back().m_x, 5.0);
+        EXPECT_GT(AZStd::abs(trajectoryAt20Fps.back().m_yaw), 0.1);
+        EXPECT_EQ(trajectoryAt20Fps.back().m_x, trajectoryAt20Fps[trajectoryAt20Fps.size() - 2].m_x);
+    }
+
+    TEST_F(VehicleDynamicsTest, FleetStateComputesSkidSteeringWheelRates)
+    {
+        ROS2::VehicleDynamics::VehicleFleetState fleetState;
+        AddSkidSteeringVehicles(fleetState, 2);
+        ASSERT_EQ(fleetState.GetWheelCount(), 8);
+
+        // Targets are reached in one second, within the ramp limits
+        fleetState.SetTarget(0, 1.0f, 0.0f, 0.0f, false);
+        fleetState.SetTarget(1, 0.0f, 0.0f, 1.0f, false);
+        for (int i = 0; i < 100; ++i)
+        {
+            fleetState.ComputeWheelRates(10'000'000);
+        }
+
+        EXPECT_NEAR(fleetState.GetLinearSpeed(0), 1.0f, 1e-4f);
+        EXPECT_NEAR(fleetState.GetAngularSpeed(1), 1.0f, 1e-4f);
+        for (size_t wheel = 0; wheel < 4; ++wheel)
+        {
+            EXPECT_NEAR(fleetState.GetWheelRate(wheel), 4.0f, 1e-3f);
+        }
+        EXPECT_NEAR(fleetState.GetWheelRate(4), -2.0f, 1e-3f);
+        EXPECT_NEAR(fleetState.GetWheelRate(5), 2.0f, 1e-3f);
+    }
+
+    TEST_F(VehicleDynamicsTest, FleetStateRemovalKeepsWheelsOfMovedVehicle)
+    {
+        ROS2::VehicleDynamics::VehicleFleetState fleetState;
+        AddSkidSteeringVehicles(fleetState, 3);
+        fleetState.SetTarget(2, 0.5f, 0.0f, 0.0f, false);
+        fleetState.ComputeWheelRates(1'000'000'000);
+
+        // The last vehicle takes the index of the removed one, together with its wheels
+        fleetState.RemoveVehicle(0);
+        ASSERT_EQ(fleetState.GetVehicleCount(), 2);
+        ASSERT_EQ(fleetState.GetWheelCount(), 8);
+        EXPECT_NEAR(fleetState.GetLinearSpeed(0), 0.5f, 1e-4f);
+
+        fleetState.ComputeWheelRates(1'000'000'000);
+        size_t movingWheels = 0;
+        for (size_t wheel = 0; wheel < fleetState.GetWheelCount(); ++wheel)
+        {
+            movingWheels += AZ::IsClose(fleetState.GetWheelRate(wheel), 2.0f, 1e-3f) ? 1 : 0;
+        }
+        EXPECT_EQ(movingWheels, 4);
+    }
+
+    TEST_F(VehicleDynamicsTest, FleetStateComputesMecanumWheelRates)
+    {
+        ROS2::VehicleDynamics::VehicleFleetState::VehicleLimits limits;
+        limits.m_linearAcceleration = 10.0f;
+        limits.m_lateralAcceleration = 10.0f;
+        limits.m_angularAcceleration = 10.0f;
+        limits.m_linearSpeedLimit = 1.0f;
+        limits.m_lateralSpeedLimit = 1.0f;
+        limits.m_angularSpeedLimit = 1.0f;
+
+        // Front left, front right, rear left and rear right wheels of a vehicle, rollers at 45 degrees
+        constexpr float HalfWheelbase = 0.3f;
+        constexpr float HalfTrack = 0.2f;
+        constexpr float WheelRadius = 0.05f;
+        constexpr float WheelPositions[4][2] = {
+            { HalfWheelbase, HalfTrack }, { HalfWheelbase, -HalfTrack }, { -HalfWheelbase, HalfTrack }, { -HalfWheelbase, -HalfTrack }
+        };
+        ROS2::VehicleDynamics::VehicleFleetState fleetState;
+        for (size_t vehicle = 0; vehicle < 3; ++vehicle)
+        {
+            fleetState.AddVehicle(limits);
+            for (const auto& position : WheelPositions)
+            {
+                const AZ::Vector3 inverseKinematics = ROS2::VehicleDynamics::MecanumDriveModel::ComputeWheelInverseKinematics(
+                    position[0], position[1], WheelRadius, AZ::Constants::QuarterPi);
+                fleetState.AddWheel(vehicle, nullptr, inverseKinematics);
+            }
+        }
+        fleetState.SetTarget(0, 0.0f, 0.5f, 0.0f, false);
+        fleetState.SetTarget(1, 0.0f, 0.0f, 1.0f, false);
+        fleetState.SetTarget(2, 0.5f, 0.0f, 0.0f, false);
+        fleetState.ComputeWheelRates(1'000'000'000);
+        EXPECT_NEAR(fleetState.GetLateralSpeed(0), 0.5f, 1e-4f);
+
+        // Sideways to the left, the front left and rear right wheels turn backwards
+        constexpr float SidewaysRates[4] = { -10.0f, 10.0f, 10.0f, -10.0f };
+        // Turning left in place, wheels on the left turn backwards
+        constexpr float TurningRate = (HalfWheelbase + HalfTrack) / WheelRadius;
+        constexpr float TurningRates[4] = { -TurningRate, TurningRate, -TurningRate, TurningRate };
+        for (size_t wheel = 0; wheel < 4; ++wheel)
+        {
+            EXPECT_NEAR(fleetState.GetWheelRate(wheel), SidewaysRates[wheel], 1e-3f);
+            EXPECT_NEAR(fleetState.GetWheelRate(4 + wheel), TurningRates[wheel], 1e-3f);
+            EXPECT_NEAR(fleetState.GetWheelRate(8 + wheel), 10.0f, 1e-3f);
+        }
+    }
+
+    TEST_F(VehicleDynamicsTest, MailboxDeliversAckermannCommand)
+    {
+        ROS2::VehicleDynamics::VehicleCommandMailbox mailbox;
+        ROS2::VehicleDynamics::VehicleInputDeadline inputs;
+        ROS2::AckermannCommandStruct command;
+        command.m_speed = 0.5f;
+        mailbox.WriteAckermann(command, 800'000);
+        mailbox.DeliverTo(inputs, 850'000, 0);
+        EXPECT_FLOAT_EQ(inputs.GetValueCheckingDeadline(850'000).m_speed.GetX(), 0.5f);
+
+        command.m_speed = 1.5f;
+        command.m_steeringAngle = -0.3f;
+        command.m_acceleration = -2.0f;
+        mailbox.WriteAckermann(command, 1'000'000);
+
+        // A substep which starts before the command was received keeps the previous command
+        mailbox.DeliverTo(inputs, 900'000, 0);
+        EXPECT_FLOAT_EQ(inputs.GetValueCheckingDeadline(900'000).m_speed.GetX(), 0.5f);
+
+        mailbox.DeliverTo(inputs, 1'000'000, 0);
+        const ROS2::VehicleDynamics::VehicleInputs& delivered = inputs.GetValueCheckingDeadline(1'000'000);
+        EXPECT_FLOAT_EQ(delivered.m_speed.GetX(), 1.5f);
+        ASSERT_EQ(delivered.m_jointRequestedPosition.size(), 1u);
+        EXPECT_FLOAT_EQ(delivered.m_jointRequestedPosition.front(), -0.3f);
+
+        // The whole latest command is read back for the notification bus, once per write
+        AZ::u32 notifiedCommands = 0;
+        ROS2::AckermannCommandStruct notified;
+        ASSERT_TRUE(mailbox.ReadAckermann(notified, notifiedCommands));
+        EXPECT_FLOAT_EQ(notified.m_speed, 1.5f);
+        EXPECT_FLOAT_EQ(notified.m_acceleration, -2.0f);
+        EXPECT_FALSE(mailbox.ReadAckermann(notified, notifiedCommands));
+    }
+
+    TEST_F(VehicleDynamicsTest, MailboxReadsAreNeverTorn)
+    {
+        struct Command
+        {
+            AZ::u32 m_values[8];
+        };
+        ROS2::VehicleDynamics::LatestValueMailbox<Command> mailbox;
+        Command command;
+        EXPECT_EQ(mailbox.Read(command), 0);
+
+        constexpr AZ::u32 WriteCount = 100000;
+        AZStd::thread writer(
+            [&mailbox]()
+            {
+                for (AZ::u32 i = 1; i <= WriteCount; ++i)
+                {
+                    Command written;
+                    AZStd::fill(AZStd::begin(written.m_values), AZStd::end(written.m_values), i);
+                    mailbox.Write(written);
+                }
+            });
+
+        // All fields of a value come from the same write and writes are seen in order
+        bool consistent = true;
+        AZ::u32 lastWrite = 0;
+        while (lastWrite < WriteCount)
+        {
+            const AZ::u32 write = mailbox.Read(command);
+            consistent &= write >= lastWrite;
+            lastWrite = write;
+            if (write > 0)
+            {
+                consistent &= AZStd::all_of(
+                    AZStd::begin(command.m_values),
+                    AZStd::end(command.m_values),
+                    [write](AZ::u32 value)
+                    {
+                        return value == write;
+                    });
+            }
+        }
+        writer.join();
+        EXPECT_TRUE(consistent);
+    }
+
+    //! Commands from the manual control and from a subscription reach the vehicle, and the vehicle dynamics system steps it,
+    //! without allocations on any physics substep.
+    TEST_F(VehicleDynamicsTest, InputPathDoesNotAllocate)
+    {
+        AZ::Debug::AllocationRecords* records = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().GetRecords();
+        ASSERT_NE(records, nullptr) << "Allocation records of the system allocator are required";
+
+        AZ::TimeSystem timeSystem;
+        ROS2::VehicleDynamics::VehicleDynamicsSystem system;
+        ROS2::VehicleDynamics::VehicleDynamicsSystemInterface::Register(&system);
+
+        AZ::Entity vehicleEntity;
+        auto* vehicle = vehicleEntity.CreateComponent<TestAckermannVehicleModelComponent>(BuildAckermannVehicle());
+        vehicle->Activate();
+        const auto mailbox = system.AcquireCommandMailbox(&vehicleEntity);
+        ASSERT_TRUE(mailbox);
+
+        using ROS2::VehicleDynamics::VehicleInputControlRequestBus;
+        using ROS2::VehicleDynamics::VehicleInputControlRequests;
+        const AZ::EntityId vehicleId = vehicleEntity.GetId();
+        const auto step = [&](int index)
+        {
+            VehicleInputControlRequestBus::Event(vehicleId, &VehicleInputControlRequests::SetTargetSteering, 0.1f);
+            VehicleInputControlRequestBus::Event(vehicleId, &VehicleInputControlRequests::SetTargetSteeringFraction, 0.2f);
+            VehicleInputControlRequestBus::Event(vehicleId, &VehicleInputControlRequests::SetTargetLinearSpeedFraction, 0.5f);
+            ROS2::AckermannCommandStruct command;
+            command.m_speed = 1.0f;
+            command.m_steeringAngle = index % 2 ? 0.2f : -0.2f;
+            mailbox->WriteAckermann(command);
+            mailbox->WriteTwist(AZ::Vector3::CreateAxisX(1.0f), AZ::Vector3::CreateAxisZ(0.5f));
+            const int64_t nowUs = static_cast<int64_t>(AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeUs());
+            system.Step(16'666'667, nowUs, nowUs - ROS2::VehicleDynamics::VehicleCommandMailbox::GetReceiveTimeUs());
+        };
+
+        // The first step may create buses and other lazily initialized state
+        step(0);
+        const size_t allocationsBefore = records->RequestedAllocs();
+        for (int index = 1; index < 1000; ++index)
+        {
+            step(index);
+        }
+        EXPECT_EQ(records->RequestedAllocs(), allocationsBefore);
+        EXPECT_GT(system.GetFleetState().GetLinearSpeed(0), 0.0f);
+
+        vehicle->Deactivate();
+        ROS2::VehicleDynamics::VehicleDynamicsSystemInterface::Unregister(&system);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Computes wheel rates of a fleet of 1, 50 and 500 skid steering vehicles.
+    static void BM_VehicleFleetComputeWheelRates(benchmark::State& state)
+    {
+        ROS2::VehicleDynamics::VehicleFleetState fleetState;
+        const size_t vehicleCount = aznumeric_cast<size_t>(state.range(0));
+        AddSkidSteeringVehicles(fleetState, vehicleCount);
+        for (size_t i = 0; i < vehicleCount; ++i)
+        {
+            fleetState.SetTarget(i, 2.0f, 0.0f, 0.5f, false);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            fleetState.ComputeWheelRates(16'666'667);
+            benchmark::DoNotOptimize(fleetState.GetWheelRate(0));
+        }
+        state.SetItemsProcessed(state.iterations() * vehicleCount);
+    }
+    BENCHMARK(BM_VehicleFleetComputeWheelRates)->Arg(1)->Arg(50)->Arg(500);
+
+    //! Skid steering vehicle updated on its own, as the drive model of each vehicle model component was before the fleet state.
+    //! Each vehicle is a separate allocation, wheels are grouped by axles and their joints are looked up by wheel entity.
+    class PerComponentSkidSteeringVehicle
+    {
+    public:
+        explicit PerComponentSkidSteeringVehicle(AZ::u64 firstWheelId)
+        {
+            for (int axleIndex = 0; axleIndex < 2; ++axleIndex)
+            {
+                Axle& axle = m_axles.emplace_back();
+                for (int wheelIndex = 0; wheelIndex < 2; ++wheelIndex)
+                {
+                    const AZ::EntityId wheel(firstWheelId++);
+                    axle.m_wheels.push_back(wheel);
+                    m_wheelRates[wheel] = 0.0f;
+                }
+            }
+        }
+
+        void ApplyState(float linearTargetSpeed, float angularTargetSpeed, AZ::u64 deltaTimeNs)
+        {
+            m_linearSpeed =
+                ROS2::VehicleDynamics::Utilities::ComputeRampVelocity(linearTargetSpeed, m_linearSpeed, deltaTimeNs, 1.0f, 3.0f);
+            m_angularSpeed =
+                ROS2::VehicleDynamics::Utilities::ComputeRampVelocity(angularTargetSpeed, m_angularSpeed, deltaTimeNs, 2.0f, 1.0f);
+            for (const Axle& axle : m_axles)
+            {
+                const size_t wheelCount = axle.m_wheels.size();
+                for (size_t wheelIndex = 0; wheelIndex < wheelCount; ++wheelIndex)
+                {
+                    auto wheelRate = m_wheelRates.find(axle.m_wheels[wheelIndex]);
+                    if (wheelRate == m_wheelRates.end())
+                    {
+                        continue;
+                    }
+                    const float normalizedWheelId = -1.0f + 2.0f * wheelIndex / (wheelCount - 1);
+                    const float leverArm = normalizedWheelId * Wheelbase / 2.0f;
+                    wheelRate->second = (m_linearSpeed + m_angularSpeed * leverArm) / axle.m_wheelRadius;
+                }
+            }
+        }
+
+        float GetWheelRate(AZ::EntityId wheel) const
+        {
+            return m_wheelRates.at(wheel);
+        }
+
+    private:
+        static constexpr float Wheelbase = 1.0f;
+
+        struct Axle
+        {
+            AZStd::vector<AZ::EntityId> m_wheels;
+            float m_wheelRadius = 0.25f;
+        };
+
+        AZStd::vector<Axle> m_axles;
+        AZStd::unordered_map<AZ::EntityId, float> m_wheelRates;
+        float m_linearSpeed = 0.0f;
+        float m_angularSpeed = 0.0f;
+    };
+
+    //! Baseline of BM_VehicleFleetComputeWheelRates: the same vehicles updated one by one.
+    static void BM_PerComponentComputeWheelRates(benchmark::State& state)
+    {
+        const size_t vehicleCount = aznumeric_cast<size_t>(state.range(0));
+        AZStd::vector<AZStd::unique_ptr<PerComponentSkidSteeringVehicle>> vehicles;
+        for (size_t i = 0; i < vehicleCount; ++i)
+        {
+            vehicles.push_back(AZStd::make_unique<PerComponentSkidSteeringVehicle>(4 * i + 1));
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& vehicle : vehicles)
+            {
+                vehicle->ApplyState(2.0f, 0.5f, 16'666'667);
+            }
+            benchmark::DoNotOptimize(vehicles.front()->GetWheelRate(AZ::EntityId(1)));
+        }
+        state.SetItemsProcessed(state.iterations() * vehicleCount);
+    }
+    BENCHMARK(BM_PerComponentComputeWheelRates)->Arg(1)->Arg(50)->Arg(500);
+#endif
+} // namespace UnitTest
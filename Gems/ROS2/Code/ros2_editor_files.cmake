@@ -26,6 +26,8 @@ set(FILES
     Source/RobotImporter/RobotImporterWidget.h
     Source/RobotImporter/ROS2RobotImporterEditorSystemComponent.cpp
     Source/RobotImporter/ROS2RobotImporterEditorSystemComponent.h
+    Source/RobotImporter/URDFBatchImporter.cpp
+    Source/RobotImporter/URDFBatchImporter.h
     Source/RobotImporter/URDF/CollidersMaker.cpp
     Source/RobotImporter/URDF/CollidersMaker.h
     Source/RobotImporter/URDF/InertialsMaker.cpp
@@ -38,12 +40,20 @@ set(FILES
     Source/RobotImporter/URDF/UrdfParser.h
     Source/RobotImporter/URDF/URDFPrefabMaker.cpp
     Source/RobotImporter/URDF/URDFPrefabMaker.h
+    Source/RobotImporter/URDF/VehicleModelMaker.cpp
+    Source/RobotImporter/URDF/VehicleModelMaker.h
     Source/RobotImporter/URDF/VisualsMaker.cpp
     Source/RobotImporter/URDF/VisualsMaker.h
+    Source/RobotImporter/xacro/XacroEvaluator.cpp
+    Source/RobotImporter/xacro/XacroEvaluator.h
     Source/RobotImporter/xacro/XacroUtils.cpp
     Source/RobotImporter/xacro/XacroUtils.h
+    Source/RobotImporter/Utils/ColliderManifestCache.cpp
+    Source/RobotImporter/Utils/ColliderManifestCache.h
     Source/RobotImporter/Utils/RobotImporterUtils.cpp
     Source/RobotImporter/Utils/RobotImporterUtils.h
+    Source/RobotImporter/Utils/SourceAssetsIndex.cpp
+    Source/RobotImporter/Utils/SourceAssetsIndex.h
     Source/RobotImporter/Utils/SourceAssetsStorage.cpp
     Source/RobotImporter/Utils/SourceAssetsStorage.h
     Source/RobotImporter/Utils/TypeConversions.cpp
@@ -5,5 +5,6 @@
 
 set(FILES
     Tests/ROS2EditorTest.cpp
+    Tests/SourceAssetsStorageTest.cpp
     Tests/UrdfParserTest.cpp
 )
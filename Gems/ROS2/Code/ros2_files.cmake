@@ -37,9 +37,15 @@ set(FILES
         Source/Lidar/LidarTemplateUtils.h
         Source/Lidar/ROS2LidarSensorComponent.cpp
         Source/Lidar/ROS2LidarSensorComponent.h
+        Source/Manipulation/CompiledJointTrajectory.cpp
+        Source/Manipulation/CompiledJointTrajectory.h
+        Source/Manipulation/JointControlSystem.cpp
+        Source/Manipulation/JointControlSystem.h
         Source/Manipulation/MotorizedJointComponent.cpp
         Source/Manipulation/JointPublisherComponent.cpp
         Source/Manipulation/ManipulatorControllerComponent.cpp
+        Source/Odometry/OdometrySystem.cpp
+        Source/Odometry/OdometrySystem.h
         Source/Odometry/ROS2OdometrySensorComponent.cpp
         Source/Odometry/ROS2OdometrySensorComponent.h
         Source/RobotControl/Ackermann/AckermannSubscriptionHandler.cpp
@@ -47,6 +53,8 @@ set(FILES
         Source/RobotControl/ControlConfiguration.cpp
         Source/RobotControl/Controllers/AckermannController/AckermannControlComponent.cpp
         Source/RobotControl/Controllers/AckermannController/AckermannControlComponent.h
+        Source/RobotControl/Controllers/MecanumController/MecanumControlComponent.cpp
+        Source/RobotControl/Controllers/MecanumController/MecanumControlComponent.h
         Source/RobotControl/Controllers/RigidBodyController/RigidBodyTwistControlComponent.cpp
         Source/RobotControl/Controllers/RigidBodyController/RigidBodyTwistControlComponent.h
         Source/RobotControl/Controllers/SkidSteeringController/SkidSteeringControlComponent.cpp
@@ -61,11 +69,16 @@ set(FILES
         Source/ROS2SystemComponent.h
         Source/Sensor/ROS2SensorComponent.cpp
         Source/Sensor/SensorConfiguration.cpp
+        Source/Spawner/EntitySpawner.cpp
+        Source/Spawner/EntitySpawner.h
         Source/Spawner/ROS2SpawnerComponent.cpp
         Source/Spawner/ROS2SpawnerComponent.h
         Source/Spawner/ROS2SpawnPointComponent.cpp
         Source/Spawner/ROS2SpawnPointComponent.h
+        Source/Spawner/SpawnableInstancePool.cpp
+        Source/Spawner/SpawnableInstancePool.h
         Source/Utilities/Controllers/PidConfiguration.cpp
+        Source/Utilities/PhysicsSubstepSystem.h
         Source/Utilities/ROS2Conversions.cpp
         Source/Utilities/ROS2Names.cpp
         Source/VehicleDynamics/AxleConfiguration.cpp
@@ -74,28 +87,42 @@ set(FILES
         Source/VehicleDynamics/DriveModel.h
         Source/VehicleDynamics/DriveModels/AckermannDriveModel.cpp
         Source/VehicleDynamics/DriveModels/AckermannDriveModel.h
+        Source/VehicleDynamics/DriveModels/AckermannSteeringGeometry.cpp
+        Source/VehicleDynamics/DriveModels/AckermannSteeringGeometry.h
+        Source/VehicleDynamics/DriveModels/MecanumDriveModel.cpp
+        Source/VehicleDynamics/DriveModels/MecanumDriveModel.h
         Source/VehicleDynamics/DriveModels/SkidSteeringDriveModel.cpp
         Source/VehicleDynamics/DriveModels/SkidSteeringDriveModel.h
         Source/VehicleDynamics/ManualControlEventHandler.h
         Source/VehicleDynamics/Utilities.cpp
         Source/VehicleDynamics/Utilities.h
+        Source/VehicleDynamics/VehicleCommandMailbox.cpp
+        Source/VehicleDynamics/VehicleCommandMailbox.h
         Source/VehicleDynamics/VehicleConfiguration.cpp
         Source/VehicleDynamics/VehicleConfiguration.h
+        Source/VehicleDynamics/VehicleDynamicsSystem.cpp
+        Source/VehicleDynamics/VehicleDynamicsSystem.h
         Source/VehicleDynamics/VehicleInputs.cpp
         Source/VehicleDynamics/VehicleInputs.h
         Source/VehicleDynamics/VehicleModelComponent.cpp
         Source/VehicleDynamics/VehicleModelComponent.h
         Source/VehicleDynamics/ModelComponents/AckermannModelComponent.cpp
         Source/VehicleDynamics/ModelComponents/AckermannModelComponent.h
+        Source/VehicleDynamics/ModelComponents/MecanumModelComponent.cpp
+        Source/VehicleDynamics/ModelComponents/MecanumModelComponent.h
         Source/VehicleDynamics/ModelComponents/SkidSteeringModelComponent.cpp
         Source/VehicleDynamics/ModelComponents/SkidSteeringModelComponent.h
         Source/VehicleDynamics/VehicleModelLimits.cpp
         Source/VehicleDynamics/VehicleModelLimits.h
         Source/VehicleDynamics/ModelLimits/AckermannModelLimits.cpp
         Source/VehicleDynamics/ModelLimits/AckermannModelLimits.h
+        Source/VehicleDynamics/ModelLimits/MecanumModelLimits.cpp
+        Source/VehicleDynamics/ModelLimits/MecanumModelLimits.h
         Source/VehicleDynamics/ModelLimits/SkidSteeringModelLimits.cpp
         Source/VehicleDynamics/ModelLimits/SkidSteeringModelLimits.h
         Source/VehicleDynamics/WheelControllerComponent.cpp
         Source/VehicleDynamics/WheelControllerComponent.h
         Source/VehicleDynamics/WheelDynamicsData.h
+        Source/VehicleDynamics/WheelHandleTable.cpp
+        Source/VehicleDynamics/WheelHandleTable.h
         )
@@ -5,5 +5,10 @@
 
 set(FILES
     Tests/ROS2Test.cpp
+    Tests/CompiledJointTrajectoryTest.cpp
     Tests/GNSSTest.cpp
+    Tests/JointControlSystemTest.cpp
+    Tests/OdometryTest.cpp
+    Tests/SpawnerTest.cpp
+    Tests/VehicleDynamicsTest.cpp
 )